@@ -668,9 +668,12 @@ class CYIVideojsVideoPlayerProperties {
 
         const _properties = {
             instance: null,
+            instances: { },
+            nextInstanceId: 1,
             script: null,
             dependenciesLoaded: false,
-            playerVersion: null
+            playerVersion: null,
+            defaultBufferGoals: null
         };
 
         Object.defineProperty(self, "instance", {
@@ -693,6 +696,27 @@ class CYIVideojsVideoPlayerProperties {
             }
         });
 
+        Object.defineProperty(self, "instances", {
+            enumerable: true,
+            get() {
+                return _properties.instances;
+            }
+        });
+
+        Object.defineProperty(self, "nextInstanceId", {
+            enumerable: true,
+            get() {
+                return _properties.nextInstanceId;
+            },
+            set(value) {
+                const newValue = CYIUtilities.parseInteger(value);
+
+                if(!isNaN(newValue) && newValue > _properties.nextInstanceId) {
+                    _properties.nextInstanceId = newValue;
+                }
+            }
+        });
+
         Object.defineProperty(self, "script", {
             enumerable: true,
             get() {
@@ -738,6 +762,20 @@ class CYIVideojsVideoPlayerProperties {
                 }
             }
         });
+
+        Object.defineProperty(self, "defaultBufferGoals", {
+            enumerable: true,
+            get() {
+                return _properties.defaultBufferGoals;
+            },
+            set(value) {
+                if(!CYIUtilities.isObjectStrict(value)) {
+                    throw CYIUtilities.createError("Invalid default buffer goals!");
+                }
+
+                _properties.defaultBufferGoals = value;
+            }
+        });
     }
 }
 
@@ -753,7 +791,8 @@ class CYIVideojsVideoPlayer {
         const _properties = {
             streamFormats: [],
             externalTextTrackIdCounter: 1,
-            externalTextTrackQueue: []
+            externalTextTrackQueue: [],
+            renditionRepresentationIds: []
         };
 
         Object.defineProperty(self, "state", {
@@ -983,6 +1022,85 @@ class CYIVideojsVideoPlayer {
             }
         });
 
+        Object.defineProperty(self, "renditionRepresentationIds", {
+            enumerable: true,
+            get() {
+                return _properties.renditionRepresentationIds;
+            }
+        });
+
+        Object.defineProperty(self, "selectedRepresentationId", {
+            enumerable: true,
+            get() {
+                return _properties.selectedRepresentationId;
+            },
+            set(value) {
+                let newValue = CYIUtilities.trimString(value);
+
+                if(CYIUtilities.isEmptyString(newValue)) {
+                    newValue = null;
+                }
+
+                _properties.selectedRepresentationId = newValue;
+            }
+        });
+
+        Object.defineProperty(self, "externalABREnabled", {
+            enumerable: true,
+            get() {
+                return _properties.externalABREnabled;
+            },
+            set(value) {
+                _properties.externalABREnabled = CYIUtilities.parseBoolean(value, false);
+            }
+        });
+
+        Object.defineProperty(self, "abrRepresentationId", {
+            enumerable: true,
+            get() {
+                return _properties.abrRepresentationId;
+            },
+            set(value) {
+                let newValue = CYIUtilities.trimString(value);
+
+                if(CYIUtilities.isEmptyString(newValue)) {
+                    newValue = null;
+                }
+
+                _properties.abrRepresentationId = newValue;
+            }
+        });
+
+        Object.defineProperty(self, "abrStatsSnapshot", {
+            enumerable: true,
+            get() {
+                return _properties.abrStatsSnapshot;
+            },
+            set(value) {
+                _properties.abrStatsSnapshot = CYIUtilities.isObjectStrict(value) ? value : null;
+            }
+        });
+
+        Object.defineProperty(self, "playlistSelector", {
+            enumerable: true,
+            get() {
+                return _properties.playlistSelector;
+            },
+            set(value) {
+                _properties.playlistSelector = typeof value === "function" ? value : null;
+            }
+        });
+
+        Object.defineProperty(self, "playlistSelectorController", {
+            enumerable: true,
+            get() {
+                return _properties.playlistSelectorController;
+            },
+            set(value) {
+                _properties.playlistSelectorController = CYIUtilities.isObject(value) ? value : null;
+            }
+        });
+
         Object.defineProperty(self, "player", {
             enumerable: true,
             get() {
@@ -1040,6 +1158,122 @@ class CYIVideojsVideoPlayer {
             }
         });
 
+        Object.defineProperty(self, "instanceId", {
+            enumerable: true,
+            get() {
+                return _properties.instanceId;
+            },
+            set(value) {
+                _properties.instanceId = CYIUtilities.parseInteger(value, null);
+            }
+        });
+
+        Object.defineProperty(self, "compactEventVersion", {
+            enumerable: true,
+            get() {
+                return _properties.compactEventVersion;
+            },
+            set(value) {
+                _properties.compactEventVersion = CYIUtilities.parseInteger(value, null);
+            }
+        });
+
+        Object.defineProperty(self, "timeUpdateIntervalMs", {
+            enumerable: true,
+            get() {
+                return _properties.timeUpdateIntervalMs;
+            },
+            set(value) {
+                const newValue = CYIUtilities.parseInteger(value, 0);
+
+                _properties.timeUpdateIntervalMs = newValue < 0 ? 0 : newValue;
+            }
+        });
+
+        Object.defineProperty(self, "lastTimeUpdateSentMs", {
+            enumerable: true,
+            get() {
+                return _properties.lastTimeUpdateSentMs;
+            },
+            set(value) {
+                _properties.lastTimeUpdateSentMs = CYIUtilities.parseFloatingPointNumber(value, NaN);
+            }
+        });
+
+        Object.defineProperty(self, "maxBitrateKbps", {
+            enumerable: true,
+            get() {
+                return _properties.maxBitrateKbps;
+            },
+            set(value) {
+                _properties.maxBitrateKbps = CYIUtilities.parseFloatingPointNumber(value, NaN);
+            }
+        });
+
+        Object.defineProperty(self, "maxResolutionWidth", {
+            enumerable: true,
+            get() {
+                return _properties.maxResolutionWidth;
+            },
+            set(value) {
+                const newValue = CYIUtilities.parseInteger(value, 0);
+
+                _properties.maxResolutionWidth = newValue < 0 ? 0 : newValue;
+            }
+        });
+
+        Object.defineProperty(self, "maxResolutionHeight", {
+            enumerable: true,
+            get() {
+                return _properties.maxResolutionHeight;
+            },
+            set(value) {
+                const newValue = CYIUtilities.parseInteger(value, 0);
+
+                _properties.maxResolutionHeight = newValue < 0 ? 0 : newValue;
+            }
+        });
+
+        Object.defineProperty(self, "minimumBufferLengthMs", {
+            enumerable: true,
+            get() {
+                return _properties.minimumBufferLengthMs;
+            },
+            set(value) {
+                _properties.minimumBufferLengthMs = CYIUtilities.parseFloatingPointNumber(value, NaN);
+            }
+        });
+
+        Object.defineProperty(self, "maximumBufferLengthMs", {
+            enumerable: true,
+            get() {
+                return _properties.maximumBufferLengthMs;
+            },
+            set(value) {
+                _properties.maximumBufferLengthMs = CYIUtilities.parseFloatingPointNumber(value, NaN);
+            }
+        });
+
+        Object.defineProperty(self, "hidden", {
+            enumerable: true,
+            get() {
+                return _properties.hidden;
+            },
+            set(value) {
+                _properties.hidden = CYIUtilities.parseBoolean(value, false);
+            }
+        });
+
+        Object.defineProperty(self, "prepareId", {
+            enumerable: true,
+            get() {
+                return _properties.prepareId;
+            },
+            set(value) {
+                _properties.prepareId = CYIUtilities.parseInteger(value, null);
+            }
+        });
+
         Object.defineProperty(self, "externalTextTrackIdCounter", {
             enumerable: true,
             get() {
@@ -1076,6 +1310,24 @@ class CYIVideojsVideoPlayer {
         self.requestedTextTrackId = null;
         self.requestedSeekTimeSeconds = NaN;
         self.buffering = false;
+        self.prepareId = null;
+        self.instanceId = null;
+        self.compactEventVersion = null;
+        self.timeUpdateIntervalMs = 0;
+        self.lastTimeUpdateSentMs = NaN;
+        self.lastSeekableRangesKey = null;
+        self.maxBitrateKbps = NaN;
+        self.maxResolutionWidth = 0;
+        self.maxResolutionHeight = 0;
+        self.selectedRepresentationId = null;
+        self.externalABREnabled = false;
+        self.abrRepresentationId = null;
+        self.abrStatsSnapshot = null;
+        self.playlistSelector = null;
+        self.playlistSelectorController = null;
+        self.minimumBufferLengthMs = NaN;
+        self.maximumBufferLengthMs = NaN;
+        self.hidden = false;
 
         self.registerStreamFormat("DASH", ["PlayReady", "Widevine"]);
         self.registerStreamFormat("HLS", ["PlayReady", "Widevine"]);
@@ -1099,12 +1351,20 @@ class CYIVideojsVideoPlayer {
         }
     }
 
-    static createInstance(configuration) {
+    static createInstance(configuration, instanceId, eventEncoding) {
         return new Promise(function(resolve, reject) {
-            if(CYIUtilities.isValid(CYIVideojsVideoPlayer.instance)) {
-                throw CYIUtilities.createError("Cannot create more than one " + CYIVideojsVideoPlayer.getType() + " video player instance!");
+            let formattedInstanceId = CYIUtilities.parseInteger(instanceId);
+
+            if(isNaN(formattedInstanceId)) {
+                formattedInstanceId = CYIVideojsVideoPlayer.properties.nextInstanceId;
             }
 
+            if(CYIUtilities.isValid(CYIVideojsVideoPlayer.instances[formattedInstanceId])) {
+                throw CYIUtilities.createError("A " + CYIVideojsVideoPlayer.getType() + " video player instance with id " + formattedInstanceId + " already exists!");
+            }
+
+            CYIVideojsVideoPlayer.properties.nextInstanceId = formattedInstanceId + 1;
+
             return CYIVideojsVideoPlayer.loadDependencies(configuration, function(error) {
                 if(error) {
                     return reject(error);
@@ -1119,15 +1379,40 @@ class CYIVideojsVideoPlayer {
                     return reject(CYIUtilities.createError("Failed to create " + CYIVideojsVideoPlayer.name + " instance: " + error.message));
                 }
 
-                CYIVideojsVideoPlayer.instance = videoPlayer;
+                videoPlayer.instanceId = formattedInstanceId;
 
-                return resolve();
+                // only agree to the compact event encoding if the requested version matches the one this wrapper sends
+                if(CYIUtilities.isObjectStrict(eventEncoding) && CYIUtilities.parseInteger(eventEncoding.compactEventVersion) === CYIVideojsVideoPlayer.CompactEventVersion) {
+                    videoPlayer.compactEventVersion = CYIVideojsVideoPlayer.CompactEventVersion;
+                }
+
+                CYIVideojsVideoPlayer.instances[formattedInstanceId] = videoPlayer;
+
+                // the first instance created remains the default one returned when no instance id is specified
+                if(CYIUtilities.isInvalid(CYIVideojsVideoPlayer.instance)) {
+                    CYIVideojsVideoPlayer.instance = videoPlayer;
+                }
+
+                return resolve({
+                    instanceId: formattedInstanceId,
+                    compactEventVersion: videoPlayer.compactEventVersion
+                });
             });
         });
     }
 
-    static getInstance() {
-        return CYIVideojsVideoPlayer.instance;
+    static getInstance(instanceId) {
+        if(CYIUtilities.isInvalid(instanceId)) {
+            return CYIVideojsVideoPlayer.instance;
+        }
+
+        const instance = CYIVideojsVideoPlayer.instances[CYIUtilities.parseInteger(instanceId)];
+
+        if(CYIUtilities.isInvalid(instance)) {
+            throw CYIUtilities.createError("No " + CYIVideojsVideoPlayer.getType() + " video player instance exists with id: " + instanceId);
+        }
+
+        return instance;
     }
 
     static loadDependencies(options, callback) {
@@ -1246,6 +1531,20 @@ class CYIVideojsVideoPlayer {
         return videojs.VERSION;
     }
 
+    static getDevicePixelRatio() {
+        // the native side sizes the video rectangle in layout units, renditions are compared against device pixels
+        return typeof window !== "undefined" && window.devicePixelRatio > 0 ? window.devicePixelRatio : 1;
+    }
+
+    static getStreamingEngine() {
+        if(typeof videojs === "undefined") {
+            return null;
+        }
+
+        // Video.js 7 exposes its HTTP streaming engine as Vhs, older builds only provide the Hls alias
+        return CYIUtilities.isValid(videojs.Vhs) ? videojs.Vhs : (CYIUtilities.isValid(videojs.Hls) ? videojs.Hls : null);
+    }
+
     static getVersionData() {
         if(typeof videojs === "undefined") {
             return "Unknown";
@@ -1287,7 +1586,7 @@ class CYIVideojsVideoPlayer {
             }
 
             self.video = document.createElement("video");
-            self.video.id = "videojs_player";
+            self.video.id = "videojs_player" + (CYIUtilities.isValid(self.instanceId) ? "_" + self.instanceId : "");
 
             if(!CYIPlatformUtilities.isEmbedded) {
                 self.video.style.width = "100%";
@@ -1305,7 +1604,9 @@ class CYIVideojsVideoPlayer {
                     nativeAudioTracks: true,
                     nativeVideoTracks: false,
                     hls: { // applies to DASH as well
-                        overrideNative: true
+                        overrideNative: true,
+                        // rendition changes switch at the next segment instead of flushing the forward buffer
+                        smoothQualityChange: true
                     }
                 }
             });
@@ -1352,6 +1653,25 @@ class CYIVideojsVideoPlayer {
                 }
             });
 
+            self.player.on("seeked", function onSeekedEvent(event) {
+                self.notifySeekCompleted();
+            });
+
+            self.player.on("loadedmetadata", function onLoadedMetadataEvent(event) {
+                self.notifyRenditionsChanged();
+                self.applyRenditionLimits();
+                self.updateBitrate();
+
+                if(self.externalABREnabled) {
+                    self.installPlaylistSelector();
+                }
+            });
+
+            // triggered by the streaming engine on the tech and bubbled up to the player whenever it switches renditions
+            self.player.on("mediachange", function onMediaChangedEvent(event) {
+                self.updateBitrate();
+            });
+
             self.player.on("error", function onErrorEvent(event) {
                 self.stop();
 
@@ -1370,6 +1690,7 @@ class CYIVideojsVideoPlayer {
 
                 self.buffering = true;
 
+                self.notifyVideoTimeChanged();
                 self.notifyBufferingStateChanged(true);
             });
 
@@ -1405,6 +1726,15 @@ class CYIVideojsVideoPlayer {
 
             self.player.textTracks().on("change", function onTextTrackChangedEvent(event) {
                 self.notifyActiveTextTrackChanged();
+                self.notifyTextTrackStatusChanged();
+            });
+
+            self.player.on("volumechange", function onVolumeChangedEvent(event) {
+                if(!self.player || !self.initialized) {
+                    return;
+                }
+
+                self.notifyMuteStatusChanged();
             });
 
             self.player.textTracks().on("addtrack", function(event) {
@@ -1452,6 +1782,9 @@ class CYIVideojsVideoPlayer {
                     return;
                 }
 
+                // the native player does not interpolate while paused, so it needs the exact pause position immediately
+                self.notifyVideoTimeChanged();
+
                 self.updateState(CYIVideojsVideoPlayer.State.Paused);
             });
 
@@ -1464,6 +1797,16 @@ class CYIVideojsVideoPlayer {
                     return;
                 }
 
+                // the DVR window of a live stream slides as segments are added and removed
+                if(self.isLive()) {
+                    self.notifySeekableRangesChanged();
+                }
+
+                // the native player interpolates the playback time between updates, so routine updates can be throttled
+                if(self.timeUpdateIntervalMs > 0 && !isNaN(self.lastTimeUpdateSentMs) && performance.now() - self.lastTimeUpdateSentMs < self.timeUpdateIntervalMs) {
+                    return;
+                }
+
                 self.notifyVideoTimeChanged();
             });
 
@@ -1473,6 +1816,7 @@ class CYIVideojsVideoPlayer {
                 }
 
                 self.notifyVideoDurationChanged();
+                self.notifySeekableRangesChanged();
             });
 
             self.player.ready(function() {
@@ -1480,6 +1824,8 @@ class CYIVideojsVideoPlayer {
 
                 self.updateState(CYIVideojsVideoPlayer.State.Initialized);
 
+                self.notifyMuteStatusChanged();
+
                 if(self.verbose) {
                     console.log(self.getDisplayName() + " initialized successfully!");
                 }
@@ -1547,6 +1893,8 @@ class CYIVideojsVideoPlayer {
 
             self.nickname = formattedName;
         }
+
+        return self.nickname;
     }
 
     getPosition() {
@@ -1622,7 +1970,10 @@ class CYIVideojsVideoPlayer {
 
         self.state = state;
 
-        self.sendEvent("stateChanged", self.state.id);
+        self.sendEvent("stateChanged", {
+            id: self.state.id,
+            prepareId: self.prepareId
+        });
 
         if(self.verbose && self.verboseStateChanges) {
             console.log(self.getDisplayName() + " transitioned from " + previousState.displayName + " to " + state.displayName + ".");
@@ -1680,49 +2031,130 @@ class CYIVideojsVideoPlayer {
         self.requestedVideoRectangle = null;
     }
 
-    configureDRM(drmConfiguration) {
+    setHidden(hidden) {
         const self = this;
 
-        self.checkInitialized();
+        self.hidden = hidden;
 
-        const videojsPlugins = videojs.getPlugins();
+        if(CYIUtilities.isInvalid(self.container) || CYIPlatformUtilities.isEmbedded || !self.loaded) {
+            return;
+        }
 
-        if(CYIUtilities.isInvalid(videojsPlugins.eme)) {
-            throw CYIUtilities.createError(CYIVideojsVideoPlayer.getType() + " is missing encrypted media extensions plugin!");
+        self.container.style.visibility = self.hidden ? "hidden" : "visible";
+
+        if(self.verbose) {
+            console.log(self.getDisplayName() + (self.hidden ? " hidden." : " shown."));
         }
+    }
 
-        if(!self.isPaused()) {
-            throw CYIUtilities.createError(self.getDisplayName() + " cannot configure DRM after playback has been initiated.");
+    setTimeUpdateInterval(intervalMs) {
+        const self = this;
+
+        self.timeUpdateIntervalMs = intervalMs;
+
+        if(self.verbose) {
+            console.log(self.getDisplayName() + " time update interval set to " + self.timeUpdateIntervalMs + "ms.");
         }
+    }
 
-        var emeOptions = { };
+    setBufferLength(minimumBufferLengthMs, maximumBufferLengthMs) {
+        const self = this;
 
-        if(CYIUtilities.isValid(drmConfiguration)) {
-            if(!CYIUtilities.isObjectStrict(drmConfiguration)) {
-                throw CYIUtilities.createError(self.getDisplayName() + " requires a valid DRM configuration object.");
-            }
+        self.minimumBufferLengthMs = minimumBufferLengthMs;
+        self.maximumBufferLengthMs = maximumBufferLengthMs;
 
-            if(CYIUtilities.isNonEmptyObject(drmConfiguration)) {
-                // initialize videojs-contrib-eme plugin
-                self.player.eme();
+        self.applyBufferLength();
+    }
 
-                emeOptions.keySystems = { };
+    applyBufferLength() {
+        const self = this;
 
-                if(CYIUtilities.isNonEmptyString(drmConfiguration.url)) {
-                    if(CYIUtilities.isNonEmptyString(drmConfiguration.type)) {
-                        var formattedDrmType = drmConfiguration.type.trim().toLowerCase();
-                        var drmKey = CYIVideojsVideoPlayer.DRMKeys[formattedDrmType];
+        const vhs = CYIVideojsVideoPlayer.getStreamingEngine();
 
-                        if(CYIUtilities.isNonEmptyString(drmKey)) {
-                            var keySystemConfiguration = {
-                                url: drmConfiguration.url
-                            };
+        if(CYIUtilities.isInvalid(vhs)) {
+            return console.warn(self.getDisplayName() + " cannot set buffer goals, the Video.js streaming engine is not available.");
+        }
 
-                            if(CYIUtilities.isNonEmptyObject(drmConfiguration.headers)) {
-                                keySystemConfiguration.licenseHeaders = drmConfiguration.headers;
-                            }
+        if(CYIUtilities.isInvalid(CYIVideojsVideoPlayer.defaultBufferGoals)) {
+            CYIVideojsVideoPlayer.defaultBufferGoals = {
+                goalBufferLength: vhs.GOAL_BUFFER_LENGTH,
+                maxGoalBufferLength: vhs.MAX_GOAL_BUFFER_LENGTH
+            };
+        }
 
-                            emeOptions.keySystems[drmKey] = keySystemConfiguration;
+        // the streaming engine configuration is shared by every player, so each player re-applies its own goals when it prepares
+        const defaultBufferGoals = CYIVideojsVideoPlayer.defaultBufferGoals;
+        const goalBufferLength = self.minimumBufferLengthMs >= 0 ? self.minimumBufferLengthMs / 1000 : defaultBufferGoals.goalBufferLength;
+        const maxGoalBufferLength = self.maximumBufferLengthMs >= 0 ? self.maximumBufferLengthMs / 1000 : defaultBufferGoals.maxGoalBufferLength;
+
+        vhs.GOAL_BUFFER_LENGTH = goalBufferLength;
+        vhs.MAX_GOAL_BUFFER_LENGTH = Math.max(goalBufferLength, maxGoalBufferLength);
+
+        if(self.verbose) {
+            console.log(self.getDisplayName() + " buffer goals set to " + vhs.GOAL_BUFFER_LENGTH + "s minimum and " + vhs.MAX_GOAL_BUFFER_LENGTH + "s maximum.");
+        }
+
+        self.notifyBufferLengthChanged();
+    }
+
+    getBufferLength() {
+        const self = this;
+
+        const vhs = CYIVideojsVideoPlayer.getStreamingEngine();
+
+        if(CYIUtilities.isInvalid(vhs)) {
+            return null;
+        }
+
+        return {
+            minimumBufferLengthMs: Math.floor(vhs.GOAL_BUFFER_LENGTH * 1000),
+            maximumBufferLengthMs: Math.floor(vhs.MAX_GOAL_BUFFER_LENGTH * 1000)
+        };
+    }
+
+    configureDRM(drmConfiguration) {
+        const self = this;
+
+        self.checkInitialized();
+
+        const videojsPlugins = videojs.getPlugins();
+
+        if(CYIUtilities.isInvalid(videojsPlugins.eme)) {
+            throw CYIUtilities.createError(CYIVideojsVideoPlayer.getType() + " is missing encrypted media extensions plugin!");
+        }
+
+        if(!self.isPaused()) {
+            throw CYIUtilities.createError(self.getDisplayName() + " cannot configure DRM after playback has been initiated.");
+        }
+
+        var emeOptions = { };
+
+        if(CYIUtilities.isValid(drmConfiguration)) {
+            if(!CYIUtilities.isObjectStrict(drmConfiguration)) {
+                throw CYIUtilities.createError(self.getDisplayName() + " requires a valid DRM configuration object.");
+            }
+
+            if(CYIUtilities.isNonEmptyObject(drmConfiguration)) {
+                // initialize videojs-contrib-eme plugin
+                self.player.eme();
+
+                emeOptions.keySystems = { };
+
+                if(CYIUtilities.isNonEmptyString(drmConfiguration.url)) {
+                    if(CYIUtilities.isNonEmptyString(drmConfiguration.type)) {
+                        var formattedDrmType = drmConfiguration.type.trim().toLowerCase();
+                        var drmKey = CYIVideojsVideoPlayer.DRMKeys[formattedDrmType];
+
+                        if(CYIUtilities.isNonEmptyString(drmKey)) {
+                            var keySystemConfiguration = {
+                                url: drmConfiguration.url
+                            };
+
+                            if(CYIUtilities.isNonEmptyObject(drmConfiguration.headers)) {
+                                keySystemConfiguration.licenseHeaders = drmConfiguration.headers;
+                            }
+
+                            emeOptions.keySystems[drmKey] = keySystemConfiguration;
                         }
                         else {
                             throw CYIUtilities.createError(self.getDisplayName() + " tried to configure the player with an unsupported DRM type: " + drmConfiguration.type);
@@ -1767,6 +2199,15 @@ class CYIVideojsVideoPlayer {
             startTimeSeconds = data.startTimeSeconds;
             maxBitrateKbps = data.maxBitrateKbps;
             drmConfiguration = data.drmConfiguration;
+            self.prepareId = data.prepareId;
+
+            if(CYIUtilities.isObjectStrict(data.bufferLength)) {
+                self.minimumBufferLengthMs = data.bufferLength.minimumBufferLengthMs;
+                self.maximumBufferLengthMs = data.bufferLength.maximumBufferLengthMs;
+            }
+        }
+        else {
+            self.prepareId = null;
         }
 
         if(!self.isStreamFormatSupported(format, CYIUtilities.isObjectStrict(drmConfiguration) ? drmConfiguration.type : null)) {
@@ -1794,16 +2235,21 @@ class CYIVideojsVideoPlayer {
             throw CYIUtilities.createError(self.getDisplayName() + " requires a non-empty url string to load when preparing.");
         }
 
-        if(CYIUtilities.isValid(maxBitrateKbps)) {
-            if(self.verbose) {
-                console.warn(self.getDisplayName() + " does not support setting a maximum bitrate.");
-            }
-        }
+        // the caps are applied once the streaming engine has loaded the rendition list, a pinned rendition belongs to the previous source
+        self.maxBitrateKbps = maxBitrateKbps;
+        self.selectedRepresentationId = null;
+        self.renditionRepresentationIds.length = 0;
+        self.abrRepresentationId = null;
+        self.abrStatsSnapshot = null;
+        self.playlistSelector = null;
+        self.playlistSelectorController = null;
 
         self.configureDRM(drmConfiguration);
 
+        self.applyBufferLength();
+
         if(!CYIPlatformUtilities.isEmbedded) {
-            self.container.style.visibility = "visible";
+            self.container.style.visibility = self.hidden ? "hidden" : "visible";
         }
 
         const sourceConfiguration = {
@@ -1923,182 +2369,577 @@ class CYIVideojsVideoPlayer {
 
         self.loaded = false;
         self.buffering = false;
+        self.prepareId = null;
         self.shouldResumePlayback = null;
         self.requestedTextTrackId = null;
         self.requestedSeekTimeSeconds = NaN;
+        self.lastSeekableRangesKey = null;
+        self.initialAudioBitrateKbps = null;
+        self.currentAudioBitrateKbps = null;
+        self.initialVideoBitrateKbps = null;
+        self.currentVideoBitrateKbps = null;
+        self.initialTotalBitrateKbps = null;
+        self.currentTotalBitrateKbps = null;
+        self.selectedRepresentationId = null;
+        self.renditionRepresentationIds.length = 0;
+        self.abrRepresentationId = null;
+        self.abrStatsSnapshot = null;
+        self.playlistSelector = null;
+        self.playlistSelectorController = null;
         self.externalTextTrackQueue.length = 0;
 
-        self.resetExternalTextTrackIdCounter();
+        self.resetExternalTextTrackIdCounter();
+
+        if(self.state !== CYIVideojsVideoPlayer.State.Initialized) {
+            self.updateState(CYIVideojsVideoPlayer.State.Initialized);
+        }
+
+        if(self.verbose) {
+            console.log(self.getDisplayName() + " stopped.");
+        }
+    }
+
+    suspend() {
+        const self = this;
+
+        if(!self.initialized || !self.loaded) {
+            return;
+        }
+
+        if(!self.isPaused()) {
+            self.shouldResumePlayback = true;
+
+            self.pause();
+        }
+
+        if(self.verbose) {
+            console.log(self.getDisplayName() + " suspended" + (self.shouldResumePlayback ? ", will resume playback on restore" : "") + ".");
+        }
+    }
+
+    restore() {
+        const self = this;
+
+        if(!self.initialized || !self.loaded) {
+            return;
+        }
+
+        if(self.shouldResumePlayback) {
+            if(self.isPaused()) {
+                if(self.verbose) {
+                    console.log(self.getDisplayName() + " resuming playback after restore.");
+                }
+
+                self.play();
+            }
+
+            self.shouldResumePlayback = false;
+        }
+
+        if(self.verbose) {
+            console.log(self.getDisplayName() + " restored.");
+        }
+    }
+
+    destroy() {
+        const self = this;
+
+        if(!self.player) {
+            return;
+        }
+
+        self.stop();
+        self.state = CYIVideojsVideoPlayer.State.Uninitialized;
+
+        self.player.dispose();
+
+        self.player = null;
+        self.initialized = false;
+        self.video = null;
+        self.container = null;
+
+        if(CYIUtilities.isValid(self.instanceId)) {
+            delete CYIVideojsVideoPlayer.instances[self.instanceId];
+        }
+
+        if(CYIVideojsVideoPlayer.instance === self) {
+            const remainingInstanceIds = Object.keys(CYIVideojsVideoPlayer.instances);
+
+            CYIVideojsVideoPlayer.instance = remainingInstanceIds.length === 0 ? null : CYIVideojsVideoPlayer.instances[remainingInstanceIds[0]];
+        }
+
+        if(self.verbose) {
+            console.log(self.getDisplayName() + " disposed.");
+        }
+    }
+
+    getCurrentTime() {
+        const self = this;
+
+        self.checkInitialized();
+
+        return self.player.currentTime();
+    }
+
+    getDuration() {
+        const self = this;
+
+        self.checkInitialized();
+
+        if(CYIUtilities.isInvalidNumber(self.player.duration())) {
+            return -1;
+        }
+
+        return self.player.duration();
+    }
+
+    seek(timeSeconds) {
+        const self = this;
+
+        self.checkInitialized();
+
+        if(CYIUtilities.isInvalidNumber(timeSeconds)) {
+            return;
+        }
+
+        if(isNaN(self.player.duration())) {
+            if(self.verbose) {
+                console.log(self.getDisplayName() + " tried to seek before player is ready, delaying seek.");
+            }
+
+            self.requestedSeekTimeSeconds = timeSeconds;
+
+            return;
+        }
+
+        self.player.currentTime(CYIUtilities.clamp(timeSeconds, 0, self.player.duration()));
+
+        if(self.verbose) {
+            console.log(self.getDisplayName() + " seeked to " + timeSeconds + "s.");
+        }
+
+        self.notifyVideoTimeChanged();
+    }
+
+    isMuted() {
+        const self = this;
+
+        self.checkInitialized();
+
+        return self.player.muted();
+    }
+
+    mute() {
+        const self = this;
+
+        self.checkInitialized();
+
+        if(self.player.muted()) {
+            return true;
+        }
+
+        self.player.muted(true);
+
+        if(self.verbose) {
+            console.log(self.getDisplayName() + " muted.");
+        }
+
+        return self.player.muted();
+    }
+
+    unmute() {
+        const self = this;
+
+        self.checkInitialized();
+
+        if(!self.player.muted()) {
+            return false;
+        }
+
+        self.player.muted(false);
+
+        if(self.verbose) {
+            console.log(self.getDisplayName() + " unmuted.");
+        }
+
+        return self.player.muted();
+    }
+
+    setMaxBitrate(maxBitrateKbps) {
+        const self = this;
+
+        self.checkInitialized();
+
+        self.maxBitrateKbps = maxBitrateKbps;
+
+        if(self.loaded) {
+            self.applyRenditionLimits();
+        }
+    }
+
+    setMaxResolution(width, height) {
+        const self = this;
+
+        self.checkInitialized();
+
+        self.maxResolutionWidth = width;
+        self.maxResolutionHeight = height;
+
+        if(self.loaded) {
+            self.applyRenditionLimits();
+        }
+    }
+
+    getStreamingHandler() {
+        const self = this;
+
+        if(!self.player) {
+            return null;
+        }
+
+        const tech = self.player.tech(true);
+
+        if(CYIUtilities.isInvalid(tech)) {
+            return null;
+        }
+
+        return CYIUtilities.isValid(tech.vhs) ? tech.vhs : (CYIUtilities.isValid(tech.hls) ? tech.hls : null);
+    }
+
+    getRenditions() {
+        const self = this;
+
+        const vhs = self.getStreamingHandler();
+
+        self.renditionRepresentationIds.length = 0;
+
+        if(CYIUtilities.isInvalid(vhs) || typeof vhs.representations !== "function") {
+            return [];
+        }
+
+        const sortedRepresentations = vhs.representations().slice().sort(function(a, b) {
+            return a.bandwidth - b.bandwidth;
+        });
+
+        // renditions are identified by their position in the ladder, the streaming engine ids are playlist uris
+        return sortedRepresentations.map(function(representation, index) {
+            const attributes = CYIUtilities.isValid(representation.playlist) && CYIUtilities.isValid(representation.playlist.attributes) ? representation.playlist.attributes : { };
+            let codecs = representation.codecs;
+            let frameRate = attributes["FRAME-RATE"];
+
+            if(CYIUtilities.isObjectStrict(codecs)) {
+                codecs = Object.keys(codecs).map(function(type) {
+                    return codecs[type];
+                }).join(",");
+            }
+
+            if(!CYIUtilities.isNonEmptyString(codecs)) {
+                codecs = CYIUtilities.isNonEmptyString(attributes.CODECS) ? attributes.CODECS : "";
+            }
+
+            // DASH frame rates may be declared as a fraction, such as 30000/1001
+            if(typeof frameRate === "string" && frameRate.indexOf("/") !== -1) {
+                const frameRateParts = frameRate.split("/");
+                frameRate = parseFloat(frameRateParts[0]) / parseFloat(frameRateParts[1]);
+            }
+
+            frameRate = parseFloat(frameRate);
+
+            self.renditionRepresentationIds.push(representation.id);
+
+            return {
+                id: index,
+                bitrateKbps: Math.floor(representation.bandwidth / CYIVideojsVideoPlayer.BitrateKbpsScale),
+                width: Number.isInteger(representation.width) ? representation.width : 0,
+                height: Number.isInteger(representation.height) ? representation.height : 0,
+                frameRate: isFinite(frameRate) ? frameRate : 0,
+                codecs: codecs
+            };
+        });
+    }
+
+    selectRendition(id) {
+        const self = this;
+
+        self.checkInitialized();
+
+        const formattedId = CYIUtilities.parseInteger(id);
+        const representationId = Number.isInteger(formattedId) ? self.renditionRepresentationIds[formattedId] : undefined;
+
+        if(CYIUtilities.isInvalid(representationId)) {
+            throw CYIUtilities.createError(self.getDisplayName() + " cannot select rendition " + id + ", the current ladder has " + self.renditionRepresentationIds.length + " rendition(s).");
+        }
+
+        self.selectedRepresentationId = representationId;
+
+        self.applyRenditionLimits();
+    }
+
+    selectAutomaticRendition() {
+        const self = this;
+
+        self.checkInitialized();
+
+        self.selectedRepresentationId = null;
+
+        self.applyRenditionLimits();
+    }
+
+    setExternalABREnabled(enabled) {
+        const self = this;
+
+        self.checkInitialized();
 
-        if(self.state !== CYIVideojsVideoPlayer.State.Initialized) {
-            self.updateState(CYIVideojsVideoPlayer.State.Initialized);
-        }
+        self.externalABREnabled = enabled;
+        self.abrRepresentationId = null;
 
-        if(self.verbose) {
-            console.log(self.getDisplayName() + " stopped.");
+        if(self.externalABREnabled && self.loaded) {
+            self.installPlaylistSelector();
         }
     }
 
-    suspend() {
+    setABRRendition(id) {
         const self = this;
 
-        if(!self.initialized || !self.loaded) {
-            return;
+        self.checkInitialized();
+
+        const formattedId = CYIUtilities.parseInteger(id);
+        const representationId = Number.isInteger(formattedId) ? self.renditionRepresentationIds[formattedId] : undefined;
+
+        if(CYIUtilities.isInvalid(representationId)) {
+            throw CYIUtilities.createError(self.getDisplayName() + " cannot fetch rendition " + id + ", the current ladder has " + self.renditionRepresentationIds.length + " rendition(s).");
         }
 
-        if(!self.isPaused()) {
-            self.shouldResumePlayback = true;
+        self.abrRepresentationId = representationId;
 
-            self.pause();
+        // the streaming engine only switches up once its forward buffer has passed a low water line, which would veto the
+        // controller, so the playlist loader is switched directly and the playlist selector keeps the engine on it
+        const vhs = self.getStreamingHandler();
+        const masterPlaylistController = CYIUtilities.isValid(vhs) ? vhs.masterPlaylistController_ : null;
+
+        if(!self.externalABREnabled || CYIUtilities.isInvalid(masterPlaylistController) || CYIUtilities.isInvalid(masterPlaylistController.masterPlaylistLoader_)) {
+            return;
         }
 
-        if(self.verbose) {
-            console.log(self.getDisplayName() + " suspended" + (self.shouldResumePlayback ? ", will resume playback on restore" : "") + ".");
+        const abrRepresentation = self.findABRRepresentation(vhs);
+
+        if(CYIUtilities.isValid(abrRepresentation) && masterPlaylistController.masterPlaylistLoader_.media() !== abrRepresentation.playlist) {
+            masterPlaylistController.masterPlaylistLoader_.media(abrRepresentation.playlist);
         }
     }
 
-    restore() {
+    findABRRepresentation(vhs) {
         const self = this;
 
-        if(!self.initialized || !self.loaded) {
-            return;
+        if(CYIUtilities.isInvalid(self.abrRepresentationId) || CYIUtilities.isInvalid(vhs) || typeof vhs.representations !== "function") {
+            return undefined;
         }
 
-        if(self.shouldResumePlayback) {
-            if(self.isPaused()) {
-                if(self.verbose) {
-                    console.log(self.getDisplayName() + " resuming playback after restore.");
-                }
+        // renditions excluded by the caps, a pinned rendition or a playlist error are disabled, so the default selection applies instead
+        return vhs.representations().find(function(representation) {
+            return representation.id === self.abrRepresentationId && representation.enabled();
+        });
+    }
 
-                self.play();
+    installPlaylistSelector() {
+        const self = this;
+
+        const vhs = self.getStreamingHandler();
+        const masterPlaylistController = CYIUtilities.isValid(vhs) ? vhs.masterPlaylistController_ : null;
+
+        if(CYIUtilities.isInvalid(masterPlaylistController) || typeof masterPlaylistController.selectPlaylist !== "function") {
+            if(self.verbose) {
+                console.warn(self.getDisplayName() + " cannot hand rendition selection over, the current source is not adaptive.");
             }
 
-            self.shouldResumePlayback = false;
+            return;
         }
 
-        if(self.verbose) {
-            console.log(self.getDisplayName() + " restored.");
+        // the handler's selectPlaylist setter binds whatever it is given, so comparing selectors cannot tell whether this
+        // controller was already wrapped, the controller itself is remembered instead
+        if(self.playlistSelectorController === masterPlaylistController) {
+            return;
         }
-    }
 
-    destroy() {
-        const self = this;
+        // the streaming engine binds its selector when the source is set, so the bound default is wrapped rather than the handler option
+        const defaultPlaylistSelector = masterPlaylistController.selectPlaylist;
 
-        if(!self.player) {
-            return;
-        }
+        self.abrStatsSnapshot = self.getStreamingStats(vhs);
 
-        self.stop();
-        self.state = CYIVideojsVideoPlayer.State.Uninitialized;
+        self.playlistSelector = function selectPlaylist() {
+            const defaultPlaylist = defaultPlaylistSelector();
 
-        self.player.dispose();
+            if(!self.externalABREnabled) {
+                return defaultPlaylist;
+            }
 
-        self.player = null;
-        self.initialized = false;
-        self.video = null;
-        self.container = null;
+            self.notifySegmentDownloaded(vhs);
 
-        CYIVideojsVideoPlayer.instance = null;
+            const abrRepresentation = self.findABRRepresentation(vhs);
 
-        if(self.verbose) {
-            console.log(self.getDisplayName() + " disposed.");
-        }
-    }
+            return CYIUtilities.isValid(abrRepresentation) ? abrRepresentation.playlist : defaultPlaylist;
+        };
 
-    getCurrentTime() {
-        const self = this;
+        // only the controller is assigned, going through the handler's setter as well would wrap a bound copy of the selector
+        masterPlaylistController.selectPlaylist = self.playlistSelector;
+        self.playlistSelectorController = masterPlaylistController;
+    }
 
-        self.checkInitialized();
+    getStreamingStats(vhs) {
+        if(CYIUtilities.isInvalid(vhs) || CYIUtilities.isInvalid(vhs.stats)) {
+            return null;
+        }
 
-        return self.player.currentTime();
+        return {
+            bytes: vhs.stats.mediaBytesTransferred,
+            downloadTimeMs: vhs.stats.mediaTransferDuration,
+            requests: vhs.stats.mediaRequests,
+            mediaSeconds: vhs.stats.mediaSecondsLoaded
+        };
     }
 
-    getDuration() {
+    getForwardBufferLengthMs() {
         const self = this;
 
-        self.checkInitialized();
+        const bufferedTimeRanges = self.video.buffered;
 
-        if(CYIUtilities.isInvalidNumber(self.player.duration())) {
-            return -1;
+        for(let i = 0; i < bufferedTimeRanges.length; i++) {
+            if(self.video.currentTime >= bufferedTimeRanges.start(i) && self.video.currentTime <= bufferedTimeRanges.end(i)) {
+                return Math.floor((bufferedTimeRanges.end(i) - self.video.currentTime) * 1000);
+            }
         }
 
-        return self.player.duration();
+        return 0;
     }
 
-    seek(timeSeconds) {
+    applyRenditionLimits() {
         const self = this;
 
-        self.checkInitialized();
+        const vhs = self.getStreamingHandler();
+
+        if(CYIUtilities.isInvalid(vhs) || typeof vhs.representations !== "function") {
+            if(self.verbose && (self.maxBitrateKbps > 0 || self.maxResolutionWidth > 0 || self.maxResolutionHeight > 0)) {
+                console.warn(self.getDisplayName() + " cannot limit renditions, the current source is not adaptive.");
+            }
 
-        if(CYIUtilities.isInvalidNumber(timeSeconds)) {
             return;
         }
 
-        if(isNaN(self.player.duration())) {
-            if(self.verbose) {
-                console.log(self.getDisplayName() + " tried to seek before player is ready, delaying seek.");
+        const representations = vhs.representations();
+
+        if(representations.length === 0) {
+            return;
+        }
+
+        const maxBandwidth = self.maxBitrateKbps > 0 ? self.maxBitrateKbps * CYIVideojsVideoPlayer.BitrateKbpsScale : Infinity;
+        const maxWidth = self.maxResolutionWidth > 0 ? self.maxResolutionWidth : Infinity;
+        const maxHeight = self.maxResolutionHeight > 0 ? self.maxResolutionHeight : Infinity;
+
+        const selectedRepresentation = CYIUtilities.isValid(self.selectedRepresentationId) ? representations.find(function(representation) {
+            return representation.id === self.selectedRepresentationId;
+        }) : undefined;
+
+        // a pinned rendition overrides the caps, renditions without a declared resolution, such as audio only ones, are only limited by bandwidth
+        const isAllowed = function(representation) {
+            if(CYIUtilities.isValid(selectedRepresentation)) {
+                return representation === selectedRepresentation;
             }
 
-            self.requestedSeekTimeSeconds = timeSeconds;
+            return representation.bandwidth <= maxBandwidth && !(representation.width > maxWidth) && !(representation.height > maxHeight);
+        };
 
-            return;
+        const sortedRepresentations = representations.slice().sort(function(a, b) {
+            return b.bandwidth - a.bandwidth;
+        });
+
+        // the lowest rendition stays enabled when the caps exclude every rendition so that playback continues
+        const lowestRepresentation = sortedRepresentations.some(isAllowed) ? null : sortedRepresentations[sortedRepresentations.length - 1];
+
+        // every toggle re-runs rendition selection, so renditions are enabled first and then disabled from the top down to avoid switching up on the way
+        for(let i = sortedRepresentations.length - 1; i >= 0; i--) {
+            const representation = sortedRepresentations[i];
+
+            if((isAllowed(representation) || representation === lowestRepresentation) && !representation.enabled()) {
+                representation.enabled(true);
+            }
         }
 
-        self.player.currentTime(CYIUtilities.clamp(timeSeconds, 0, self.player.duration()));
+        for(let i = 0; i < sortedRepresentations.length; i++) {
+            const representation = sortedRepresentations[i];
 
-        if(self.verbose) {
-            console.log(self.getDisplayName() + " seeked to " + timeSeconds + "s.");
+            if(!isAllowed(representation) && representation !== lowestRepresentation && representation.enabled()) {
+                representation.enabled(false);
+            }
         }
 
-        self.notifyVideoTimeChanged();
+        if(self.verbose && CYIUtilities.isValid(selectedRepresentation)) {
+            console.log(self.getDisplayName() + " pinned rendition " + selectedRepresentation.id + " at " + selectedRepresentation.bandwidth + "bps.");
+        }
+        else if(self.verbose) {
+            console.log(self.getDisplayName() + " limited renditions to " + (isFinite(maxBandwidth) ? self.maxBitrateKbps + "kbps" : "any bitrate") + " at " + (isFinite(maxWidth) ? maxWidth : "any") + "x" + (isFinite(maxHeight) ? maxHeight : "any") + ".");
+        }
     }
 
-    isMuted() {
+    updateBitrate() {
         const self = this;
 
-        self.checkInitialized();
-
-        return self.player.muted();
-    }
+        const vhs = self.getStreamingHandler();
 
-    mute() {
-        const self = this;
+        if(CYIUtilities.isInvalid(vhs) || CYIUtilities.isInvalid(vhs.playlists) || typeof vhs.playlists.media !== "function") {
+            return;
+        }
 
-        self.checkInitialized();
+        const media = vhs.playlists.media();
 
-        if(self.player.muted()) {
+        if(CYIUtilities.isInvalid(media) || CYIUtilities.isInvalid(media.attributes) || CYIUtilities.isInvalidNumber(media.attributes.BANDWIDTH)) {
             return;
         }
 
-        self.player.muted(true);
+        // the rendition bandwidth covers the muxed stream, so it is reported as both the video and the total bitrate
+        const bitrateKbps = Math.floor(media.attributes.BANDWIDTH / CYIVideojsVideoPlayer.BitrateKbpsScale);
 
-        if(self.verbose) {
-            console.log(self.getDisplayName() + " muted.");
+        if(bitrateKbps === self.currentVideoBitrateKbps) {
+            return;
+        }
+
+        if(CYIUtilities.isInvalidNumber(self.initialVideoBitrateKbps)) {
+            self.initialVideoBitrateKbps = bitrateKbps;
+            self.initialTotalBitrateKbps = bitrateKbps;
         }
+
+        self.currentVideoBitrateKbps = bitrateKbps;
+        self.currentTotalBitrateKbps = bitrateKbps;
+
+        self.notifyBitrateChanged();
     }
 
-    unmute() {
+    getSeekableRanges() {
         const self = this;
 
         self.checkInitialized();
 
-        if(!self.player.muted()) {
-            return;
-        }
-
-        self.player.muted(false);
+        const seekableTimeRanges = self.player.seekable();
+        const seekableRanges = [];
 
-        if(self.verbose) {
-            console.log(self.getDisplayName() + " unmuted.");
+        if(!seekableTimeRanges) {
+            return seekableRanges;
         }
-    }
 
-    setMaxBitrate(maxBitrateKbps) {
-        const self = this;
+        for(let i = 0; i < seekableTimeRanges.length; i++) {
+            const startTimeSeconds = seekableTimeRanges.start(i);
+            const endTimeSeconds = seekableTimeRanges.end(i);
 
-        if(self.verbose) {
-            console.warn(self.getDisplayName() + " does not support setting a maximum bitrate.");
+            if(CYIUtilities.isInvalidNumber(startTimeSeconds) || CYIUtilities.isInvalidNumber(endTimeSeconds) || !isFinite(endTimeSeconds)) {
+                continue;
+            }
+
+            seekableRanges.push({
+                startTimeMs: Math.floor(startTimeSeconds * 1000),
+                endTimeMs: Math.floor(endTimeSeconds * 1000)
+            });
         }
+
+        return seekableRanges;
     }
 
     isLive() {
@@ -2274,7 +3115,7 @@ class CYIVideojsVideoPlayer {
                 console.log(self.getDisplayName() + " has no text tracks.");
             }
 
-            return;
+            return self.getActiveTextTrack();
         }
 
         // check if any text tracks are already visible
@@ -2283,7 +3124,7 @@ class CYIVideojsVideoPlayer {
                 console.log(self.getDisplayName() + " already has a text track enabled.");
             }
 
-            return;
+            return self.getActiveTextTrack();
         }
 
         let textTrack = null;
@@ -2305,7 +3146,7 @@ class CYIVideojsVideoPlayer {
                         console.log(self.getDisplayName() + " enabled text track #" + i + " with id: " + self.requestedTextTrackId + ".");
                     }
 
-                    return;
+                    return self.getActiveTextTrack();
                 }
             }
         }
@@ -2332,12 +3173,16 @@ class CYIVideojsVideoPlayer {
 
             break;
         }
+
+        return self.getActiveTextTrack();
     }
 
     disableTextTrack() {
         const self = this;
 
-        return self.disableActiveTextTracks();
+        self.disableActiveTextTracks();
+
+        return self.getActiveTextTrack();
     }
 
     disableActiveTextTracks() {
@@ -2646,6 +3491,52 @@ class CYIVideojsVideoPlayer {
         self.externalTextTrackQueue.length = 0;
     }
 
+    executeBatch(commands) {
+        const self = this;
+
+        if(typeof commands === "string") {
+            try {
+                commands = JSON.parse(commands);
+            }
+            catch(error) {
+                throw CYIUtilities.createError(self.getDisplayName() + " received an invalid command batch: " + error.message);
+            }
+        }
+
+        if(!Array.isArray(commands)) {
+            throw CYIUtilities.createError(self.getDisplayName() + " received an invalid command batch, expected an array!");
+        }
+
+        const results = [];
+
+        for(let i = 0; i < commands.length; i++) {
+            const command = commands[i];
+
+            try {
+                if(!CYIUtilities.isObject(command) || command.name === "executeBatch" || !CYIUtilities.isFunction(self[command.name])) {
+                    throw CYIUtilities.createError(self.getDisplayName() + " received an invalid batched command" + (CYIUtilities.isObject(command) ? ": " + command.name : "!"));
+                }
+
+                results.push({
+                    result: self[command.name].apply(self, Array.isArray(command.args) ? command.args : [])
+                });
+            }
+            catch(error) {
+                results.push({
+                    error: {
+                        message: CYIVideojsVideoPlayer.formatError(error).message
+                    }
+                });
+            }
+        }
+
+        if(self.verbose) {
+            console.log(self.getDisplayName() + " executed batch of " + commands.length + " command" + (commands.length === 1 ? "" : "s") + ".");
+        }
+
+        return results;
+    }
+
     numberOfStreamFormats() {
         const self = this;
 
@@ -2824,6 +3715,20 @@ class CYIVideojsVideoPlayer {
         return true;
     }
 
+    getStreamFormatSupportMatrix(streamFormats, drmTypes) {
+        const self = this;
+
+        if(!Array.isArray(streamFormats) || !Array.isArray(drmTypes)) {
+            throw CYIUtilities.createError(self.getDisplayName() + " requires stream format and DRM type arrays to build a support matrix!");
+        }
+
+        return streamFormats.map(function(streamFormat) {
+            return drmTypes.map(function(drmType) {
+                return self.isStreamFormatSupported(streamFormat, drmType);
+            });
+        });
+    }
+
     clearStreamFormats() {
         const self = this;
 
@@ -2836,6 +3741,81 @@ class CYIVideojsVideoPlayer {
         self.checkInitialized();
 
         self.sendEvent("liveStatus", self.isLive());
+
+        self.notifySeekableRangesChanged(true);
+    }
+
+    notifySeekableRangesChanged(force) {
+        const self = this;
+
+        self.checkInitialized();
+
+        const seekableRanges = self.getSeekableRanges();
+        const seekableRangesKey = JSON.stringify(seekableRanges);
+
+        if(!force && seekableRangesKey === self.lastSeekableRangesKey) {
+            return;
+        }
+
+        self.lastSeekableRangesKey = seekableRangesKey;
+
+        self.sendEvent("seekableRangesChanged", seekableRanges);
+    }
+
+    notifyRenditionsChanged() {
+        const self = this;
+
+        self.checkInitialized();
+
+        self.sendEvent("renditionsChanged", self.getRenditions());
+    }
+
+    notifySegmentDownloaded(vhs) {
+        const self = this;
+
+        self.checkInitialized();
+
+        const stats = self.getStreamingStats(vhs);
+        const previousStats = self.abrStatsSnapshot;
+
+        self.abrStatsSnapshot = stats;
+
+        // the selector also runs when playlists load or are excluded, only completed segment requests advance the counters
+        if(CYIUtilities.isInvalid(stats) || CYIUtilities.isInvalid(previousStats) || stats.requests <= previousStats.requests) {
+            return;
+        }
+
+        const media = vhs.playlists.media();
+        const currentRepresentation = vhs.representations().find(function(representation) {
+            return representation.playlist === media;
+        });
+        const renditionId = CYIUtilities.isValid(currentRepresentation) ? self.renditionRepresentationIds.indexOf(currentRepresentation.id) : -1;
+
+        if(renditionId < 0) {
+            return;
+        }
+
+        self.sendEvent("segmentDownloaded", {
+            renditionId: renditionId,
+            bytes: Math.max(stats.bytes - previousStats.bytes, 0),
+            downloadTimeMs: Math.max(Math.floor(stats.downloadTimeMs - previousStats.downloadTimeMs), 0),
+            mediaDurationMs: Math.max(Math.floor((stats.mediaSeconds - previousStats.mediaSeconds) * 1000), 0),
+            bufferLengthMs: self.getForwardBufferLengthMs()
+        });
+    }
+
+    notifyBufferLengthChanged() {
+        const self = this;
+
+        self.checkInitialized();
+
+        const bufferLength = self.getBufferLength();
+
+        if(CYIUtilities.isInvalid(bufferLength)) {
+            return;
+        }
+
+        self.sendEvent("bufferLengthChanged", bufferLength);
     }
 
     notifyBitrateChanged() {
@@ -2860,6 +3840,18 @@ class CYIVideojsVideoPlayer {
             bitrateData.currentTotalBitrateKbps = Math.floor(self.currentTotalBitrateKbps);
         }
 
+        if(CYIUtilities.isValid(self.compactEventVersion)) {
+            return self.sendEvent("bitrateChanged", [
+                self.compactEventVersion,
+                CYIUtilities.isValid(bitrateData.initialAudioBitrateKbps) ? bitrateData.initialAudioBitrateKbps : null,
+                CYIUtilities.isValid(bitrateData.currentAudioBitrateKbps) ? bitrateData.currentAudioBitrateKbps : null,
+                CYIUtilities.isValid(bitrateData.initialVideoBitrateKbps) ? bitrateData.initialVideoBitrateKbps : null,
+                CYIUtilities.isValid(bitrateData.currentVideoBitrateKbps) ? bitrateData.currentVideoBitrateKbps : null,
+                CYIUtilities.isValid(bitrateData.initialTotalBitrateKbps) ? bitrateData.initialTotalBitrateKbps : null,
+                CYIUtilities.isValid(bitrateData.currentTotalBitrateKbps) ? bitrateData.currentTotalBitrateKbps : null
+            ]);
+        }
+
         self.sendEvent("bitrateChanged", bitrateData);
     }
 
@@ -2877,6 +3869,14 @@ class CYIVideojsVideoPlayer {
         self.sendEvent("bufferingStateChanged", buffering);
     }
 
+    notifySeekCompleted() {
+        const self = this;
+
+        self.checkInitialized();
+
+        self.sendEvent("seekCompleted", self.player.currentTime());
+    }
+
     notifyVideoTimeChanged() {
         const self = this;
 
@@ -2896,6 +3896,8 @@ class CYIVideojsVideoPlayer {
             }
         }
 
+        self.lastTimeUpdateSentMs = performance.now();
+
         const data = {
             currentTimeSeconds: self.getCurrentTime()
         };
@@ -2911,6 +3913,16 @@ class CYIVideojsVideoPlayer {
             data.bufferLengthMs = 0;
         }
 
+        if(CYIUtilities.isValid(self.compactEventVersion)) {
+            return self.sendEvent("videoTimeChanged", [
+                self.compactEventVersion,
+                data.currentTimeSeconds,
+                data.bufferStartMs,
+                data.bufferEndMs,
+                data.bufferLengthMs
+            ]);
+        }
+
         self.sendEvent("videoTimeChanged", data);
     }
 
@@ -2958,6 +3970,14 @@ class CYIVideojsVideoPlayer {
         self.sendEvent("textTracksChanged", self.getTextTracks());
     }
 
+    notifyMuteStatusChanged() {
+        const self = this;
+
+        self.checkInitialized();
+
+        self.sendEvent("muteStatusChanged", self.isMuted());
+    }
+
     notifyTextTrackStatusChanged() {
         const self = this;
 
@@ -3002,6 +4022,7 @@ class CYIVideojsVideoPlayer {
         return CYIMessaging.sendEvent({
             context: CYIVideojsVideoPlayer.name,
             name: eventName,
+            instanceId: self.instanceId,
             data: data
         });
     }
@@ -3012,6 +4033,7 @@ class CYIVideojsVideoPlayer {
         return CYIMessaging.sendEvent({
             context: CYIVideojsVideoPlayer.name,
             name: eventName,
+            instanceId: self.instanceId,
             error: error
         });
     }
@@ -3046,6 +4068,11 @@ Object.defineProperty(CYIVideojsVideoPlayer, "BitrateKbpsScale", {
     enumerable: true
 });
 
+Object.defineProperty(CYIVideojsVideoPlayer, "CompactEventVersion", {
+    value: 1,
+    enumerable: true
+});
+
 Object.defineProperty(CYIVideojsVideoPlayer, "State", {
     enumerable: true,
     value: CYIVideojsVideoPlayerState
@@ -3154,6 +4181,13 @@ Object.defineProperty(CYIVideojsVideoPlayer, "instance", {
     }
 });
 
+Object.defineProperty(CYIVideojsVideoPlayer, "instances", {
+    enumerable: true,
+    get() {
+        return CYIVideojsVideoPlayer.properties.instances;
+    }
+});
+
 Object.defineProperty(CYIVideojsVideoPlayer, "script", {
     enumerable: true,
     get() {
@@ -3184,6 +4218,16 @@ Object.defineProperty(CYIVideojsVideoPlayer, "playerVersion", {
     }
 });
 
+Object.defineProperty(CYIVideojsVideoPlayer, "defaultBufferGoals", {
+    enumerable: true,
+    get() {
+        return CYIVideojsVideoPlayer.properties.defaultBufferGoals;
+    },
+    set(value) {
+        CYIVideojsVideoPlayer.properties.defaultBufferGoals = value;
+    }
+});
+
 Object.defineProperty(CYIVideojsVideoPlayer, "ExternalTrackPrefix", {
     value: "external",
     enumerable: true
@@ -6,19 +6,85 @@ set(HEADERS_IOS
     src/AirplayRoutePicker.h
 )
 
-set(SOURCE_TIZEN-NACL
-    src/YiTizenNaClRemoteLoggerSink.cpp
+# The Video.js player adapter. It only talks to the web view through CYIVideojsBridgeTransport, so it is also built
+# into the host test target.
+set(VIDEOJS_ADAPTER_SOURCE
+    src/YiVideojsBridgeRecorder.cpp
+    src/YiVideojsBridgeReplayer.cpp
+    src/YiVideojsBridgeTransport.cpp
+    src/YiVideojsDocumentPool.cpp
+    src/YiVideojsEventDecoder.cpp
+    src/YiVideojsSeekableRangeIndex.cpp
     src/YiVideojsVideoPlayer.cpp
+    src/YiVideojsVideoPlayerPool.cpp
     src/YiVideojsVideoSurface.cpp
 )
 
-set(HEADERS_TIZEN-NACL
-    src/YiTizenNaClRemoteLoggerSink.h
+set(VIDEOJS_ADAPTER_HEADERS
+    src/YiVideojsABRController.h
+    src/YiVideojsBridgeRecorder.h
+    src/YiVideojsBridgeReplayer.h
+    src/YiVideojsBridgeTransport.h
+    src/YiVideojsDocumentPool.h
+    src/YiVideojsEventDecoder.h
+    src/YiVideojsSeekableRangeIndex.h
     src/YiVideojsVideoPlayer.h
+    src/YiVideojsVideoPlayerPool.h
     src/YiVideojsVideoPlayerPriv.h
+    src/YiVideojsVideoPlayerPriv.inl
     src/YiVideojsVideoSurface.h
 )
 
+# The in-process stand-in for the web view. It is never shipped, only the test and benchmark targets compile it.
+set(VIDEOJS_SIMULATION_SOURCE
+    src/YiVideojsSimulatedBridgeTransport.cpp
+)
+
+set(VIDEOJS_SIMULATION_HEADERS
+    src/YiVideojsSimulatedBridgeTransport.h
+)
+
+set(VIDEOJS_ALLOCATION_COUNTER_SOURCE
+    test/YiVideojsAllocationCounter.cpp
+)
+
+set(VIDEOJS_ALLOCATION_COUNTER_HEADERS
+    test/YiVideojsAllocationCounter.h
+)
+
+set(VIDEOJS_BENCHMARK_SOURCE
+    benchmark/YiVideojsBenchmarkMain.cpp
+    benchmark/YiVideojsVideoPlayerBenchmark.cpp
+)
+
+set(VIDEOJS_BENCHMARK_HEADERS
+    benchmark/YiVideojsVideoPlayerBenchmark.h
+)
+
+set(VIDEOJS_TEST_SOURCE
+    test/YiVideojsABRTest.cpp
+    test/YiVideojsBridgeReplayerTest.cpp
+    test/YiVideojsCommandAllocationTest.cpp
+    test/YiVideojsMultiInstanceTest.cpp
+    test/YiVideojsResolutionCapTest.cpp
+    test/YiVideojsSeekableRangeIndexTest.cpp
+    test/YiVideojsVideoPlayerTest.cpp
+)
+
+set(VIDEOJS_TEST_HEADERS
+    test/YiVideojsVideoPlayerTest.h
+)
+
+set(SOURCE_TIZEN-NACL
+    src/YiTizenNaClRemoteLoggerSink.cpp
+    ${VIDEOJS_ADAPTER_SOURCE}
+)
+
+set(HEADERS_TIZEN-NACL
+    src/YiTizenNaClRemoteLoggerSink.h
+    ${VIDEOJS_ADAPTER_HEADERS}
+)
+
 set (YI_PROJECT_SOURCE
     src/IStreamPlanetFairPlayHandler.cpp
     src/PlayerTesterApp.cpp
@@ -0,0 +1,51 @@
+#include "YiVideojsVideoPlayerBenchmark.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// usage: VideojsAdapterBenchmarks [iterations]
+//        VideojsAdapterBenchmarks --replay <recording file>
+// the results are written to stdout as a single JSON object
+int main(int argc, char **argv)
+{
+    if (argc > 1 && std::strcmp(argv[1], "--replay") == 0)
+    {
+        if (argc < 3)
+        {
+            std::fprintf(stderr, "--replay requires the path of a bridge recording file.\n");
+            return 1;
+        }
+
+        CYIVideojsVideoPlayerBenchmark::ReplayResult result;
+
+        if (!CYIVideojsVideoPlayerBenchmark::Replay(argv[2], result))
+        {
+            std::fprintf(stderr, "Failed to replay the bridge recording '%s'.\n", argv[2]);
+            return 1;
+        }
+
+        std::printf("%s\n", CYIVideojsVideoPlayerBenchmark::ToJSONString(result).GetData());
+
+        return 0;
+    }
+
+    uint32_t iterations = CYIVideojsVideoPlayerBenchmark::DEFAULT_ITERATIONS;
+
+    if (argc > 1)
+    {
+        iterations = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+
+    if (iterations == 0)
+    {
+        std::fprintf(stderr, "The iteration count must be a positive number.\n");
+        return 1;
+    }
+
+    std::vector<CYIVideojsVideoPlayerBenchmark::Result> results = CYIVideojsVideoPlayerBenchmark::Run(iterations);
+
+    std::printf("%s\n", CYIVideojsVideoPlayerBenchmark::ToJSONString(results).GetData());
+
+    return results.empty() ? 1 : 0;
+}
@@ -0,0 +1,507 @@
+#include "YiVideojsVideoPlayerBenchmark.h"
+
+#include "YiVideojsAllocationCounter.h"
+#include "YiVideojsEventDecoder.h"
+#include "YiVideojsSimulatedBridgeTransport.h"
+#include "YiVideojsVideoPlayer.h"
+#include "YiVideojsVideoPlayerPriv.h"
+
+#include <player/YiWidevineModularDRMConfiguration.h>
+
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <memory>
+
+#define LOG_TAG "CYIVideojsVideoPlayerBenchmark"
+
+static const uint32_t WARMUP_ITERATION_DIVISOR = 10;
+static const uint32_t SOAK_ITERATION_MULTIPLIER = 2;
+
+// decoded values are stored here so that the compiler cannot drop the decoding being measured
+static volatile double s_decodedValue = 0.0;
+
+// hand-written events shaped like the ones the web view sends during playback of a multi-audio DASH stream
+static const char *SAMPLE_VIDEO_TIME_CHANGED_EVENT = "{\"context\":\"CYIVideojsVideoPlayer\",\"name\":\"videoTimeChanged\",\"instanceId\":1,\"data\":{\"currentTimeSeconds\":1834.417,\"bufferStartMs\":1802000,\"bufferEndMs\":1864000,\"bufferLengthMs\":29583}}";
+static const char *SAMPLE_COMPACT_VIDEO_TIME_CHANGED_EVENT = "{\"context\":\"CYIVideojsVideoPlayer\",\"name\":\"videoTimeChanged\",\"instanceId\":1,\"data\":[1,1834.417,1802000,1864000,29583]}";
+static const char *SAMPLE_BITRATE_CHANGED_EVENT = "{\"context\":\"CYIVideojsVideoPlayer\",\"name\":\"bitrateChanged\",\"instanceId\":1,\"data\":{\"initialAudioBitrateKbps\":128,\"currentAudioBitrateKbps\":128,\"initialVideoBitrateKbps\":1800,\"currentVideoBitrateKbps\":4500,\"initialTotalBitrateKbps\":1928,\"currentTotalBitrateKbps\":4628}}";
+static const char *SAMPLE_AUDIO_TRACKS_CHANGED_EVENT = "{\"context\":\"CYIVideojsVideoPlayer\",\"name\":\"audioTracksChanged\",\"instanceId\":1,\"data\":[{\"id\":0,\"title\":\"English (Main)\",\"language\":\"en\"},{\"id\":1,\"title\":\"English (Descriptive)\",\"language\":\"en\"},{\"id\":2,\"title\":\"Fran\\u00e7ais\",\"language\":\"fr\"},{\"id\":3,\"title\":\"Espa\\u00f1ol\",\"language\":\"es\"}]}";
+static const char *SAMPLE_METADATA_AVAILABLE_EVENT = "{\"context\":\"CYIVideojsVideoPlayer\",\"name\":\"metadataAvailable\",\"instanceId\":1,\"data\":{\"identifier\":\"TXXX\",\"value\":\"{\\\"adId\\\":\\\"a1b2c3\\\",\\\"break\\\":2}\",\"timestamp\":1834417,\"durationMs\":30000}}";
+static const char *PREPARE_URL = "https://storage.googleapis.com/wvmedia/cenc/h264/tears/tears.mpd";
+static const char *LICENSE_ACQUISITION_URL = "https://widevine-proxy.appspot.com/proxy";
+
+namespace
+{
+    // the optional byte counter reports the bytes that crossed the bridge so far, its growth over the measured iterations
+    // is reported per operation
+    template<typename FUNCTION>
+    CYIVideojsVideoPlayerBenchmark::Result Measure(const char *pName, uint32_t iterations, FUNCTION &&function, const std::function<uint64_t()> &byteCounter = nullptr)
+    {
+        for (uint32_t i = 0; i < iterations / WARMUP_ITERATION_DIVISOR; ++i)
+        {
+            function(i);
+        }
+
+        uint64_t startAllocationCount = CYIVideojsAllocationCounter::GetAllocationCount();
+        int64_t startLiveBytes = CYIVideojsAllocationCounter::GetLiveBytes();
+        uint64_t startBytes = byteCounter ? byteCounter() : 0;
+        std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+        for (uint32_t i = 0; i < iterations; ++i)
+        {
+            function(i);
+        }
+
+        std::chrono::steady_clock::duration elapsedTime = std::chrono::steady_clock::now() - startTime;
+        uint64_t allocationCount = CYIVideojsAllocationCounter::GetAllocationCount() - startAllocationCount;
+        int64_t liveHeapDeltaBytes = CYIVideojsAllocationCounter::GetLiveBytes() - startLiveBytes;
+
+        CYIVideojsVideoPlayerBenchmark::Result result;
+        result.name = pName;
+        result.iterations = iterations;
+        result.nanosecondsPerOperation = iterations > 0 ? std::chrono::duration_cast<std::chrono::duration<double, std::nano>>(elapsedTime).count() / iterations : 0.0;
+        result.allocationsPerOperation = CYIVideojsVideoPlayerBenchmark::IsAllocationCountingEnabled() && iterations > 0 ? static_cast<double>(allocationCount) / iterations : -1.0;
+        result.allocationCount = allocationCount;
+        result.liveHeapDeltaBytes = liveHeapDeltaBytes;
+        result.bytesPerOperation = byteCounter && iterations > 0 ? static_cast<double>(byteCounter() - startBytes) / iterations : -1.0;
+
+        YI_LOGI(LOG_TAG, "%s: %.1f ns/op over %llu iterations.", pName, result.nanosecondsPerOperation, static_cast<unsigned long long>(iterations));
+
+        return result;
+    }
+
+    // the videoTimeChanged handler as it was before the schema decoder, which looks every field up by name through the
+    // DOM, kept to compare the decoder against on the same payloads. Only the error logging has been left out.
+    bool DecodeVideoTimeChangedWithLookups(const yi::rapidjson::Value &eventValue, CYIVideojsEventDecoder::VideoTimeChangedEvent &event)
+    {
+        static const char *CURRENT_TIME_ATTRIBUTE_NAME = "currentTimeSeconds";
+        static const char *BUFFER_LENGTH_ATTRIBUTE_NAME = "bufferLengthMs";
+
+        if (!eventValue.IsObject() || !eventValue.HasMember(CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME))
+        {
+            return false;
+        }
+
+        const yi::rapidjson::Value &eventDataValue = eventValue[CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME];
+
+        if (!eventDataValue.IsObject() || !eventDataValue.HasMember(CURRENT_TIME_ATTRIBUTE_NAME))
+        {
+            return false;
+        }
+
+        const yi::rapidjson::Value &currentTimeValue = eventDataValue[CURRENT_TIME_ATTRIBUTE_NAME];
+
+        if (!currentTimeValue.IsNumber() || currentTimeValue.GetDouble() < 0)
+        {
+            return false;
+        }
+
+        event.currentTimeSeconds = currentTimeValue.GetDouble();
+
+        CYIParsingError parsingError;
+        float bufferLengthMs = -1.0f;
+
+        CYIRapidJSONUtility::GetFloatField(&eventDataValue, BUFFER_LENGTH_ATTRIBUTE_NAME, &bufferLengthMs, parsingError);
+
+        if (parsingError.HasError() && parsingError.GetParsingErrorCode() != CYIParsingError::ErrorType::DataFieldMissing)
+        {
+            return false;
+        }
+
+        event.bufferLengthMs = bufferLengthMs;
+        event.hasBufferLength = !parsingError.HasError();
+
+        return true;
+    }
+
+    bool GetBitratePair(const yi::rapidjson::Value &eventDataValue, const char *pInitialAttributeName, const char *pCurrentAttributeName, double &initialBitrateKbps, double &currentBitrateKbps, bool &hasBitrate)
+    {
+        if (!eventDataValue.HasMember(pInitialAttributeName) && !eventDataValue.HasMember(pCurrentAttributeName))
+        {
+            return true;
+        }
+
+        CYIParsingError initialParsingError;
+        float initialKbps = -1.0f;
+
+        CYIRapidJSONUtility::GetFloatField(&eventDataValue, pInitialAttributeName, &initialKbps, initialParsingError);
+
+        if (initialParsingError.HasError())
+        {
+            return false;
+        }
+
+        CYIParsingError currentParsingError;
+        float currentKbps = -1.0f;
+
+        CYIRapidJSONUtility::GetFloatField(&eventDataValue, pCurrentAttributeName, &currentKbps, currentParsingError);
+
+        if (currentParsingError.HasError())
+        {
+            return false;
+        }
+
+        initialBitrateKbps = initialKbps;
+        currentBitrateKbps = currentKbps;
+        hasBitrate = true;
+
+        return true;
+    }
+
+    // the bitrateChanged handler as it was before the schema decoder, with each pair looked up by name through the DOM
+    bool DecodeBitrateChangedWithLookups(const yi::rapidjson::Value &eventValue, CYIVideojsEventDecoder::BitrateChangedEvent &event)
+    {
+        if (!eventValue.IsObject() || !eventValue.HasMember(CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME))
+        {
+            return false;
+        }
+
+        const yi::rapidjson::Value &eventDataValue = eventValue[CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME];
+
+        if (!eventDataValue.IsObject())
+        {
+            return false;
+        }
+
+        return GetBitratePair(eventDataValue, "initialAudioBitrateKbps", "currentAudioBitrateKbps", event.initialAudioBitrateKbps, event.currentAudioBitrateKbps, event.hasAudioBitrate) &&
+            GetBitratePair(eventDataValue, "initialVideoBitrateKbps", "currentVideoBitrateKbps", event.initialVideoBitrateKbps, event.currentVideoBitrateKbps, event.hasVideoBitrate) &&
+            GetBitratePair(eventDataValue, "initialTotalBitrateKbps", "currentTotalBitrateKbps", event.initialTotalBitrateKbps, event.currentTotalBitrateKbps, event.hasTotalBitrate);
+    }
+
+    std::unique_ptr<yi::rapidjson::Document> ParseEvent(const char *pEvent)
+    {
+        std::unique_ptr<yi::rapidjson::Document> pDocument(new yi::rapidjson::Document());
+        pDocument->Parse(pEvent);
+
+        YI_ASSERT(!pDocument->HasParseError(), LOG_TAG, "Benchmark sample event is not valid JSON: %s", pEvent);
+
+        return pDocument;
+    }
+}
+
+bool CYIVideojsVideoPlayerBenchmark::IsAllocationCountingEnabled()
+{
+    return CYIVideojsAllocationCounter::IsEnabled();
+}
+
+std::vector<CYIVideojsVideoPlayerBenchmark::Result> CYIVideojsVideoPlayerBenchmark::Run(uint32_t iterations)
+{
+    std::vector<Result> results;
+
+    // responses are made available immediately so that the measurements reflect the adapter rather than the simulated latency
+    CYIVideojsSimulatedBridgeTransport::Configuration transportConfiguration;
+    transportConfiguration.responseDelayMs = 0;
+    transportConfiguration.prepareDelayMs = 0;
+    transportConfiguration.seekDelayMs = 0;
+
+    CYIVideojsSimulatedBridgeTransport *pTransport = new CYIVideojsSimulatedBridgeTransport(transportConfiguration);
+    std::unique_ptr<CYIVideojsBridgeTransport> pPreviousTransport = CYIVideojsBridgeTransport::SetTransport(std::unique_ptr<CYIVideojsBridgeTransport>(pTransport));
+
+    {
+        std::unique_ptr<CYIVideojsVideoPlayer> pPlayer(CYIVideojsVideoPlayer::Create());
+
+        if (!pPlayer)
+        {
+            YI_LOGE(LOG_TAG, "Failed to create a CYIVideojsVideoPlayer instance against the simulated bridge transport, no benchmarks were run.");
+            CYIVideojsBridgeTransport::SetTransport(std::move(pPreviousTransport));
+            return results;
+        }
+
+        pPlayer->Init();
+
+        CYIVideojsVideoPlayerPriv *pPriv = pPlayer->m_pPriv;
+
+        // delivers the simulated events and collects every response that is ready, as the transport tick timer and the
+        // player poll timers do in the application loop, so that each operation is measured through to its completion
+        std::function<void()> completeRequests = [pPriv, pTransport]() {
+            pTransport->ProcessEvents();
+            pPriv->OnPendingCommandTimerTimedOut();
+            pPriv->OnPrepareResponseTimerTimedOut();
+        };
+
+        // commands are measured by the bytes the simulated transport serialized for the web view
+        std::function<uint64_t()> messageBytes = [pTransport]() {
+            return pTransport->GetMessageBytes();
+        };
+
+        std::unique_ptr<yi::rapidjson::Document> pVideoTimeChangedEvent = ParseEvent(SAMPLE_VIDEO_TIME_CHANGED_EVENT);
+        std::unique_ptr<yi::rapidjson::Document> pCompactVideoTimeChangedEvent = ParseEvent(SAMPLE_COMPACT_VIDEO_TIME_CHANGED_EVENT);
+        std::unique_ptr<yi::rapidjson::Document> pBitrateChangedEvent = ParseEvent(SAMPLE_BITRATE_CHANGED_EVENT);
+        std::unique_ptr<yi::rapidjson::Document> pAudioTracksChangedEvent = ParseEvent(SAMPLE_AUDIO_TRACKS_CHANGED_EVENT);
+        std::unique_ptr<yi::rapidjson::Document> pMetadataAvailableEvent = ParseEvent(SAMPLE_METADATA_AVAILABLE_EVENT);
+
+        // the decoders are measured on their own next to the lookups they replaced, and the bytes per operation of the
+        // event benchmarks are the size of the payload the web view sends for each event
+        results.push_back(Measure("DecodeVideoTimeChanged (DOM lookups)", iterations, [&pVideoTimeChangedEvent](uint32_t) {
+            CYIVideojsEventDecoder::VideoTimeChangedEvent event;
+            DecodeVideoTimeChangedWithLookups(*pVideoTimeChangedEvent, event);
+            s_decodedValue = event.currentTimeSeconds;
+        }));
+        results.back().bytesPerOperation = static_cast<double>(std::strlen(SAMPLE_VIDEO_TIME_CHANGED_EVENT));
+
+        results.push_back(Measure("DecodeVideoTimeChanged", iterations, [&pVideoTimeChangedEvent](uint32_t) {
+            CYIVideojsEventDecoder::VideoTimeChangedEvent event;
+            CYIString errorMessage;
+            CYIVideojsEventDecoder::DecodeVideoTimeChanged(*pVideoTimeChangedEvent, event, errorMessage);
+            s_decodedValue = event.currentTimeSeconds;
+        }));
+        results.back().bytesPerOperation = static_cast<double>(std::strlen(SAMPLE_VIDEO_TIME_CHANGED_EVENT));
+
+        results.push_back(Measure("DecodeVideoTimeChanged (compact)", iterations, [&pCompactVideoTimeChangedEvent](uint32_t) {
+            CYIVideojsEventDecoder::VideoTimeChangedEvent event;
+            CYIString errorMessage;
+            CYIVideojsEventDecoder::DecodeVideoTimeChanged(*pCompactVideoTimeChangedEvent, event, errorMessage);
+            s_decodedValue = event.currentTimeSeconds;
+        }));
+        results.back().bytesPerOperation = static_cast<double>(std::strlen(SAMPLE_COMPACT_VIDEO_TIME_CHANGED_EVENT));
+
+        results.push_back(Measure("DecodeBitrateChanged (DOM lookups)", iterations, [&pBitrateChangedEvent](uint32_t) {
+            CYIVideojsEventDecoder::BitrateChangedEvent event;
+            DecodeBitrateChangedWithLookups(*pBitrateChangedEvent, event);
+            s_decodedValue = event.currentTotalBitrateKbps;
+        }));
+        results.back().bytesPerOperation = static_cast<double>(std::strlen(SAMPLE_BITRATE_CHANGED_EVENT));
+
+        results.push_back(Measure("DecodeBitrateChanged", iterations, [&pBitrateChangedEvent](uint32_t) {
+            CYIVideojsEventDecoder::BitrateChangedEvent event;
+            CYIString errorMessage;
+            CYIVideojsEventDecoder::DecodeBitrateChanged(*pBitrateChangedEvent, event, errorMessage);
+            s_decodedValue = event.currentTotalBitrateKbps;
+        }));
+        results.back().bytesPerOperation = static_cast<double>(std::strlen(SAMPLE_BITRATE_CHANGED_EVENT));
+
+        results.push_back(Measure("OnVideoTimeChanged", iterations, [pPriv, &pVideoTimeChangedEvent](uint32_t) {
+            pPriv->OnVideoTimeChanged(*pVideoTimeChangedEvent);
+        }));
+        results.back().bytesPerOperation = static_cast<double>(std::strlen(SAMPLE_VIDEO_TIME_CHANGED_EVENT));
+
+        results.push_back(Measure("OnVideoTimeChanged (compact)", iterations, [pPriv, &pCompactVideoTimeChangedEvent](uint32_t) {
+            pPriv->OnVideoTimeChanged(*pCompactVideoTimeChangedEvent);
+        }));
+        results.back().bytesPerOperation = static_cast<double>(std::strlen(SAMPLE_COMPACT_VIDEO_TIME_CHANGED_EVENT));
+
+        results.push_back(Measure("OnBitrateChanged", iterations, [pPriv, &pBitrateChangedEvent](uint32_t) {
+            pPriv->OnBitrateChanged(*pBitrateChangedEvent);
+        }));
+        results.back().bytesPerOperation = static_cast<double>(std::strlen(SAMPLE_BITRATE_CHANGED_EVENT));
+
+        results.push_back(Measure("OnAudioTracksChanged", iterations, [pPriv, &pAudioTracksChangedEvent](uint32_t) {
+            pPriv->OnAudioTracksChanged(*pAudioTracksChangedEvent);
+        }));
+
+        results.push_back(Measure("OnMetadataAvailable", iterations, [pPriv, &pMetadataAvailableEvent](uint32_t) {
+            pPriv->OnMetadataAvailable(*pMetadataAvailableEvent);
+        }));
+
+        std::unique_ptr<CYIWidevineModularDRMConfiguration> pDRMConfiguration(new CYIWidevineModularDRMConfiguration());
+        pDRMConfiguration->SetLicenseAcquisitionUrl(CYIUrl(LICENSE_ACQUISITION_URL));
+
+        results.push_back(Measure("AddDRMConfigurationToValue", iterations, [&pDRMConfiguration](uint32_t) {
+            yi::rapidjson::Document document(yi::rapidjson::kObjectType);
+            CYIVideojsVideoPlayerPriv::AddDRMConfigurationToValue(pDRMConfiguration.get(), document, document.GetAllocator());
+        }));
+
+        pPlayer->m_pDRMConfiguration = std::move(pDRMConfiguration);
+
+        const CYIUrl prepareUrl(PREPARE_URL);
+
+        results.push_back(Measure("Prepare (Widevine)", iterations, [pPriv, &prepareUrl, &completeRequests](uint32_t) {
+            pPriv->Prepare(prepareUrl, CYIAbstractVideoPlayer::StreamingFormat::DASH);
+            completeRequests();
+        }, messageBytes));
+
+        // every seek completes through its simulated seeked event before the next one is requested
+        results.push_back(Measure("Seek", iterations, [pPriv, &completeRequests](uint32_t i) {
+            pPriv->Seek(static_cast<uint64_t>(i % 3600) * 1000);
+            completeRequests();
+        }, messageBytes));
+
+        // a held seek key, every target replaces the pending one while the first seek is still in flight
+        results.push_back(Measure("Seek (coalesced)", iterations, [pPriv](uint32_t i) {
+            pPriv->Seek(static_cast<uint64_t>(i % 3600) * 1000);
+        }));
+
+        completeRequests();
+
+        results.push_back(Measure("SetVideoRectangle", iterations, [pPriv, &completeRequests](uint32_t i) {
+            YI_RECT_REL videoRectangle;
+            videoRectangle.x = static_cast<int32_t>(i % 2);
+            videoRectangle.y = 0;
+            videoRectangle.width = 1920;
+            videoRectangle.height = 1080;
+
+            pPriv->SetVideoRectangle(videoRectangle);
+            completeRequests();
+        }, messageBytes));
+
+        // a frame of batched commands, issued, flushed at the end of the frame and completed like the batch timer does
+        pPriv->SetAsynchronousCommandsEnabled(true);
+        pPriv->SetCommandBatchingEnabled(true);
+
+        results.push_back(Measure("Batched frame", iterations, [pPriv, &completeRequests](uint32_t i) {
+            pPriv->Play();
+            pPriv->Pause();
+            pPriv->Seek(static_cast<uint64_t>(i % 3600) * 1000);
+            pPriv->OnCommandBatchTimerTimedOut();
+            completeRequests();
+        }, messageBytes));
+
+        pPriv->SetCommandBatchingEnabled(false);
+        pPriv->SetAsynchronousCommandsEnabled(false);
+
+        // the soak runs the same command mix twice as long in the second pass, steady state heap usage shows up as a live heap
+        // that does not grow across either pass, an unchanged per-operation cost and no pool overflows
+        std::function<void(uint32_t)> commandSoak = [pPriv, &completeRequests](uint32_t i) {
+            pPriv->Seek(static_cast<uint64_t>(i % 3600) * 1000);
+            pPriv->SetTimeUpdateIntervalMs(250 + i % 2);
+            pPriv->SetNickname(i % 2 ? "soak-odd" : "soak-even");
+            completeRequests();
+        };
+
+        pPriv->ResetDocumentPoolStatistics();
+
+        results.push_back(Measure("Command soak", iterations, commandSoak, messageBytes));
+        results.push_back(Measure("Command soak (sustained)", iterations * SOAK_ITERATION_MULTIPLIER, commandSoak, messageBytes));
+
+        if (IsAllocationCountingEnabled())
+        {
+            for (size_t i = results.size() - 2; i < results.size(); ++i)
+            {
+                YI_LOGI(LOG_TAG, "%s: %llu allocation(s), live heap changed by %lld byte(s).", results[i].name.GetData(), static_cast<unsigned long long>(results[i].allocationCount), static_cast<long long>(results[i].liveHeapDeltaBytes));
+            }
+        }
+
+        CYIVideojsVideoPlayer::DocumentPoolStatistics poolStatistics = pPriv->GetDocumentPoolStatistics();
+
+        YI_LOGI(LOG_TAG, "Document pool after soak: %u/%u slot(s) high-water, %u of %u byte(s) high-water, %llu lease(s), %llu exhausted, %llu chunk overflow(s).", poolStatistics.highWaterSlotsInUse, poolStatistics.slotCount, static_cast<uint32_t>(poolStatistics.highWaterBytesUsed), static_cast<uint32_t>(poolStatistics.slotSizeBytes), static_cast<unsigned long long>(poolStatistics.leases), static_cast<unsigned long long>(poolStatistics.exhaustedLeases), static_cast<unsigned long long>(poolStatistics.chunkOverflows));
+    }
+
+    std::map<CYIString, CYIString> playerConfiguration;
+    playerConfiguration["autoplay"] = "false";
+    playerConfiguration["preload"] = "auto";
+    playerConfiguration["techOrder"] = "html5";
+    playerConfiguration["nickname"] = "benchmark";
+
+    results.push_back(Measure("Create(std::map)", iterations, [&playerConfiguration](uint32_t) {
+        std::unique_ptr<CYIVideojsVideoPlayer> pPlayer(CYIVideojsVideoPlayer::Create(playerConfiguration));
+    }));
+
+    CYIVideojsBridgeTransport::SetTransport(std::move(pPreviousTransport));
+
+    return results;
+}
+
+CYIString CYIVideojsVideoPlayerBenchmark::ToJSONString(const std::vector<Result> &results)
+{
+    yi::rapidjson::Document document(yi::rapidjson::kObjectType);
+    yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = document.GetAllocator();
+
+    yi::rapidjson::Value resultsValue(yi::rapidjson::kArrayType);
+
+    for (const Result &result : results)
+    {
+        yi::rapidjson::Value resultValue(yi::rapidjson::kObjectType);
+        resultValue.AddMember(yi::rapidjson::StringRef("name"), yi::rapidjson::Value(result.name.GetData(), allocator), allocator);
+        resultValue.AddMember(yi::rapidjson::StringRef("iterations"), yi::rapidjson::Value(result.iterations), allocator);
+        resultValue.AddMember(yi::rapidjson::StringRef("nsPerOp"), yi::rapidjson::Value(result.nanosecondsPerOperation), allocator);
+
+        // allocation counts are only available on Linux, where the benchmark target defines YI_VIDEOJS_COUNT_ALLOCATIONS
+        if (result.allocationsPerOperation >= 0.0)
+        {
+            resultValue.AddMember(yi::rapidjson::StringRef("allocationsPerOp"), yi::rapidjson::Value(result.allocationsPerOperation), allocator);
+            resultValue.AddMember(yi::rapidjson::StringRef("allocations"), yi::rapidjson::Value(result.allocationCount), allocator);
+            resultValue.AddMember(yi::rapidjson::StringRef("liveHeapDeltaBytes"), yi::rapidjson::Value(result.liveHeapDeltaBytes), allocator);
+        }
+        else
+        {
+            resultValue.AddMember(yi::rapidjson::StringRef("allocationsPerOp"), yi::rapidjson::Value(yi::rapidjson::kNullType), allocator);
+            resultValue.AddMember(yi::rapidjson::StringRef("allocations"), yi::rapidjson::Value(yi::rapidjson::kNullType), allocator);
+            resultValue.AddMember(yi::rapidjson::StringRef("liveHeapDeltaBytes"), yi::rapidjson::Value(yi::rapidjson::kNullType), allocator);
+        }
+
+        if (result.bytesPerOperation >= 0.0)
+        {
+            resultValue.AddMember(yi::rapidjson::StringRef("bytesPerOp"), yi::rapidjson::Value(result.bytesPerOperation), allocator);
+        }
+
+        resultsValue.PushBack(resultValue, allocator);
+    }
+
+    document.AddMember(yi::rapidjson::StringRef("benchmarks"), resultsValue, allocator);
+
+    return CYIRapidJSONUtility::CreateStringFromValue(document);
+}
+
+bool CYIVideojsVideoPlayerBenchmark::Replay(const CYIString &filePath, ReplayResult &result)
+{
+    CYIVideojsBridgeReplayer replayer;
+
+    if (!replayer.Load(filePath))
+    {
+        return false;
+    }
+
+    // the player only needs to exist for the replayed events to be routed to it, the transport never raises events itself
+    CYIVideojsSimulatedBridgeTransport *pTransport = new CYIVideojsSimulatedBridgeTransport();
+    std::unique_ptr<CYIVideojsBridgeTransport> pPreviousTransport = CYIVideojsBridgeTransport::SetTransport(std::unique_ptr<CYIVideojsBridgeTransport>(pTransport));
+
+    bool replayed = false;
+
+    {
+        std::unique_ptr<CYIVideojsVideoPlayer> pPlayer(CYIVideojsVideoPlayer::Create());
+
+        if (!pPlayer)
+        {
+            YI_LOGE(LOG_TAG, "Failed to create a CYIVideojsVideoPlayer instance to replay '%s' into.", filePath.GetData());
+        }
+        else
+        {
+            pPlayer->Init();
+            replayer.SetInstanceIdOverride(pPlayer->GetInstanceId());
+
+            result.filePath = filePath;
+            result.maximumSpeed = replayer.RunAtMaximumSpeed();
+            result.originalSpeed = replayer.RunAtOriginalSpeed();
+            replayed = true;
+        }
+    }
+
+    CYIVideojsBridgeTransport::SetTransport(std::move(pPreviousTransport));
+
+    return replayed;
+}
+
+CYIString CYIVideojsVideoPlayerBenchmark::ToJSONString(const ReplayResult &result)
+{
+    yi::rapidjson::Document document(yi::rapidjson::kObjectType);
+    yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = document.GetAllocator();
+
+    const CYIVideojsBridgeReplayer::Statistics &maximumSpeed = result.maximumSpeed;
+    const CYIVideojsBridgeReplayer::Statistics &originalSpeed = result.originalSpeed;
+
+    yi::rapidjson::Value maximumSpeedValue(yi::rapidjson::kObjectType);
+    maximumSpeedValue.AddMember(yi::rapidjson::StringRef("eventsReplayed"), yi::rapidjson::Value(maximumSpeed.eventsReplayed), allocator);
+    maximumSpeedValue.AddMember(yi::rapidjson::StringRef("durationNs"), yi::rapidjson::Value(maximumSpeed.replayDurationNs), allocator);
+    maximumSpeedValue.AddMember(yi::rapidjson::StringRef("nsPerEvent"), yi::rapidjson::Value(maximumSpeed.eventsReplayed > 0 ? static_cast<double>(maximumSpeed.replayDurationNs) / maximumSpeed.eventsReplayed : 0.0), allocator);
+    maximumSpeedValue.AddMember(yi::rapidjson::StringRef("eventsPerSecond"), yi::rapidjson::Value(maximumSpeed.replayDurationNs > 0 ? maximumSpeed.eventsReplayed * 1000000000.0 / maximumSpeed.replayDurationNs : 0.0), allocator);
+
+    yi::rapidjson::Value originalSpeedValue(yi::rapidjson::kObjectType);
+    originalSpeedValue.AddMember(yi::rapidjson::StringRef("eventsReplayed"), yi::rapidjson::Value(originalSpeed.eventsReplayed), allocator);
+    originalSpeedValue.AddMember(yi::rapidjson::StringRef("durationNs"), yi::rapidjson::Value(originalSpeed.replayDurationNs), allocator);
+    originalSpeedValue.AddMember(yi::rapidjson::StringRef("maximumLatenessUs"), yi::rapidjson::Value(originalSpeed.maximumEventLatenessUs), allocator);
+    originalSpeedValue.AddMember(yi::rapidjson::StringRef("meanLatenessUs"), yi::rapidjson::Value(originalSpeed.eventsReplayed > 0 ? static_cast<double>(originalSpeed.totalEventLatenessUs) / originalSpeed.eventsReplayed : 0.0), allocator);
+
+    yi::rapidjson::Value replayValue(yi::rapidjson::kObjectType);
+    replayValue.AddMember(yi::rapidjson::StringRef("file"), yi::rapidjson::Value(result.filePath.GetData(), allocator), allocator);
+    replayValue.AddMember(yi::rapidjson::StringRef("recordedEvents"), yi::rapidjson::Value(maximumSpeed.recordedEvents), allocator);
+    replayValue.AddMember(yi::rapidjson::StringRef("recordedCalls"), yi::rapidjson::Value(maximumSpeed.recordedCalls), allocator);
+    replayValue.AddMember(yi::rapidjson::StringRef("recordedResponses"), yi::rapidjson::Value(maximumSpeed.recordedResponses), allocator);
+    replayValue.AddMember(yi::rapidjson::StringRef("recordedDurationUs"), yi::rapidjson::Value(maximumSpeed.recordedDurationUs), allocator);
+    replayValue.AddMember(yi::rapidjson::StringRef("maximumSpeed"), maximumSpeedValue, allocator);
+    replayValue.AddMember(yi::rapidjson::StringRef("originalSpeed"), originalSpeedValue, allocator);
+
+    document.AddMember(yi::rapidjson::StringRef("replay"), replayValue, allocator);
+
+    return CYIRapidJSONUtility::CreateStringFromValue(document);
+}
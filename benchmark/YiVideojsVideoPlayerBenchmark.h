@@ -0,0 +1,45 @@
+#ifndef _YI_VIDEOJS_VIDEO_PLAYER_BENCHMARK_H_
+#define _YI_VIDEOJS_VIDEO_PLAYER_BENCHMARK_H_
+
+#include "YiVideojsBridgeReplayer.h"
+
+#include <utility/YiString.h>
+
+#include <vector>
+
+class CYIVideojsVideoPlayerBenchmark
+{
+public:
+    static const uint32_t DEFAULT_ITERATIONS = 10000;
+
+    struct Result
+    {
+        CYIString name;
+        uint64_t iterations = 0;
+        double nanosecondsPerOperation = 0.0;
+        double allocationsPerOperation = -1.0;
+        uint64_t allocationCount = 0;
+        int64_t liveHeapDeltaBytes = 0;
+        double bytesPerOperation = -1.0;
+    };
+
+    struct ReplayResult
+    {
+        CYIString filePath;
+        CYIVideojsBridgeReplayer::Statistics maximumSpeed;
+        CYIVideojsBridgeReplayer::Statistics originalSpeed;
+    };
+
+    static bool IsAllocationCountingEnabled();
+    static std::vector<Result> Run(uint32_t iterations = DEFAULT_ITERATIONS);
+    static CYIString ToJSONString(const std::vector<Result> &results);
+
+    // replays the events of a bridge recording into a player, once as fast as possible and once at the recorded pace
+    static bool Replay(const CYIString &filePath, ReplayResult &result);
+    static CYIString ToJSONString(const ReplayResult &result);
+
+private:
+    CYIVideojsVideoPlayerBenchmark() = delete;
+};
+
+#endif // _YI_VIDEOJS_VIDEO_PLAYER_BENCHMARK_H_
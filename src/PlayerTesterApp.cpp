@@ -38,9 +38,13 @@
 #if defined(YI_TIZEN_NACL)
 #    include "YiTizenNaClRemoteLoggerSink.h"
 #    include "YiVideojsVideoPlayer.h"
+#    include "YiVideojsVideoPlayerPool.h"
 #    include <player/YiTizenNaClVideoPlayer.h>
 #endif
 
+#include <algorithm>
+#include <chrono>
+
 #define LOG_TAG "PlayerTesterApp"
 
 YI_TYPE_DEF_INST(PlayerTesterApp, TestApp)
@@ -50,6 +54,7 @@ class BufferingController : public CYISignalHandler
 public:
     uint32_t m_minimumTime;
     CYITimer m_minimumBufferingTimer;
+    CYIAbstractVideoPlayer *m_pPlayer;
     CYIActivityIndicatorView *m_pView;
     CYIConditionEvaluator m_endingEvaluator;
     CYICondition m_bufferingStopped;
@@ -57,14 +62,30 @@ public:
 
     BufferingController(CYIAbstractVideoPlayer *pPlayer, CYIActivityIndicatorView *pView, uint32_t minimumTime)
         : m_minimumTime(minimumTime)
+        , m_pPlayer(nullptr)
         , m_pView(pView)
     {
         m_endingEvaluator.AddCondition(&m_bufferingStopped);
         m_endingEvaluator.AddCondition(&m_timerCompleted);
         m_endingEvaluator.Success.Connect(*this, &BufferingController::OnBothConditions);
         m_minimumBufferingTimer.TimedOut.Connect(*this, &BufferingController::OnTimeout);
-        pPlayer->BufferingStarted.Connect(*this, &BufferingController::OnBufferingStarted, EYIConnectionType::Async);
-        pPlayer->BufferingEnded.Connect(*this, &BufferingController::OnBufferingStopped, EYIConnectionType::Async);
+        SetPlayer(pPlayer);
+    }
+
+    // follows the buffering of another player, e.g. the one a channel zap made active
+    void SetPlayer(CYIAbstractVideoPlayer *pPlayer)
+    {
+        if (m_pPlayer)
+        {
+            m_pPlayer->BufferingStarted.Disconnect(*this);
+            m_pPlayer->BufferingEnded.Disconnect(*this);
+            m_minimumBufferingTimer.Stop();
+            m_pView->Stop();
+        }
+
+        m_pPlayer = pPlayer;
+        m_pPlayer->BufferingStarted.Connect(*this, &BufferingController::OnBufferingStarted, EYIConnectionType::Async);
+        m_pPlayer->BufferingEnded.Connect(*this, &BufferingController::OnBufferingStopped, EYIConnectionType::Async);
     }
 
     void OnBufferingStarted()
@@ -90,6 +111,194 @@ public:
     }
 };
 
+class ScrubAccelerator : public CYISignalHandler
+{
+public:
+    static const uint32_t REPEAT_WINDOW_MS = 500;
+    static const uint32_t IDLE_COMMIT_MS = 800;
+    static const uint32_t REPEATS_PER_STEP = 4;
+
+    CYISignal<uint64_t> ScrubCommitted;
+
+    CYITimer m_idleTimer;
+    std::chrono::steady_clock::time_point m_lastStepTime;
+    uint64_t m_playheadMs;
+    size_t m_stepIndex;
+    uint32_t m_repeatCount;
+    bool m_forward;
+    bool m_scrubbing;
+
+    ScrubAccelerator()
+        : m_playheadMs(0)
+        , m_stepIndex(0)
+        , m_repeatCount(0)
+        , m_forward(true)
+        , m_scrubbing(false)
+    {
+        m_idleTimer.TimedOut.Connect(*this, &ScrubAccelerator::OnIdle);
+    }
+
+    // moves the virtual playhead only, the seek is issued once the remote has been idle for IDLE_COMMIT_MS. Forward steps
+    // stop at maximumMs, the duration or the live edge, unless it is 0
+    void Step(bool forward, uint64_t currentTimeMs, uint64_t maximumMs)
+    {
+        static const uint64_t STEP_SIZES_MS[] = { 10000, 30000, 60000, 300000 };
+        static const size_t STEP_SIZE_COUNT = sizeof(STEP_SIZES_MS) / sizeof(STEP_SIZES_MS[0]);
+
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+        if (!m_scrubbing)
+        {
+            m_scrubbing = true;
+            m_playheadMs = currentTimeMs;
+            m_stepIndex = 0;
+            m_repeatCount = 0;
+        }
+        else if (forward != m_forward || now - m_lastStepTime > std::chrono::milliseconds(REPEAT_WINDOW_MS))
+        {
+            m_stepIndex = 0;
+            m_repeatCount = 0;
+        }
+        else if (++m_repeatCount % REPEATS_PER_STEP == 0 && m_stepIndex + 1 < STEP_SIZE_COUNT)
+        {
+            ++m_stepIndex;
+        }
+
+        m_forward = forward;
+        m_lastStepTime = now;
+
+        uint64_t stepMs = STEP_SIZES_MS[m_stepIndex];
+
+        if (forward)
+        {
+            m_playheadMs += stepMs;
+
+            if (maximumMs > 0)
+            {
+                m_playheadMs = std::min(m_playheadMs, maximumMs);
+            }
+        }
+        else
+        {
+            m_playheadMs = m_playheadMs > stepMs ? m_playheadMs - stepMs : 0;
+        }
+
+        YI_LOGD(LOG_TAG, "Scrubbing %s by %llu s to %llu ms.", forward ? "forward" : "backward", static_cast<unsigned long long>(stepMs / 1000), static_cast<unsigned long long>(m_playheadMs));
+
+        m_idleTimer.Start(IDLE_COMMIT_MS);
+    }
+
+    // releasing the key does not commit right away, a press that follows within the idle window keeps scrubbing from the
+    // virtual playhead instead of seeking once per press
+    void Release()
+    {
+        if (m_scrubbing)
+        {
+            m_idleTimer.Start(IDLE_COMMIT_MS);
+        }
+    }
+
+    void Cancel()
+    {
+        m_idleTimer.Stop();
+        m_scrubbing = false;
+    }
+
+    void OnIdle()
+    {
+        Commit();
+    }
+
+    void Commit()
+    {
+        m_idleTimer.Stop();
+
+        if (!m_scrubbing)
+        {
+            return;
+        }
+
+        m_scrubbing = false;
+        ScrubCommitted.Emit(m_playheadMs);
+    }
+};
+
+#if defined(YI_TIZEN_NACL)
+// zaps between the live catalog entries on a pool of Video.js players and keeps track of how long each zap took
+class ChannelZapper : public CYISignalHandler
+{
+public:
+    static const size_t STANDBY_PLAYER_COUNT = 2;
+    static const uint64_t TARGET_ZAP_TIME_MS = 500;
+
+    CYIVideojsVideoPlayerPool m_pool;
+    std::vector<PlayerTesterApp::UrlAndFormat> m_channels;
+    std::vector<uint64_t> m_warmZapTimesMs;
+    std::vector<uint64_t> m_coldZapTimesMs;
+    size_t m_channelIndex;
+    bool m_zapped;
+
+    ChannelZapper(CYIVideoSurfaceView *pSurfaceView, std::vector<PlayerTesterApp::UrlAndFormat> channels)
+        : m_pool(pSurfaceView, STANDBY_PLAYER_COUNT)
+        , m_channels(std::move(channels))
+        , m_channelIndex(0)
+        , m_zapped(false)
+    {
+        m_pool.ZapCompleted.Connect(*this, &ChannelZapper::OnZapCompleted);
+    }
+
+    bool Init()
+    {
+        return m_pool.Init();
+    }
+
+    void Zap(bool up)
+    {
+        if (m_zapped)
+        {
+            m_channelIndex = GetNeighbourIndex(up);
+        }
+
+        m_zapped = true;
+
+        const PlayerTesterApp::UrlAndFormat &channel = m_channels[m_channelIndex];
+
+        YI_LOGI(LOG_TAG, "Zapping to channel %zu of %zu, '%s'.", m_channelIndex + 1, m_channels.size(), channel.name.GetData());
+
+        m_pool.Zap(CYIUrl(channel.url), channel.format);
+    }
+
+    size_t GetNeighbourIndex(bool up) const
+    {
+        return (m_channelIndex + (up ? 1 : m_channels.size() - 1)) % m_channels.size();
+    }
+
+    void OnZapCompleted(uint64_t zapTimeMs, bool warm)
+    {
+        std::vector<uint64_t> &zapTimesMs = warm ? m_warmZapTimesMs : m_coldZapTimesMs;
+        zapTimesMs.push_back(zapTimeMs);
+
+        std::vector<uint64_t> sortedZapTimesMs(zapTimesMs);
+        std::sort(sortedZapTimesMs.begin(), sortedZapTimesMs.end());
+
+        size_t zapsUnderTarget = static_cast<size_t>(std::count_if(zapTimesMs.begin(), zapTimesMs.end(), [](uint64_t timeMs) { return timeMs < TARGET_ZAP_TIME_MS; }));
+
+        YI_LOGI(LOG_TAG, "%s zap took %llu ms. Median over %zu %s zap(s) is %llu ms, %zu of them under %llu ms.", warm ? "Warm" : "Cold", static_cast<unsigned long long>(zapTimeMs), zapTimesMs.size(), warm ? "warm" : "cold", static_cast<unsigned long long>(sortedZapTimesMs[sortedZapTimesMs.size() / 2]), zapsUnderTarget, static_cast<unsigned long long>(TARGET_ZAP_TIME_MS));
+
+        // the neighbours are only prepared once playback has started so that they do not compete with the zap for bandwidth
+        for (bool up : { true, false })
+        {
+            size_t neighbourIndex = GetNeighbourIndex(up);
+
+            if (neighbourIndex != m_channelIndex)
+            {
+                m_pool.PrepareStandby(CYIUrl(m_channels[neighbourIndex].url), m_channels[neighbourIndex].format);
+            }
+        }
+    }
+};
+#endif // YI_TIZEN_NACL
+
 static void ConfigureCapabilities(CYIVideoSurface *pSurface, CYITextSceneNode *pTextNode)
 {
     CYIString text;
@@ -128,6 +337,9 @@ PlayerTesterApp::PlayerTesterApp()
     , m_playerIsMini(false)
     , m_pErrorView(nullptr)
     , m_pBufferingController(nullptr)
+    , m_pScrubAccelerator(nullptr)
+    , m_pChannelZapper(nullptr)
+    , m_pZapPlayer(nullptr)
     , m_pAnimateVideoTimeline(nullptr)
     , m_pShowVideoSelectorTimeline(nullptr)
     , m_pVideoSelectorView(nullptr)
@@ -184,11 +396,18 @@ PlayerTesterApp::PlayerTesterApp()
 
 PlayerTesterApp::~PlayerTesterApp()
 {
+#if defined(YI_TIZEN_NACL)
+    // the pool detaches its players from the surface view, so it has to go before the scene
+    delete m_pChannelZapper;
+    m_pChannelZapper = nullptr;
+#endif
     GetMasterAppSceneManager()->RemoveScene("Main");
     m_pPlayer.reset();
 
     delete m_pBufferingController;
     m_pBufferingController = nullptr;
+    delete m_pScrubAccelerator;
+    m_pScrubAccelerator = nullptr;
 #if defined(YI_IOS)
     m_RoutePicker.SetVisible(false);
 #endif
@@ -224,7 +443,14 @@ bool PlayerTesterApp::UserInit()
 
     // we can't instansiate the player in the constructor because on Android the CYIActivity is not available yet
 #if defined(YI_TIZEN_NACL)
-    m_pPlayer = std::unique_ptr<CYIVideojsVideoPlayer>(CYIVideojsVideoPlayer::Create());
+    std::unique_ptr<CYIVideojsVideoPlayer> pVideojsPlayer(CYIVideojsVideoPlayer::Create());
+    pVideojsPlayer->SetAsynchronousCommandsEnabled(true);
+    pVideojsPlayer->SetCommandBatchingEnabled(true);
+    pVideojsPlayer->SetCompactEventEncodingEnabled(true);
+    pVideojsPlayer->SetTimeUpdateIntervalMs(1000);
+    pVideojsPlayer->SetBridgeLatencyLogIntervalMs(60000);
+    pVideojsPlayer->SetAutomaticResolutionCapEnabled(true);
+    m_pPlayer = std::move(pVideojsPlayer);
 #else
     m_pPlayer = CYIDefaultVideoPlayerFactory::Create();
 #endif // YI_TIZEN_NACL
@@ -379,6 +605,9 @@ bool PlayerTesterApp::UserInit()
     YI_ASSERT(pBufferingView, LOG_TAG, "Could not find 'Buffering'");
     m_pBufferingController = new BufferingController(m_pPlayer.get(), pBufferingView, 700);
 
+    m_pScrubAccelerator = new ScrubAccelerator();
+    m_pScrubAccelerator->ScrubCommitted.Connect(*this, &PlayerTesterApp::HandleSeek);
+
     m_pErrorView = pMainComposition->GetNode<CYISceneView>("Error");
     YI_ASSERT(m_pErrorView, LOG_TAG, "Could not find 'Error'");
     m_pErrorView->Hide();
@@ -538,7 +767,9 @@ bool PlayerTesterApp::UserInit()
         pHeadphoneJackPauseButton->Disable();
     }
 
+    std::chrono::steady_clock::time_point videoSelectorStartTime = std::chrono::steady_clock::now();
     InitializeVideoSelector(pMainComposition);
+    YI_LOGI(LOG_TAG, "Video selector with %zu entries initialized in %lld ms.", m_possibleURLs.size(), static_cast<long long>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - videoSelectorStartTime).count()));
 
     return true;
 }
@@ -597,6 +828,22 @@ void PlayerTesterApp::UserUpdate()
 #endif
 }
 
+// Video.js treats a negative buffer length as a request for the engine default, so the prefilled -1 is parsed as signed
+// for it. The other players keep the unsigned parse they were written against.
+static CYIAbstractVideoPlayer::BufferLength ParseBufferLength(CYIAbstractVideoPlayer *pPlayer, const CYIString &minBufferLength, const CYIString &maxBufferLength)
+{
+#if defined(YI_TIZEN_NACL)
+    if (YiDynamicCast<CYIVideojsVideoPlayer>(pPlayer))
+    {
+        return CYIAbstractVideoPlayer::BufferLength(std::chrono::milliseconds(minBufferLength.To<int32_t>()), std::chrono::milliseconds(maxBufferLength.To<int32_t>()));
+    }
+#else
+    YI_UNUSED(pPlayer);
+#endif
+
+    return CYIAbstractVideoPlayer::BufferLength(std::chrono::milliseconds(minBufferLength.To<uint32_t>()), std::chrono::milliseconds(maxBufferLength.To<uint32_t>()));
+}
+
 static CYIString FormatToString(CYIAbstractVideoPlayer::StreamingFormat format)
 {
     switch (format)
@@ -1206,6 +1453,13 @@ void PlayerTesterApp::OnStartLowResButtonPressed()
     {
         pCastLabsPlayer->SetMaxResolution(glm::ivec2(640, 480));
     }
+#if defined(YI_TIZEN_NACL)
+    CYIVideojsVideoPlayer *pVideojsPlayer = YiDynamicCast<CYIVideojsVideoPlayer>(m_pPlayer.get());
+    if (pVideojsPlayer)
+    {
+        pVideojsPlayer->SetMaxResolution(glm::ivec2(640, 480));
+    }
+#endif
     OnStartButtonPressed();
 }
 
@@ -1221,6 +1475,7 @@ void PlayerTesterApp::OnPauseButtonPressed()
 
 void PlayerTesterApp::OnStopButtonPressed()
 {
+    m_pScrubAccelerator->Cancel();
     m_pPlayer->Stop();
     m_pPlayButton->Disable();
     m_pPauseButton->Disable();
@@ -1371,12 +1626,10 @@ void PlayerTesterApp::OnMinBufferLengthReturnPressed()
 {
     m_pMinBufferLengthButton->Show();
     m_pMinBufferLengthText->Hide();
-    uint32_t minBufferLength = m_pMinBufferLengthText->GetValue().To<uint32_t>();
-    uint32_t maxBufferLength = m_pMaxBufferLengthText->GetValue().To<uint32_t>();
     CYIAbstractVideoPlayer::BufferingInterface *pBufferingInterface = m_pPlayer->GetBufferingInterface();
     if (pBufferingInterface)
     {
-        pBufferingInterface->SetBufferLength(CYIAbstractVideoPlayer::BufferLength(std::chrono::milliseconds(minBufferLength), std::chrono::milliseconds(maxBufferLength)));
+        pBufferingInterface->SetBufferLength(ParseBufferLength(m_pPlayer.get(), m_pMinBufferLengthText->GetValue(), m_pMaxBufferLengthText->GetValue()));
     }
 }
 
@@ -1391,12 +1644,10 @@ void PlayerTesterApp::OnMaxBufferLengthReturnPressed()
 {
     m_pMaxBufferLengthButton->Show();
     m_pMaxBufferLengthText->Hide();
-    uint32_t minBufferLength = m_pMinBufferLengthText->GetValue().To<uint32_t>();
-    uint32_t maxBufferLength = m_pMaxBufferLengthText->GetValue().To<uint32_t>();
     CYIAbstractVideoPlayer::BufferingInterface *pBufferingInterface = m_pPlayer->GetBufferingInterface();
     if (pBufferingInterface)
     {
-        pBufferingInterface->SetBufferLength(CYIAbstractVideoPlayer::BufferLength(std::chrono::milliseconds(minBufferLength), std::chrono::milliseconds(maxBufferLength)));
+        pBufferingInterface->SetBufferLength(ParseBufferLength(m_pPlayer.get(), m_pMinBufferLengthText->GetValue(), m_pMaxBufferLengthText->GetValue()));
     }
 }
 
@@ -1489,6 +1740,10 @@ void PlayerTesterApp::OnAnimateButtonPressed()
 
 void PlayerTesterApp::OnSwitchToMiniViewButtonPressed()
 {
+#if defined(YI_TIZEN_NACL)
+    StopChannelZapping();
+#endif
+
     if (m_playerIsMini)
     {
         m_pPlayerSurfaceMiniView->SetVideoSurface(nullptr);
@@ -1689,14 +1944,14 @@ bool PlayerTesterApp::HandleEvent(const std::shared_ptr<CYIEventDispatcher> &pDi
                 case CYIKeyEvent::KeyCode::MediaRewind:
                     if (m_pPlayer->GetPlayerState() == CYIAbstractVideoPlayer::MediaState::Ready)
                     {
-                        OnSeekButtonPressed(static_cast<int32_t>(SeekButtonIndex::Reverse));
+                        m_pScrubAccelerator->Step(false, m_pPlayer->GetCurrentTimeMs(), GetScrubLimitMs());
                     }
                     handled = true;
                     break;
                 case CYIKeyEvent::KeyCode::MediaFastForward:
                     if (m_pPlayer->GetPlayerState() == CYIAbstractVideoPlayer::MediaState::Ready)
                     {
-                        OnSeekButtonPressed(static_cast<int32_t>(SeekButtonIndex::Forward));
+                        m_pScrubAccelerator->Step(true, m_pPlayer->GetCurrentTimeMs(), GetScrubLimitMs());
                     }
                     handled = true;
                     break;
@@ -1733,6 +1988,26 @@ bool PlayerTesterApp::HandleEvent(const std::shared_ptr<CYIEventDispatcher> &pDi
                     }
                     handled = true;
                     break;
+#if defined(YI_TIZEN_NACL)
+                case CYIKeyEvent::KeyCode::ChannelUp:
+                case CYIKeyEvent::KeyCode::ChannelDown:
+                    ZapChannel(pKeyEvent->m_keyCode == CYIKeyEvent::KeyCode::ChannelUp);
+                    handled = true;
+                    break;
+#endif
+                default:
+                    break;
+            }
+        }
+        else if (type == CYIEvent::Type::KeyUp)
+        {
+            switch (pKeyEvent->m_keyCode)
+            {
+                case CYIKeyEvent::KeyCode::MediaRewind:
+                case CYIKeyEvent::KeyCode::MediaFastForward:
+                    m_pScrubAccelerator->Release();
+                    handled = true;
+                    break;
                 default:
                     break;
             }
@@ -1742,8 +2017,141 @@ bool PlayerTesterApp::HandleEvent(const std::shared_ptr<CYIEventDispatcher> &pDi
     return handled;
 }
 
+#if defined(YI_TIZEN_NACL)
+void PlayerTesterApp::ZapChannel(bool up)
+{
+    if (m_playerIsMini)
+    {
+        YI_LOGW(LOG_TAG, "Channel zapping is only available in the full size view.");
+        return;
+    }
+
+    if (!m_pChannelZapper)
+    {
+        std::vector<UrlAndFormat> channels;
+
+        for (const UrlAndFormat &urlAndFormat : m_possibleURLs)
+        {
+            if (urlAndFormat.isLive && !urlAndFormat.isErrorUrl && urlAndFormat.dRMType == DRMType::None)
+            {
+                channels.push_back(urlAndFormat);
+            }
+        }
+
+        if (channels.empty())
+        {
+            YI_LOGW(LOG_TAG, "The catalog has no live entries to zap between.");
+            return;
+        }
+
+        // the pool players take over the surface view until a catalog entry is started again
+        m_pChannelZapper = new ChannelZapper(m_pPlayerSurfaceView, std::move(channels));
+
+        if (!m_pChannelZapper->Init())
+        {
+            YI_LOGE(LOG_TAG, "Channel zapping is unavailable, the player pool could not be created.");
+            delete m_pChannelZapper;
+            m_pChannelZapper = nullptr;
+            return;
+        }
+
+        if (m_pPlayer->GetPlayerState() == CYIAbstractVideoPlayer::MediaState::Ready)
+        {
+            m_pPlayer->Stop();
+        }
+
+        // warm zaps change the player attached to the surface view, so the tester follows whichever one is active
+        m_pChannelZapper->m_pool.ActivePlayerChanged.Connect(*this, &PlayerTesterApp::ZapPlayerChanged);
+        ZapPlayerChanged(m_pChannelZapper->m_pool.GetActivePlayer());
+    }
+
+    m_pChannelZapper->Zap(up);
+}
+
+void PlayerTesterApp::StopChannelZapping()
+{
+    if (!m_pChannelZapper)
+    {
+        return;
+    }
+
+    DisconnectZapPlayer();
+    m_pBufferingController->SetPlayer(m_pPlayer.get());
+
+    delete m_pChannelZapper;
+    m_pChannelZapper = nullptr;
+
+    m_pPlayerSurfaceView->SetVideoSurface(m_pPlayer->GetSurface());
+}
+
+void PlayerTesterApp::ZapPlayerChanged(CYIVideojsVideoPlayer *pPlayer)
+{
+    DisconnectZapPlayer();
+
+    m_pZapPlayer = pPlayer;
+    m_pZapPlayer->ErrorOccurred.Connect(*this, &PlayerTesterApp::ErrorOccured);
+    m_pZapPlayer->PlayerStateChanged.Connect(*this, &PlayerTesterApp::ZapPlayerStateChanged);
+    m_pBufferingController->SetPlayer(m_pZapPlayer);
+
+    ZapPlayerStateChanged(m_pZapPlayer->GetPlayerState());
+}
+
+void PlayerTesterApp::ZapPlayerStateChanged(const CYIAbstractVideoPlayer::PlayerState &state)
+{
+    // only the status is shown, the playback buttons keep controlling the catalog player
+    if (state == CYIAbstractVideoPlayer::MediaState::Unloaded)
+    {
+        m_pStatusText->SetText("Unloaded");
+    }
+    else if (state == CYIAbstractVideoPlayer::MediaState::Preparing)
+    {
+        m_pStatusText->SetText("Preparing");
+    }
+    else if (state == CYIAbstractVideoPlayer::PlaybackState::Playing)
+    {
+        m_pStatusText->SetText("Playing");
+    }
+    else if (state == CYIAbstractVideoPlayer::PlaybackState::Paused)
+    {
+        m_pStatusText->SetText("Paused");
+    }
+}
+
+void PlayerTesterApp::DisconnectZapPlayer()
+{
+    if (!m_pZapPlayer)
+    {
+        return;
+    }
+
+    m_pZapPlayer->ErrorOccurred.Disconnect(*this);
+    m_pZapPlayer->PlayerStateChanged.Disconnect(*this);
+    m_pZapPlayer = nullptr;
+}
+#endif
+
+uint64_t PlayerTesterApp::GetScrubLimitMs() const
+{
+#if defined(YI_TIZEN_NACL)
+    // the duration of a live stream does not bound the DVR window, scrubbing forward stops at the live edge instead
+    CYIVideojsVideoPlayer *pVideojsPlayer = YiDynamicCast<CYIVideojsVideoPlayer>(m_pPlayer.get());
+    if (pVideojsPlayer && m_pPlayer->GetStatistics().isLive)
+    {
+        return pVideojsPlayer->GetLiveEdgeMs();
+    }
+#endif
+    return m_pPlayer->GetDurationMs();
+}
+
 void PlayerTesterApp::PrepareVideo(UrlAndFormat toPrepare, uint64_t startTime)
 {
+    // a scrub started on the previous video must not seek the new one once the remote goes idle
+    m_pScrubAccelerator->Cancel();
+
+#if defined(YI_TIZEN_NACL)
+    StopChannelZapping();
+#endif
+
     std::unique_ptr<CYIAbstractVideoPlayer::DRMConfiguration> pDRMConfiguration;
     if (toPrepare.dRMType == DRMType::IStreamPlanetFairplay)
     {
@@ -13,13 +13,16 @@
 #endif
 
 class BufferingController;
+class ChannelZapper;
 class IStreamPlanetFairPlayHandler;
+class ScrubAccelerator;
 
 class CYIAbstractTimeline;
 class CYIPushButtonView;
 class CYISceneView;
 class CYITextSceneNode;
 class CYITextEditView;
+class CYIVideojsVideoPlayer;
 class CYIVideoSurfaceView;
 
 class PlayerTesterApp : public TestApp, public CYISignalHandler, public CYIEventHandler
@@ -121,6 +124,15 @@ private:
     void OnURLSelected(int32_t buttonID);
 
     void HandleSeek(uint64_t seekPositionMS);
+    uint64_t GetScrubLimitMs() const;
+
+#if defined(YI_TIZEN_NACL)
+    void ZapChannel(bool up);
+    void StopChannelZapping();
+    void ZapPlayerChanged(CYIVideojsVideoPlayer *pPlayer);
+    void ZapPlayerStateChanged(const CYIAbstractVideoPlayer::PlayerState &state);
+    void DisconnectZapPlayer();
+#endif
 
     std::unique_ptr<CYIAbstractVideoPlayer> m_pPlayer;
     CYIVideoSurfaceView *m_pPlayerSurfaceView;
@@ -129,6 +141,9 @@ private:
     CYISceneView *m_pErrorView;
 
     BufferingController *m_pBufferingController;
+    ScrubAccelerator *m_pScrubAccelerator;
+    ChannelZapper *m_pChannelZapper;
+    CYIVideojsVideoPlayer *m_pZapPlayer;
 
     CYIAbstractTimeline *m_pAnimateVideoTimeline;
     CYIAbstractTimeline *m_pShowVideoSelectorTimeline;
@@ -0,0 +1,68 @@
+// © You i Labs Inc. 2000-2019. All rights reserved.
+
+#ifndef _YI_VIDEOJS_ABR_CONTROLLER_H_
+#define _YI_VIDEOJS_ABR_CONTROLLER_H_
+
+/*!
+ \addtogroup video-player
+ @{
+ */
+
+#include <cstdint>
+#include <vector>
+
+/*!
+    \brief An adaptive bitrate controller that replaces the rendition selection heuristic of the Video.js player.
+
+    Once installed with CYIVideojsVideoPlayer::SetABRController, the web view reports a sample after every media segment
+    it downloads and fetches the segments that follow from the rendition the controller answers with. Without a controller
+    the Video.js streaming engine keeps selecting renditions itself.
+
+    The interface only uses standard types so that implementations can be built and tested on any platform, for example
+    by replaying recorded or simulated bandwidth traces.
+
+    \note Rendition caps and a rendition pinned with CYIVideojsVideoPlayer::SelectRendition take precedence. If the
+    controller answers with a rendition that they exclude, the streaming engine picks among the allowed renditions instead.
+*/
+class CYIVideojsABRController
+{
+public:
+    /*!
+        \details Describes a single downloaded media segment. The \a renditionId is the position in the ladder passed to
+        OnRenditionsChanged, \a mediaDurationMs is the amount of media the segment contains and \a bufferLengthMs is the
+        forward buffer ahead of the playhead once the segment was downloaded.
+    */
+    struct SegmentSample
+    {
+        uint32_t renditionId = 0;
+        uint64_t bytes = 0;
+        uint64_t downloadTimeMs = 0;
+        uint64_t mediaDurationMs = 0;
+        uint64_t bufferLengthMs = 0;
+    };
+
+    virtual ~CYIVideojsABRController() = default;
+
+    /*!
+        \details Called when the rendition ladder of a new source is known. \a bitratesKbps holds the bitrate of each
+        rendition indexed by rendition id, in ascending order. Any state kept about the previous source should be reset.
+    */
+    virtual void OnRenditionsChanged(const std::vector<uint64_t> &bitratesKbps) = 0;
+
+    /*!
+        \details Called after every media segment download with the measured \a sample. Returns the id of the rendition
+        that the next segments should be fetched from.
+
+        \note The answer reaches the web view asynchronously, so it usually applies from the segment after the one that
+        is already being requested. A different rendition is switched to right away, including upswitches the streaming
+        engine would otherwise hold back until its forward buffer reaches a low water mark, so protecting the buffer
+        before switching up is up to the controller.
+    */
+    virtual uint32_t OnSegmentDownloaded(const SegmentSample &sample) = 0;
+};
+
+/*!
+ @}
+ */
+
+#endif // _YI_VIDEOJS_ABR_CONTROLLER_H_
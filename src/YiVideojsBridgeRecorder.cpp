@@ -0,0 +1,173 @@
+#include "YiVideojsBridgeRecorder.h"
+
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#define LOG_TAG "CYIVideojsBridgeRecorder"
+
+static const uint64_t FLUSH_RECORD_INTERVAL = 64;
+
+const char *CYIVideojsBridgeRecorder::TIME_ATTRIBUTE_NAME = "t";
+const char *CYIVideojsBridgeRecorder::KIND_ATTRIBUTE_NAME = "k";
+const char *CYIVideojsBridgeRecorder::INSTANCE_ID_ATTRIBUTE_NAME = "i";
+const char *CYIVideojsBridgeRecorder::FUNCTION_NAME_ATTRIBUTE_NAME = "f";
+const char *CYIVideojsBridgeRecorder::ARGUMENTS_ATTRIBUTE_NAME = "a";
+const char *CYIVideojsBridgeRecorder::EVENT_ATTRIBUTE_NAME = "e";
+const char *CYIVideojsBridgeRecorder::LATENCY_ATTRIBUTE_NAME = "l";
+const char *CYIVideojsBridgeRecorder::OUTCOME_ATTRIBUTE_NAME = "o";
+const char *CYIVideojsBridgeRecorder::VERSION_ATTRIBUTE_NAME = "v";
+
+const char *CYIVideojsBridgeRecorder::HEADER_KIND = "h";
+const char *CYIVideojsBridgeRecorder::CALL_KIND = "c";
+const char *CYIVideojsBridgeRecorder::EVENT_KIND = "e";
+const char *CYIVideojsBridgeRecorder::RESPONSE_KIND = "r";
+
+CYIVideojsBridgeRecorder::CYIVideojsBridgeRecorder()
+    : m_recordCount(0)
+{
+}
+
+CYIVideojsBridgeRecorder::~CYIVideojsBridgeRecorder()
+{
+    Close();
+}
+
+template<typename WRITER>
+void CYIVideojsBridgeRecorder::BeginRecord(WRITER &writer, const char *pKind) const
+{
+    writer.StartObject();
+    writer.Key(TIME_ATTRIBUTE_NAME);
+    writer.Uint64(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_startTime).count()));
+    writer.Key(KIND_ATTRIBUTE_NAME);
+    writer.String(pKind);
+}
+
+bool CYIVideojsBridgeRecorder::Open(const CYIString &filePath)
+{
+    Close();
+
+    m_file.open(filePath.GetData(), std::ios::out | std::ios::app | std::ios::binary);
+
+    if (!m_file.is_open())
+    {
+        YI_LOGE(LOG_TAG, "Failed to open bridge recording file '%s' for writing.", filePath.GetData());
+        return false;
+    }
+
+    m_filePath = filePath;
+    m_startTime = std::chrono::steady_clock::now();
+    m_recordCount = 0;
+
+    // every session starts with a header so that several sessions can be appended to the same file
+    yi::rapidjson::StringBuffer buffer;
+    yi::rapidjson::Writer<yi::rapidjson::StringBuffer> writer(buffer);
+
+    BeginRecord(writer, HEADER_KIND);
+    writer.Key(VERSION_ATTRIBUTE_NAME);
+    writer.Int(RECORDING_FORMAT_VERSION);
+    writer.EndObject();
+
+    WriteRecord(buffer.GetString(), buffer.GetSize());
+
+    YI_LOGI(LOG_TAG, "Recording bridge traffic to '%s'.", filePath.GetData());
+
+    return true;
+}
+
+void CYIVideojsBridgeRecorder::Close()
+{
+    if (!m_file.is_open())
+    {
+        return;
+    }
+
+    m_file.close();
+
+    YI_LOGI(LOG_TAG, "Stopped recording bridge traffic to '%s' after %llu records.", m_filePath.GetData(), static_cast<unsigned long long>(m_recordCount));
+}
+
+bool CYIVideojsBridgeRecorder::IsOpen() const
+{
+    return m_file.is_open();
+}
+
+void CYIVideojsBridgeRecorder::RecordCall(int32_t instanceId, const CYIString &functionName, const yi::rapidjson::Value &functionArgumentsValue)
+{
+    if (!m_file.is_open())
+    {
+        return;
+    }
+
+    yi::rapidjson::StringBuffer buffer;
+    yi::rapidjson::Writer<yi::rapidjson::StringBuffer> writer(buffer);
+
+    BeginRecord(writer, CALL_KIND);
+    writer.Key(INSTANCE_ID_ATTRIBUTE_NAME);
+    writer.Int(instanceId);
+    writer.Key(FUNCTION_NAME_ATTRIBUTE_NAME);
+    writer.String(functionName.GetData(), static_cast<yi::rapidjson::SizeType>(functionName.GetLength()));
+    writer.Key(ARGUMENTS_ATTRIBUTE_NAME);
+    functionArgumentsValue.Accept(writer);
+    writer.EndObject();
+
+    WriteRecord(buffer.GetString(), buffer.GetSize());
+}
+
+void CYIVideojsBridgeRecorder::RecordEvent(const yi::rapidjson::Value &eventValue)
+{
+    if (!m_file.is_open())
+    {
+        return;
+    }
+
+    yi::rapidjson::StringBuffer buffer;
+    yi::rapidjson::Writer<yi::rapidjson::StringBuffer> writer(buffer);
+
+    BeginRecord(writer, EVENT_KIND);
+    writer.Key(EVENT_ATTRIBUTE_NAME);
+    eventValue.Accept(writer);
+    writer.EndObject();
+
+    WriteRecord(buffer.GetString(), buffer.GetSize());
+}
+
+void CYIVideojsBridgeRecorder::RecordResponse(const CYIString &functionName, uint32_t latencyMs, const char *pOutcome)
+{
+    if (!m_file.is_open())
+    {
+        return;
+    }
+
+    yi::rapidjson::StringBuffer buffer;
+    yi::rapidjson::Writer<yi::rapidjson::StringBuffer> writer(buffer);
+
+    BeginRecord(writer, RESPONSE_KIND);
+    writer.Key(FUNCTION_NAME_ATTRIBUTE_NAME);
+    writer.String(functionName.GetData(), static_cast<yi::rapidjson::SizeType>(functionName.GetLength()));
+    writer.Key(LATENCY_ATTRIBUTE_NAME);
+    writer.Uint(latencyMs);
+    writer.Key(OUTCOME_ATTRIBUTE_NAME);
+    writer.String(pOutcome);
+    writer.EndObject();
+
+    WriteRecord(buffer.GetString(), buffer.GetSize());
+}
+
+uint64_t CYIVideojsBridgeRecorder::GetRecordCount() const
+{
+    return m_recordCount;
+}
+
+void CYIVideojsBridgeRecorder::WriteRecord(const char *pRecord, size_t length)
+{
+    m_file.write(pRecord, static_cast<std::streamsize>(length));
+    m_file.put('\n');
+
+    m_recordCount++;
+
+    // flushing in small groups keeps the recording cheap while limiting what is lost if the application is killed
+    if (m_recordCount % FLUSH_RECORD_INTERVAL == 0)
+    {
+        m_file.flush();
+    }
+}
@@ -0,0 +1,53 @@
+#ifndef _YI_VIDEOJS_BRIDGE_RECORDER_H_
+#define _YI_VIDEOJS_BRIDGE_RECORDER_H_
+
+#include <utility/YiRapidJSONUtility.h>
+
+#include <chrono>
+#include <fstream>
+
+class CYIVideojsBridgeRecorder
+{
+public:
+    static const int32_t RECORDING_FORMAT_VERSION = 1;
+
+    static const char *TIME_ATTRIBUTE_NAME;
+    static const char *KIND_ATTRIBUTE_NAME;
+    static const char *INSTANCE_ID_ATTRIBUTE_NAME;
+    static const char *FUNCTION_NAME_ATTRIBUTE_NAME;
+    static const char *ARGUMENTS_ATTRIBUTE_NAME;
+    static const char *EVENT_ATTRIBUTE_NAME;
+    static const char *LATENCY_ATTRIBUTE_NAME;
+    static const char *OUTCOME_ATTRIBUTE_NAME;
+    static const char *VERSION_ATTRIBUTE_NAME;
+
+    static const char *HEADER_KIND;
+    static const char *CALL_KIND;
+    static const char *EVENT_KIND;
+    static const char *RESPONSE_KIND;
+
+    CYIVideojsBridgeRecorder();
+    ~CYIVideojsBridgeRecorder();
+
+    bool Open(const CYIString &filePath);
+    void Close();
+    bool IsOpen() const;
+
+    void RecordCall(int32_t instanceId, const CYIString &functionName, const yi::rapidjson::Value &functionArgumentsValue);
+    void RecordEvent(const yi::rapidjson::Value &eventValue);
+    void RecordResponse(const CYIString &functionName, uint32_t latencyMs, const char *pOutcome);
+
+    uint64_t GetRecordCount() const;
+
+private:
+    template<typename WRITER>
+    void BeginRecord(WRITER &writer, const char *pKind) const;
+    void WriteRecord(const char *pRecord, size_t length);
+
+    std::ofstream m_file;
+    CYIString m_filePath;
+    std::chrono::steady_clock::time_point m_startTime;
+    uint64_t m_recordCount;
+};
+
+#endif // _YI_VIDEOJS_BRIDGE_RECORDER_H_
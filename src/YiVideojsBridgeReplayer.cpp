@@ -0,0 +1,243 @@
+#include "YiVideojsBridgeReplayer.h"
+
+#include "YiVideojsBridgeRecorder.h"
+#include "YiVideojsVideoPlayerPriv.h"
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#define LOG_TAG "CYIVideojsBridgeReplayer"
+
+static const char *INSTANCE_ID_ATTRIBUTE_NAME = "instanceId";
+static const uint32_t REPLAY_TICK_INTERVAL_MS = 4;
+
+CYIVideojsBridgeReplayer::CYIVideojsBridgeReplayer()
+    : m_nextEventIndex(0)
+    , m_instanceIdOverride(-1)
+    , m_running(false)
+{
+    m_replayTimer.TimedOut.Connect(*this, &CYIVideojsBridgeReplayer::OnReplayTimerTimedOut);
+}
+
+CYIVideojsBridgeReplayer::~CYIVideojsBridgeReplayer()
+{
+    Stop();
+}
+
+bool CYIVideojsBridgeReplayer::Load(const CYIString &filePath)
+{
+    Stop();
+
+    m_events.clear();
+    m_nextEventIndex = 0;
+    m_statistics = Statistics();
+
+    std::ifstream file(filePath.GetData(), std::ios::in | std::ios::binary);
+
+    if (!file.is_open())
+    {
+        YI_LOGE(LOG_TAG, "Failed to open bridge recording file '%s' for reading.", filePath.GetData());
+        return false;
+    }
+
+    std::string line;
+    uint64_t lineNumber = 0;
+    uint64_t sessionOffsetUs = 0;
+    uint64_t lastTimeUs = 0;
+
+    while (std::getline(file, line))
+    {
+        lineNumber++;
+
+        if (line.empty())
+        {
+            continue;
+        }
+
+        yi::rapidjson::Document record;
+        record.Parse(line.c_str());
+
+        if (record.HasParseError() || !record.IsObject() || !record.HasMember(CYIVideojsBridgeRecorder::KIND_ATTRIBUTE_NAME) || !record[CYIVideojsBridgeRecorder::KIND_ATTRIBUTE_NAME].IsString() || !record.HasMember(CYIVideojsBridgeRecorder::TIME_ATTRIBUTE_NAME) || !record[CYIVideojsBridgeRecorder::TIME_ATTRIBUTE_NAME].IsUint64())
+        {
+            YI_LOGW(LOG_TAG, "Skipping invalid bridge recording record on line %llu of '%s'.", static_cast<unsigned long long>(lineNumber), filePath.GetData());
+            continue;
+        }
+
+        const CYIString kind(record[CYIVideojsBridgeRecorder::KIND_ATTRIBUTE_NAME].GetString());
+        const uint64_t timeUs = record[CYIVideojsBridgeRecorder::TIME_ATTRIBUTE_NAME].GetUint64();
+
+        // appended sessions each restart their clock at zero, so they are laid out back to back
+        if (kind == CYIVideojsBridgeRecorder::HEADER_KIND)
+        {
+            if (record.HasMember(CYIVideojsBridgeRecorder::VERSION_ATTRIBUTE_NAME) && (!record[CYIVideojsBridgeRecorder::VERSION_ATTRIBUTE_NAME].IsInt() || record[CYIVideojsBridgeRecorder::VERSION_ATTRIBUTE_NAME].GetInt() != CYIVideojsBridgeRecorder::RECORDING_FORMAT_VERSION))
+            {
+                YI_LOGE(LOG_TAG, "Bridge recording '%s' uses unsupported format version %s.", filePath.GetData(), CYIRapidJSONUtility::CreateStringFromValue(record[CYIVideojsBridgeRecorder::VERSION_ATTRIBUTE_NAME]).GetData());
+                m_events.clear();
+                return false;
+            }
+
+            sessionOffsetUs = lastTimeUs;
+            continue;
+        }
+
+        lastTimeUs = sessionOffsetUs + timeUs;
+
+        if (kind == CYIVideojsBridgeRecorder::CALL_KIND)
+        {
+            m_statistics.recordedCalls++;
+        }
+        else if (kind == CYIVideojsBridgeRecorder::RESPONSE_KIND)
+        {
+            m_statistics.recordedResponses++;
+        }
+        else if (kind == CYIVideojsBridgeRecorder::EVENT_KIND && record.HasMember(CYIVideojsBridgeRecorder::EVENT_ATTRIBUTE_NAME))
+        {
+            RecordedEvent recordedEvent;
+            recordedEvent.timeUs = lastTimeUs;
+            recordedEvent.pEvent.reset(new yi::rapidjson::Document());
+            recordedEvent.pEvent->CopyFrom(record[CYIVideojsBridgeRecorder::EVENT_ATTRIBUTE_NAME], recordedEvent.pEvent->GetAllocator());
+
+            m_events.push_back(std::move(recordedEvent));
+        }
+    }
+
+    m_statistics.recordedEvents = m_events.size();
+    m_statistics.recordedDurationUs = lastTimeUs;
+
+    YI_LOGI(LOG_TAG, "Loaded %llu events, %llu calls and %llu responses spanning %llu ms from '%s'.", static_cast<unsigned long long>(m_statistics.recordedEvents), static_cast<unsigned long long>(m_statistics.recordedCalls), static_cast<unsigned long long>(m_statistics.recordedResponses), static_cast<unsigned long long>(lastTimeUs / 1000), filePath.GetData());
+
+    return true;
+}
+
+void CYIVideojsBridgeReplayer::SetInstanceIdOverride(int32_t instanceId)
+{
+    m_instanceIdOverride = instanceId;
+}
+
+CYIVideojsBridgeReplayer::Statistics CYIVideojsBridgeReplayer::RunAtMaximumSpeed()
+{
+    Stop();
+
+    m_statistics.eventsReplayed = 0;
+    m_statistics.maximumEventLatenessUs = 0;
+    m_statistics.totalEventLatenessUs = 0;
+
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+    for (RecordedEvent &recordedEvent : m_events)
+    {
+        DispatchEvent(recordedEvent);
+    }
+
+    m_statistics.replayDurationNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count());
+
+    YI_LOGI(LOG_TAG, "Replayed %llu events at maximum speed in %llu us.", static_cast<unsigned long long>(m_statistics.eventsReplayed), static_cast<unsigned long long>(m_statistics.replayDurationNs / 1000));
+
+    return m_statistics;
+}
+
+CYIVideojsBridgeReplayer::Statistics CYIVideojsBridgeReplayer::RunAtOriginalSpeed()
+{
+    Stop();
+
+    m_statistics.eventsReplayed = 0;
+    m_statistics.maximumEventLatenessUs = 0;
+    m_statistics.totalEventLatenessUs = 0;
+
+    // blocks the calling thread for the length of the recording, for tools that run without an application loop
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+    for (RecordedEvent &recordedEvent : m_events)
+    {
+        std::this_thread::sleep_until(startTime + std::chrono::microseconds(recordedEvent.timeUs));
+
+        uint64_t elapsedUs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count());
+        RecordLateness(elapsedUs > recordedEvent.timeUs ? elapsedUs - recordedEvent.timeUs : 0);
+
+        DispatchEvent(recordedEvent);
+    }
+
+    m_statistics.replayDurationNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count());
+
+    YI_LOGI(LOG_TAG, "Replayed %llu events at original speed, the latest event was delivered %llu us late.", static_cast<unsigned long long>(m_statistics.eventsReplayed), static_cast<unsigned long long>(m_statistics.maximumEventLatenessUs));
+
+    return m_statistics;
+}
+
+void CYIVideojsBridgeReplayer::Start()
+{
+    Stop();
+
+    m_nextEventIndex = 0;
+    m_statistics.eventsReplayed = 0;
+    m_statistics.maximumEventLatenessUs = 0;
+    m_statistics.totalEventLatenessUs = 0;
+    m_startTime = std::chrono::steady_clock::now();
+    m_running = true;
+
+    OnReplayTimerTimedOut();
+}
+
+void CYIVideojsBridgeReplayer::Stop()
+{
+    m_replayTimer.Stop();
+    m_running = false;
+}
+
+bool CYIVideojsBridgeReplayer::IsRunning() const
+{
+    return m_running;
+}
+
+const CYIVideojsBridgeReplayer::Statistics &CYIVideojsBridgeReplayer::GetStatistics() const
+{
+    return m_statistics;
+}
+
+void CYIVideojsBridgeReplayer::DispatchEvent(RecordedEvent &recordedEvent)
+{
+    if (m_instanceIdOverride >= 0 && recordedEvent.pEvent->IsObject() && recordedEvent.pEvent->HasMember(INSTANCE_ID_ATTRIBUTE_NAME))
+    {
+        (*recordedEvent.pEvent)[INSTANCE_ID_ATTRIBUTE_NAME].SetInt(m_instanceIdOverride);
+    }
+
+    // events are routed exactly as the web messaging bridge would route them, through the shared player event handler
+    CYIVideojsVideoPlayerPriv::OnPlayerEvent(*recordedEvent.pEvent);
+
+    m_statistics.eventsReplayed++;
+}
+
+void CYIVideojsBridgeReplayer::RecordLateness(uint64_t latenessUs)
+{
+    m_statistics.maximumEventLatenessUs = std::max(m_statistics.maximumEventLatenessUs, latenessUs);
+    m_statistics.totalEventLatenessUs += latenessUs;
+}
+
+void CYIVideojsBridgeReplayer::OnReplayTimerTimedOut()
+{
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    uint64_t elapsedUs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(now - m_startTime).count());
+
+    while (m_nextEventIndex < m_events.size() && m_events[m_nextEventIndex].timeUs <= elapsedUs)
+    {
+        RecordLateness(elapsedUs - m_events[m_nextEventIndex].timeUs);
+
+        DispatchEvent(m_events[m_nextEventIndex++]);
+    }
+
+    if (m_nextEventIndex >= m_events.size())
+    {
+        m_statistics.replayDurationNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_startTime).count());
+
+        YI_LOGI(LOG_TAG, "Replayed %llu events at original speed, the latest event was delivered %llu us late.", static_cast<unsigned long long>(m_statistics.eventsReplayed), static_cast<unsigned long long>(m_statistics.maximumEventLatenessUs));
+
+        m_running = false;
+
+        Finished.Emit();
+        return;
+    }
+
+    m_replayTimer.Start(REPLAY_TICK_INTERVAL_MS);
+}
@@ -0,0 +1,65 @@
+#ifndef _YI_VIDEOJS_BRIDGE_REPLAYER_H_
+#define _YI_VIDEOJS_BRIDGE_REPLAYER_H_
+
+#include <signal/YiSignal.h>
+#include <signal/YiSignalHandler.h>
+#include <utility/YiRapidJSONUtility.h>
+#include <utility/YiTimer.h>
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+class CYIVideojsBridgeReplayer : public CYISignalHandler
+{
+public:
+    struct Statistics
+    {
+        uint64_t recordedCalls = 0;
+        uint64_t recordedResponses = 0;
+        uint64_t recordedEvents = 0;
+        uint64_t recordedDurationUs = 0;
+        uint64_t eventsReplayed = 0;
+        uint64_t replayDurationNs = 0;
+        uint64_t maximumEventLatenessUs = 0;
+        uint64_t totalEventLatenessUs = 0;
+    };
+
+    CYIVideojsBridgeReplayer();
+    virtual ~CYIVideojsBridgeReplayer();
+
+    bool Load(const CYIString &filePath);
+
+    void SetInstanceIdOverride(int32_t instanceId);
+
+    Statistics RunAtMaximumSpeed();
+    Statistics RunAtOriginalSpeed();
+    void Start();
+    void Stop();
+    bool IsRunning() const;
+
+    const Statistics &GetStatistics() const;
+
+    CYISignal<> Finished;
+
+private:
+    struct RecordedEvent
+    {
+        uint64_t timeUs;
+        std::unique_ptr<yi::rapidjson::Document> pEvent;
+    };
+
+    void DispatchEvent(RecordedEvent &recordedEvent);
+    void RecordLateness(uint64_t latenessUs);
+    void OnReplayTimerTimedOut();
+
+    std::vector<RecordedEvent> m_events;
+    size_t m_nextEventIndex;
+    int32_t m_instanceIdOverride;
+    bool m_running;
+    Statistics m_statistics;
+    std::chrono::steady_clock::time_point m_startTime;
+    CYITimer m_replayTimer;
+};
+
+#endif // _YI_VIDEOJS_BRIDGE_REPLAYER_H_
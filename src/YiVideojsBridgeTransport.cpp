@@ -0,0 +1,138 @@
+#include "YiVideojsBridgeTransport.h"
+
+#include <platform/YiWebBridgeLocator.h>
+
+#define LOG_TAG "CYIVideojsBridgeTransport"
+
+static std::unique_ptr<CYIVideojsBridgeTransport> s_pTransport;
+
+CYIVideojsBridgeTransport::Response::Response()
+    : m_hasError(false)
+{
+}
+
+CYIVideojsBridgeTransport::Response::Response(CYIWebMessagingBridge::Response &&bridgeResponse)
+    : m_pBridgeResponse(new CYIWebMessagingBridge::Response(std::move(bridgeResponse)))
+    , m_hasError(m_pBridgeResponse->HasError())
+{
+}
+
+CYIVideojsBridgeTransport::Response::Response(std::shared_ptr<const yi::rapidjson::Document> pResult, const CYIString &errorMessage)
+    : m_pResult(std::move(pResult))
+    , m_errorMessage(errorMessage)
+    , m_hasError(!errorMessage.IsEmpty())
+{
+}
+
+bool CYIVideojsBridgeTransport::Response::HasError() const
+{
+    return m_hasError;
+}
+
+CYIString CYIVideojsBridgeTransport::Response::GetErrorMessage() const
+{
+    if (m_pBridgeResponse && m_pBridgeResponse->HasError())
+    {
+        return m_pBridgeResponse->GetError()->GetMessage();
+    }
+
+    return m_errorMessage;
+}
+
+const yi::rapidjson::Value *CYIVideojsBridgeTransport::Response::GetResult() const
+{
+    static const yi::rapidjson::Value NULL_RESULT;
+
+    if (m_pBridgeResponse)
+    {
+        return m_pBridgeResponse->GetResult();
+    }
+
+    return m_pResult ? m_pResult.get() : &NULL_RESULT;
+}
+
+CYIVideojsBridgeTransport::FutureResponse::FutureResponse()
+{
+}
+
+CYIVideojsBridgeTransport::FutureResponse::FutureResponse(CYIWebMessagingBridge::FutureResponse &&bridgeFutureResponse)
+    : m_pBridgeFutureResponse(new CYIWebMessagingBridge::FutureResponse(std::move(bridgeFutureResponse)))
+{
+}
+
+CYIVideojsBridgeTransport::FutureResponse::FutureResponse(std::unique_ptr<PendingResponse> pPendingResponse)
+    : m_pPendingResponse(std::move(pPendingResponse))
+{
+}
+
+CYIVideojsBridgeTransport::Response CYIVideojsBridgeTransport::FutureResponse::Take(uint32_t timeoutMs, bool *pValueAssigned)
+{
+    Response response;
+    bool valueAssigned = false;
+
+    if (m_pPendingResponse)
+    {
+        valueAssigned = m_pPendingResponse->Take(timeoutMs, response);
+    }
+    else if (m_pBridgeFutureResponse)
+    {
+        CYIWebMessagingBridge::Response bridgeResponse = m_pBridgeFutureResponse->Take(timeoutMs, &valueAssigned);
+
+        if (valueAssigned)
+        {
+            response = Response(std::move(bridgeResponse));
+        }
+    }
+
+    if (pValueAssigned)
+    {
+        *pValueAssigned = valueAssigned;
+    }
+
+    return response;
+}
+
+CYIVideojsBridgeTransport *CYIVideojsBridgeTransport::GetTransport()
+{
+    if (!s_pTransport)
+    {
+        s_pTransport.reset(new CYIVideojsWebMessagingBridgeTransport());
+    }
+
+    return s_pTransport.get();
+}
+
+std::unique_ptr<CYIVideojsBridgeTransport> CYIVideojsBridgeTransport::SetTransport(std::unique_ptr<CYIVideojsBridgeTransport> pTransport)
+{
+    std::unique_ptr<CYIVideojsBridgeTransport> pPreviousTransport(std::move(s_pTransport));
+    s_pTransport = std::move(pTransport);
+
+    return pPreviousTransport;
+}
+
+bool CYIVideojsWebMessagingBridgeTransport::IsAvailable() const
+{
+    return CYIWebBridgeLocator::GetWebMessagingBridge() != nullptr;
+}
+
+CYIVideojsBridgeTransport::FutureResponse CYIVideojsWebMessagingBridgeTransport::CallStaticFunction(yi::rapidjson::Document &&message, const CYIString &className, const CYIString &functionName, yi::rapidjson::Value &&functionArgumentsValue, bool *pMessageSent)
+{
+    // the bridge serializes the message before it returns, so a message built in a pooled document is passed as is
+    return FutureResponse(CYIWebBridgeLocator::GetWebMessagingBridge()->CallStaticFunctionWithArgs(std::move(message), className, functionName, std::move(functionArgumentsValue), pMessageSent));
+}
+
+CYIVideojsBridgeTransport::FutureResponse CYIVideojsWebMessagingBridgeTransport::CallInstanceFunction(yi::rapidjson::Document &&message, const CYIString &className, const CYIString &instanceAccessorName, const CYIString &functionName, yi::rapidjson::Value &&functionArgumentsValue, yi::rapidjson::Value &&instanceAccessorArgumentsValue, bool *pMessageSent)
+{
+    // the bridge serializes the message before it returns, so a message built in a pooled document is passed as is
+    return FutureResponse(CYIWebBridgeLocator::GetWebMessagingBridge()->CallInstanceFunctionWithArgs(std::move(message), className, instanceAccessorName, functionName, std::move(functionArgumentsValue), std::move(instanceAccessorArgumentsValue), pMessageSent));
+}
+
+uint64_t CYIVideojsWebMessagingBridgeTransport::RegisterEventHandler(yi::rapidjson::Document &&filterDocument, CYIWebMessagingBridge::EventCallback &&eventCallback)
+{
+    return CYIWebBridgeLocator::GetWebMessagingBridge()->RegisterEventHandler(std::move(filterDocument), std::move(eventCallback));
+}
+
+void CYIVideojsWebMessagingBridgeTransport::UnregisterEventHandler(uint64_t eventHandlerId)
+{
+    CYIWebBridgeLocator::GetWebMessagingBridge()->UnregisterEventHandler(eventHandlerId);
+}
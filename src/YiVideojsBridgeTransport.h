@@ -0,0 +1,76 @@
+#ifndef _YI_VIDEOJS_BRIDGE_TRANSPORT_H_
+#define _YI_VIDEOJS_BRIDGE_TRANSPORT_H_
+
+#include <platform/YiWebMessagingBridge.h>
+#include <utility/YiRapidJSONUtility.h>
+
+#include <memory>
+
+class CYIVideojsBridgeTransport
+{
+public:
+    class Response
+    {
+    public:
+        Response();
+        explicit Response(CYIWebMessagingBridge::Response &&bridgeResponse);
+        Response(std::shared_ptr<const yi::rapidjson::Document> pResult, const CYIString &errorMessage);
+
+        bool HasError() const;
+        CYIString GetErrorMessage() const;
+        const yi::rapidjson::Value *GetResult() const;
+
+    private:
+        std::unique_ptr<CYIWebMessagingBridge::Response> m_pBridgeResponse;
+        std::shared_ptr<const yi::rapidjson::Document> m_pResult;
+        CYIString m_errorMessage;
+        bool m_hasError;
+    };
+
+    class PendingResponse
+    {
+    public:
+        virtual ~PendingResponse() = default;
+        virtual bool Take(uint32_t timeoutMs, Response &response) = 0;
+    };
+
+    class FutureResponse
+    {
+    public:
+        FutureResponse();
+        explicit FutureResponse(CYIWebMessagingBridge::FutureResponse &&bridgeFutureResponse);
+        explicit FutureResponse(std::unique_ptr<PendingResponse> pPendingResponse);
+
+        Response Take(uint32_t timeoutMs, bool *pValueAssigned);
+
+    private:
+        std::unique_ptr<CYIWebMessagingBridge::FutureResponse> m_pBridgeFutureResponse;
+        std::unique_ptr<PendingResponse> m_pPendingResponse;
+    };
+
+    virtual ~CYIVideojsBridgeTransport() = default;
+
+    virtual bool IsAvailable() const = 0;
+
+    // the message and argument values may be allocated from a pooled document that the caller only holds until the call
+    // returns, so implementations must be done with them, for example by serializing the message, before returning
+    virtual FutureResponse CallStaticFunction(yi::rapidjson::Document &&message, const CYIString &className, const CYIString &functionName, yi::rapidjson::Value &&functionArgumentsValue, bool *pMessageSent) = 0;
+    virtual FutureResponse CallInstanceFunction(yi::rapidjson::Document &&message, const CYIString &className, const CYIString &instanceAccessorName, const CYIString &functionName, yi::rapidjson::Value &&functionArgumentsValue, yi::rapidjson::Value &&instanceAccessorArgumentsValue, bool *pMessageSent) = 0;
+    virtual uint64_t RegisterEventHandler(yi::rapidjson::Document &&filterDocument, CYIWebMessagingBridge::EventCallback &&eventCallback) = 0;
+    virtual void UnregisterEventHandler(uint64_t eventHandlerId) = 0;
+
+    static CYIVideojsBridgeTransport *GetTransport();
+    static std::unique_ptr<CYIVideojsBridgeTransport> SetTransport(std::unique_ptr<CYIVideojsBridgeTransport> pTransport);
+};
+
+class CYIVideojsWebMessagingBridgeTransport : public CYIVideojsBridgeTransport
+{
+public:
+    virtual bool IsAvailable() const override;
+    virtual FutureResponse CallStaticFunction(yi::rapidjson::Document &&message, const CYIString &className, const CYIString &functionName, yi::rapidjson::Value &&functionArgumentsValue, bool *pMessageSent) override;
+    virtual FutureResponse CallInstanceFunction(yi::rapidjson::Document &&message, const CYIString &className, const CYIString &instanceAccessorName, const CYIString &functionName, yi::rapidjson::Value &&functionArgumentsValue, yi::rapidjson::Value &&instanceAccessorArgumentsValue, bool *pMessageSent) override;
+    virtual uint64_t RegisterEventHandler(yi::rapidjson::Document &&filterDocument, CYIWebMessagingBridge::EventCallback &&eventCallback) override;
+    virtual void UnregisterEventHandler(uint64_t eventHandlerId) override;
+};
+
+#endif // _YI_VIDEOJS_BRIDGE_TRANSPORT_H_
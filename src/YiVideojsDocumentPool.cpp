@@ -0,0 +1,140 @@
+#include "YiVideojsDocumentPool.h"
+
+#include <algorithm>
+
+#define LOG_TAG "CYIVideojsDocumentPool"
+
+static const size_t NO_SLOT = static_cast<size_t>(-1);
+
+CYIVideojsDocumentPool::Lease::Lease()
+    : m_pPool(nullptr)
+    , m_slotIndex(NO_SLOT)
+{
+}
+
+CYIVideojsDocumentPool::Lease::Lease(CYIVideojsDocumentPool *pPool, size_t slotIndex)
+    : m_pPool(pPool)
+    , m_slotIndex(slotIndex)
+{
+}
+
+CYIVideojsDocumentPool::Lease::Lease(Lease &&other)
+    : m_pPool(other.m_pPool)
+    , m_slotIndex(other.m_slotIndex)
+{
+    other.m_pPool = nullptr;
+    other.m_slotIndex = NO_SLOT;
+}
+
+CYIVideojsDocumentPool::Lease::~Lease()
+{
+    Release();
+}
+
+CYIVideojsDocumentPool::Lease &CYIVideojsDocumentPool::Lease::operator=(Lease &&other)
+{
+    if (this != &other)
+    {
+        Release();
+
+        m_pPool = other.m_pPool;
+        m_slotIndex = other.m_slotIndex;
+
+        other.m_pPool = nullptr;
+        other.m_slotIndex = NO_SLOT;
+    }
+
+    return *this;
+}
+
+CYIVideojsDocumentPool::Allocator *CYIVideojsDocumentPool::Lease::GetAllocator() const
+{
+    // a null allocator makes the document create and own a heap allocator, which is the fallback when the pool is exhausted
+    return m_pPool && m_slotIndex != NO_SLOT ? m_pPool->m_slots[m_slotIndex].pAllocator.get() : nullptr;
+}
+
+void CYIVideojsDocumentPool::Lease::Release()
+{
+    if (m_pPool && m_slotIndex != NO_SLOT)
+    {
+        m_pPool->Release(m_slotIndex);
+    }
+
+    m_pPool = nullptr;
+    m_slotIndex = NO_SLOT;
+}
+
+CYIVideojsDocumentPool::CYIVideojsDocumentPool(size_t slotCount, size_t chunkSize)
+    : m_slots(slotCount)
+    , m_chunkSize(chunkSize)
+{
+    m_freeSlots.reserve(slotCount);
+
+    for (size_t i = 0; i < slotCount; ++i)
+    {
+        Slot &slot = m_slots[i];
+        slot.pBuffer.reset(new char[chunkSize]);
+        slot.pAllocator.reset(new Allocator(slot.pBuffer.get(), chunkSize, chunkSize));
+
+        // slots are handed out from the back, so the lowest slot is used first
+        m_freeSlots.push_back(slotCount - 1 - i);
+    }
+
+    m_statistics.slotCount = static_cast<uint32_t>(slotCount);
+    m_statistics.chunkSize = chunkSize;
+}
+
+CYIVideojsDocumentPool::Lease CYIVideojsDocumentPool::Acquire()
+{
+    m_statistics.leases++;
+
+    if (m_freeSlots.empty())
+    {
+        m_statistics.exhaustedLeases++;
+
+        YI_LOGD(LOG_TAG, "All %u document pool slots are in use, falling back to a heap allocated document.", m_statistics.slotCount);
+        return Lease();
+    }
+
+    size_t slotIndex = m_freeSlots.back();
+    m_freeSlots.pop_back();
+
+    m_statistics.slotsInUse++;
+    m_statistics.highWaterSlotsInUse = std::max(m_statistics.highWaterSlotsInUse, m_statistics.slotsInUse);
+
+    return Lease(this, slotIndex);
+}
+
+void CYIVideojsDocumentPool::Release(size_t slotIndex)
+{
+    Allocator &allocator = *m_slots[slotIndex].pAllocator;
+
+    m_statistics.highWaterBytesUsed = std::max(m_statistics.highWaterBytesUsed, allocator.Size());
+
+    if (allocator.Capacity() > m_chunkSize)
+    {
+        m_statistics.chunkOverflows++;
+    }
+
+    // clearing keeps the pre-sized buffer and only returns the overflow chunks, if any, to the heap
+    allocator.Clear();
+
+    m_freeSlots.push_back(slotIndex);
+    m_statistics.slotsInUse--;
+}
+
+CYIVideojsDocumentPool::Statistics CYIVideojsDocumentPool::GetStatistics() const
+{
+    return m_statistics;
+}
+
+void CYIVideojsDocumentPool::ResetStatistics()
+{
+    uint32_t slotsInUse = m_statistics.slotsInUse;
+
+    m_statistics = Statistics();
+    m_statistics.slotCount = static_cast<uint32_t>(m_slots.size());
+    m_statistics.slotsInUse = slotsInUse;
+    m_statistics.highWaterSlotsInUse = slotsInUse;
+    m_statistics.chunkSize = m_chunkSize;
+}
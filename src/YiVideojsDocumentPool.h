@@ -0,0 +1,76 @@
+#ifndef _YI_VIDEOJS_DOCUMENT_POOL_H_
+#define _YI_VIDEOJS_DOCUMENT_POOL_H_
+
+#include <utility/YiRapidJSONUtility.h>
+
+#include <memory>
+#include <vector>
+
+class CYIVideojsDocumentPool
+{
+public:
+    static const size_t DEFAULT_SLOT_COUNT = 4;
+    static const size_t DEFAULT_CHUNK_SIZE = 4096;
+
+    typedef yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> Allocator;
+
+    struct Statistics
+    {
+        uint32_t slotCount = 0;
+        uint32_t slotsInUse = 0;
+        uint32_t highWaterSlotsInUse = 0;
+        size_t chunkSize = 0;
+        size_t highWaterBytesUsed = 0;
+        uint64_t leases = 0;
+        uint64_t exhaustedLeases = 0;
+        uint64_t chunkOverflows = 0;
+    };
+
+    class Lease
+    {
+    public:
+        Lease();
+        Lease(Lease &&other);
+        ~Lease();
+
+        Lease &operator=(Lease &&other);
+
+        Allocator *GetAllocator() const;
+
+    private:
+        friend class CYIVideojsDocumentPool;
+
+        Lease(CYIVideojsDocumentPool *pPool, size_t slotIndex);
+
+        void Release();
+
+        CYIVideojsDocumentPool *m_pPool;
+        size_t m_slotIndex;
+    };
+
+    CYIVideojsDocumentPool(size_t slotCount = DEFAULT_SLOT_COUNT, size_t chunkSize = DEFAULT_CHUNK_SIZE);
+
+    Lease Acquire();
+
+    Statistics GetStatistics() const;
+    void ResetStatistics();
+
+private:
+    struct Slot
+    {
+        std::unique_ptr<char[]> pBuffer;
+        std::unique_ptr<Allocator> pAllocator;
+    };
+
+    CYIVideojsDocumentPool(const CYIVideojsDocumentPool &) = delete;
+    CYIVideojsDocumentPool &operator=(const CYIVideojsDocumentPool &) = delete;
+
+    void Release(size_t slotIndex);
+
+    std::vector<Slot> m_slots;
+    std::vector<size_t> m_freeSlots;
+    size_t m_chunkSize;
+    Statistics m_statistics;
+};
+
+#endif // _YI_VIDEOJS_DOCUMENT_POOL_H_
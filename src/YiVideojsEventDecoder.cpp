@@ -0,0 +1,413 @@
+#include "YiVideojsEventDecoder.h"
+
+#include <platform/YiWebMessagingBridge.h>
+
+#include <cstring>
+
+namespace
+{
+    template<typename EVENT>
+    struct EventField
+    {
+        const char *pName;
+        yi::rapidjson::SizeType nameLength;
+        double EVENT::*pValue;
+        bool required;
+    };
+
+// the json attribute name of each field matches the name of the struct member it is decoded into
+#define YI_VIDEOJS_EVENT_FIELD(EVENT, NAME, REQUIRED) { #NAME, sizeof(#NAME) - 1, &EVENT::NAME, REQUIRED }
+
+    typedef CYIVideojsEventDecoder::VideoTimeChangedEvent VideoTimeChangedEvent;
+    typedef CYIVideojsEventDecoder::BitrateChangedEvent BitrateChangedEvent;
+    typedef CYIVideojsEventDecoder::Rendition Rendition;
+    typedef CYIVideojsEventDecoder::SegmentDownloadedEvent SegmentDownloadedEvent;
+
+    const EventField<VideoTimeChangedEvent> VIDEO_TIME_CHANGED_SCHEMA[] = {
+        YI_VIDEOJS_EVENT_FIELD(VideoTimeChangedEvent, currentTimeSeconds, true),
+        YI_VIDEOJS_EVENT_FIELD(VideoTimeChangedEvent, bufferStartMs, false),
+        YI_VIDEOJS_EVENT_FIELD(VideoTimeChangedEvent, bufferEndMs, false),
+        YI_VIDEOJS_EVENT_FIELD(VideoTimeChangedEvent, bufferLengthMs, false)
+    };
+
+    const uint32_t VIDEO_TIME_CHANGED_BUFFER_LENGTH_FIELD = 1u << 3;
+
+    const EventField<BitrateChangedEvent> BITRATE_CHANGED_SCHEMA[] = {
+        YI_VIDEOJS_EVENT_FIELD(BitrateChangedEvent, initialAudioBitrateKbps, false),
+        YI_VIDEOJS_EVENT_FIELD(BitrateChangedEvent, currentAudioBitrateKbps, false),
+        YI_VIDEOJS_EVENT_FIELD(BitrateChangedEvent, initialVideoBitrateKbps, false),
+        YI_VIDEOJS_EVENT_FIELD(BitrateChangedEvent, currentVideoBitrateKbps, false),
+        YI_VIDEOJS_EVENT_FIELD(BitrateChangedEvent, initialTotalBitrateKbps, false),
+        YI_VIDEOJS_EVENT_FIELD(BitrateChangedEvent, currentTotalBitrateKbps, false)
+    };
+
+    const uint32_t BITRATE_CHANGED_AUDIO_FIELDS = (1u << 0) | (1u << 1);
+    const uint32_t BITRATE_CHANGED_VIDEO_FIELDS = (1u << 2) | (1u << 3);
+    const uint32_t BITRATE_CHANGED_TOTAL_FIELDS = (1u << 4) | (1u << 5);
+
+    const EventField<Rendition> RENDITION_SCHEMA[] = {
+        YI_VIDEOJS_EVENT_FIELD(Rendition, id, true),
+        YI_VIDEOJS_EVENT_FIELD(Rendition, bitrateKbps, true),
+        YI_VIDEOJS_EVENT_FIELD(Rendition, width, false),
+        YI_VIDEOJS_EVENT_FIELD(Rendition, height, false),
+        YI_VIDEOJS_EVENT_FIELD(Rendition, frameRate, false)
+    };
+
+    const EventField<SegmentDownloadedEvent> SEGMENT_DOWNLOADED_SCHEMA[] = {
+        YI_VIDEOJS_EVENT_FIELD(SegmentDownloadedEvent, renditionId, true),
+        YI_VIDEOJS_EVENT_FIELD(SegmentDownloadedEvent, bytes, true),
+        YI_VIDEOJS_EVENT_FIELD(SegmentDownloadedEvent, downloadTimeMs, true),
+        YI_VIDEOJS_EVENT_FIELD(SegmentDownloadedEvent, mediaDurationMs, false),
+        YI_VIDEOJS_EVENT_FIELD(SegmentDownloadedEvent, bufferLengthMs, false)
+    };
+
+#undef YI_VIDEOJS_EVENT_FIELD
+
+    const yi::rapidjson::Value *FindEventData(const yi::rapidjson::Value &eventValue, CYIString &errorMessage)
+    {
+        if (!eventValue.IsObject())
+        {
+            errorMessage = CYIString("expected an object event value, received ") + CYIRapidJSONUtility::TypeToString(eventValue.GetType());
+            return nullptr;
+        }
+
+        yi::rapidjson::Value::ConstMemberIterator eventDataIterator = eventValue.FindMember(CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME);
+
+        if (eventDataIterator == eventValue.MemberEnd())
+        {
+            errorMessage = CYIString("event value is missing '") + CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME + "' attribute";
+            return nullptr;
+        }
+
+        return &eventDataIterator->value;
+    }
+
+    // compact events are a positional array led by the encoding version, element i + 1 holds schema field i or null when absent
+    template<typename EVENT, size_t FIELD_COUNT>
+    bool DecodeCompactFields(const yi::rapidjson::Value &eventDataValue, const EventField<EVENT> (&schema)[FIELD_COUNT], EVENT &event, uint32_t &decodedFields, CYIString &errorMessage)
+    {
+        static_assert(FIELD_COUNT <= 32, "Event schemas are limited to 32 fields.");
+
+        decodedFields = 0;
+
+        if (eventDataValue.Size() != FIELD_COUNT + 1)
+        {
+            errorMessage = CYIString("expected a compact event with ") + CYIString::FromValue(FIELD_COUNT + 1) + " elements, received " + CYIString::FromValue(eventDataValue.Size());
+            return false;
+        }
+
+        if (!eventDataValue[0].IsInt() || eventDataValue[0].GetInt() != CYIVideojsEventDecoder::COMPACT_EVENT_VERSION)
+        {
+            errorMessage = CYIString("unsupported compact event version ") + CYIRapidJSONUtility::CreateStringFromValue(eventDataValue[0]);
+            return false;
+        }
+
+        for (size_t i = 0; i < FIELD_COUNT; ++i)
+        {
+            const yi::rapidjson::Value &fieldValue = eventDataValue[static_cast<yi::rapidjson::SizeType>(i + 1)];
+
+            if (fieldValue.IsNull())
+            {
+                if (schema[i].required)
+                {
+                    errorMessage = CYIString("compact event data is missing '") + schema[i].pName + "' value";
+                    return false;
+                }
+
+                continue;
+            }
+
+            if (!fieldValue.IsNumber())
+            {
+                errorMessage = CYIString("encountered an invalid number value for '") + schema[i].pName + "'";
+                return false;
+            }
+
+            event.*(schema[i].pValue) = fieldValue.GetDouble();
+            decodedFields |= 1u << i;
+        }
+
+        return true;
+    }
+
+    // walks the members of the event data exactly once, matching each one against the schema by length before comparing names
+    template<typename EVENT, size_t FIELD_COUNT>
+    bool DecodeFields(const yi::rapidjson::Value &eventDataValue, const EventField<EVENT> (&schema)[FIELD_COUNT], EVENT &event, uint32_t &decodedFields, CYIString &errorMessage)
+    {
+        static_assert(FIELD_COUNT <= 32, "Event schemas are limited to 32 fields.");
+
+        decodedFields = 0;
+
+        if (!eventDataValue.IsObject())
+        {
+            errorMessage = CYIString("expected an object type for '") + CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME + "', received " + CYIRapidJSONUtility::TypeToString(eventDataValue.GetType());
+            return false;
+        }
+
+        for (yi::rapidjson::Value::ConstMemberIterator memberIterator = eventDataValue.MemberBegin(); memberIterator != eventDataValue.MemberEnd(); ++memberIterator)
+        {
+            const yi::rapidjson::SizeType nameLength = memberIterator->name.GetStringLength();
+            const char *pName = memberIterator->name.GetString();
+
+            for (size_t i = 0; i < FIELD_COUNT; ++i)
+            {
+                const EventField<EVENT> &field = schema[i];
+
+                if (field.nameLength != nameLength || std::memcmp(field.pName, pName, nameLength) != 0)
+                {
+                    continue;
+                }
+
+                if (!memberIterator->value.IsNumber())
+                {
+                    errorMessage = CYIString("encountered an invalid number value for '") + field.pName + "'";
+                    return false;
+                }
+
+                event.*(field.pValue) = memberIterator->value.GetDouble();
+                decodedFields |= 1u << i;
+                break;
+            }
+        }
+
+        for (size_t i = 0; i < FIELD_COUNT; ++i)
+        {
+            if (schema[i].required && (decodedFields & (1u << i)) == 0)
+            {
+                errorMessage = CYIString("event data is missing '") + schema[i].pName + "' attribute";
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+bool CYIVideojsEventDecoder::DecodeVideoTimeChanged(const yi::rapidjson::Value &eventValue, VideoTimeChangedEvent &event, CYIString &errorMessage)
+{
+    const yi::rapidjson::Value *pEventDataValue = FindEventData(eventValue, errorMessage);
+
+    if (!pEventDataValue)
+    {
+        return false;
+    }
+
+    uint32_t decodedFields = 0;
+
+    event.compact = pEventDataValue->IsArray();
+
+    if (event.compact ? !DecodeCompactFields(*pEventDataValue, VIDEO_TIME_CHANGED_SCHEMA, event, decodedFields, errorMessage) : !DecodeFields(*pEventDataValue, VIDEO_TIME_CHANGED_SCHEMA, event, decodedFields, errorMessage))
+    {
+        return false;
+    }
+
+    event.hasBufferLength = (decodedFields & VIDEO_TIME_CHANGED_BUFFER_LENGTH_FIELD) != 0;
+
+    return true;
+}
+
+bool CYIVideojsEventDecoder::DecodeBitrateChanged(const yi::rapidjson::Value &eventValue, BitrateChangedEvent &event, CYIString &errorMessage)
+{
+    const yi::rapidjson::Value *pEventDataValue = FindEventData(eventValue, errorMessage);
+
+    if (!pEventDataValue)
+    {
+        return false;
+    }
+
+    uint32_t decodedFields = 0;
+
+    event.compact = pEventDataValue->IsArray();
+
+    if (event.compact ? !DecodeCompactFields(*pEventDataValue, BITRATE_CHANGED_SCHEMA, event, decodedFields, errorMessage) : !DecodeFields(*pEventDataValue, BITRATE_CHANGED_SCHEMA, event, decodedFields, errorMessage))
+    {
+        return false;
+    }
+
+    event.hasAudioBitrate = (decodedFields & BITRATE_CHANGED_AUDIO_FIELDS) != 0;
+    event.hasVideoBitrate = (decodedFields & BITRATE_CHANGED_VIDEO_FIELDS) != 0;
+    event.hasTotalBitrate = (decodedFields & BITRATE_CHANGED_TOTAL_FIELDS) != 0;
+
+    return true;
+}
+
+bool CYIVideojsEventDecoder::DecodeBufferingStateChanged(const yi::rapidjson::Value &eventValue, bool &buffering, CYIString &errorMessage)
+{
+    const yi::rapidjson::Value *pEventDataValue = FindEventData(eventValue, errorMessage);
+
+    if (!pEventDataValue)
+    {
+        return false;
+    }
+
+    if (!pEventDataValue->IsBool())
+    {
+        errorMessage = CYIString("expected a boolean type for '") + CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME + "', received " + CYIRapidJSONUtility::TypeToString(pEventDataValue->GetType());
+        return false;
+    }
+
+    buffering = pEventDataValue->GetBool();
+
+    return true;
+}
+
+bool CYIVideojsEventDecoder::DecodeSeekableRangesChanged(const yi::rapidjson::Value &eventValue, std::vector<TimeRange> &ranges, CYIString &errorMessage)
+{
+    static const char *START_TIME_ATTRIBUTE_NAME = "startTimeMs";
+    static const char *END_TIME_ATTRIBUTE_NAME = "endTimeMs";
+
+    const yi::rapidjson::Value *pEventDataValue = FindEventData(eventValue, errorMessage);
+
+    if (!pEventDataValue)
+    {
+        return false;
+    }
+
+    if (!pEventDataValue->IsArray())
+    {
+        errorMessage = CYIString("expected an array type for '") + CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME + "', received " + CYIRapidJSONUtility::TypeToString(pEventDataValue->GetType());
+        return false;
+    }
+
+    ranges.clear();
+    ranges.reserve(pEventDataValue->Size());
+
+    for (yi::rapidjson::Value::ConstValueIterator rangeIterator = pEventDataValue->Begin(); rangeIterator != pEventDataValue->End(); ++rangeIterator)
+    {
+        if (!rangeIterator->IsObject())
+        {
+            errorMessage = CYIString("expected an object type for seekable range, received ") + CYIRapidJSONUtility::TypeToString(rangeIterator->GetType());
+            return false;
+        }
+
+        yi::rapidjson::Value::ConstMemberIterator startTimeIterator = rangeIterator->FindMember(START_TIME_ATTRIBUTE_NAME);
+        yi::rapidjson::Value::ConstMemberIterator endTimeIterator = rangeIterator->FindMember(END_TIME_ATTRIBUTE_NAME);
+
+        if (startTimeIterator == rangeIterator->MemberEnd() || !startTimeIterator->value.IsNumber() || startTimeIterator->value.GetDouble() < 0.0)
+        {
+            errorMessage = CYIString("encountered an invalid number value for '") + START_TIME_ATTRIBUTE_NAME + "'";
+            return false;
+        }
+
+        if (endTimeIterator == rangeIterator->MemberEnd() || !endTimeIterator->value.IsNumber() || endTimeIterator->value.GetDouble() < 0.0)
+        {
+            errorMessage = CYIString("encountered an invalid number value for '") + END_TIME_ATTRIBUTE_NAME + "'";
+            return false;
+        }
+
+        TimeRange range;
+        range.startTimeMs = static_cast<uint64_t>(startTimeIterator->value.GetDouble());
+        range.endTimeMs = static_cast<uint64_t>(endTimeIterator->value.GetDouble());
+        ranges.push_back(range);
+    }
+
+    return true;
+}
+
+bool CYIVideojsEventDecoder::DecodeRenditionsChanged(const yi::rapidjson::Value &eventValue, std::vector<Rendition> &renditions, CYIString &errorMessage)
+{
+    static const char *CODECS_ATTRIBUTE_NAME = "codecs";
+
+    const yi::rapidjson::Value *pEventDataValue = FindEventData(eventValue, errorMessage);
+
+    if (!pEventDataValue)
+    {
+        return false;
+    }
+
+    if (!pEventDataValue->IsArray())
+    {
+        errorMessage = CYIString("expected an array type for '") + CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME + "', received " + CYIRapidJSONUtility::TypeToString(pEventDataValue->GetType());
+        return false;
+    }
+
+    renditions.clear();
+    renditions.reserve(pEventDataValue->Size());
+
+    for (yi::rapidjson::Value::ConstValueIterator renditionIterator = pEventDataValue->Begin(); renditionIterator != pEventDataValue->End(); ++renditionIterator)
+    {
+        Rendition rendition;
+        uint32_t decodedFields = 0;
+
+        if (!DecodeFields(*renditionIterator, RENDITION_SCHEMA, rendition, decodedFields, errorMessage))
+        {
+            return false;
+        }
+
+        // the codecs string is the only non-numeric rendition attribute, so it is read outside of the schema
+        yi::rapidjson::Value::ConstMemberIterator codecsIterator = renditionIterator->FindMember(CODECS_ATTRIBUTE_NAME);
+
+        if (codecsIterator != renditionIterator->MemberEnd() && codecsIterator->value.IsString())
+        {
+            rendition.codecs = CYIString(codecsIterator->value.GetString());
+        }
+
+        renditions.push_back(std::move(rendition));
+    }
+
+    return true;
+}
+
+bool CYIVideojsEventDecoder::DecodeBufferLengthChanged(const yi::rapidjson::Value &eventValue, BufferLengthChangedEvent &event, CYIString &errorMessage)
+{
+    static const char *MINIMUM_BUFFER_LENGTH_ATTRIBUTE_NAME = "minimumBufferLengthMs";
+    static const char *MAXIMUM_BUFFER_LENGTH_ATTRIBUTE_NAME = "maximumBufferLengthMs";
+
+    const yi::rapidjson::Value *pEventDataValue = FindEventData(eventValue, errorMessage);
+
+    if (!pEventDataValue)
+    {
+        return false;
+    }
+
+    if (!pEventDataValue->IsObject())
+    {
+        errorMessage = CYIString("expected an object type for '") + CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME + "', received " + CYIRapidJSONUtility::TypeToString(pEventDataValue->GetType());
+        return false;
+    }
+
+    yi::rapidjson::Value::ConstMemberIterator minimumBufferLengthIterator = pEventDataValue->FindMember(MINIMUM_BUFFER_LENGTH_ATTRIBUTE_NAME);
+    yi::rapidjson::Value::ConstMemberIterator maximumBufferLengthIterator = pEventDataValue->FindMember(MAXIMUM_BUFFER_LENGTH_ATTRIBUTE_NAME);
+
+    if (minimumBufferLengthIterator == pEventDataValue->MemberEnd() || !minimumBufferLengthIterator->value.IsNumber() || minimumBufferLengthIterator->value.GetDouble() < 0.0)
+    {
+        errorMessage = CYIString("encountered an invalid number value for '") + MINIMUM_BUFFER_LENGTH_ATTRIBUTE_NAME + "'";
+        return false;
+    }
+
+    if (maximumBufferLengthIterator == pEventDataValue->MemberEnd() || !maximumBufferLengthIterator->value.IsNumber() || maximumBufferLengthIterator->value.GetDouble() < 0.0)
+    {
+        errorMessage = CYIString("encountered an invalid number value for '") + MAXIMUM_BUFFER_LENGTH_ATTRIBUTE_NAME + "'";
+        return false;
+    }
+
+    event.minimumBufferLengthMs = static_cast<int64_t>(minimumBufferLengthIterator->value.GetDouble());
+    event.maximumBufferLengthMs = static_cast<int64_t>(maximumBufferLengthIterator->value.GetDouble());
+
+    return true;
+}
+
+bool CYIVideojsEventDecoder::DecodeSegmentDownloaded(const yi::rapidjson::Value &eventValue, SegmentDownloadedEvent &event, CYIString &errorMessage)
+{
+    const yi::rapidjson::Value *pEventDataValue = FindEventData(eventValue, errorMessage);
+
+    if (!pEventDataValue)
+    {
+        return false;
+    }
+
+    uint32_t decodedFields = 0;
+
+    if (!DecodeFields(*pEventDataValue, SEGMENT_DOWNLOADED_SCHEMA, event, decodedFields, errorMessage))
+    {
+        return false;
+    }
+
+    if (event.renditionId < 0.0 || event.bytes < 0.0 || event.downloadTimeMs < 0.0 || event.mediaDurationMs < 0.0 || event.bufferLengthMs < 0.0)
+    {
+        errorMessage = "encountered a negative segment sample value";
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,80 @@
+#ifndef _YI_VIDEOJS_EVENT_DECODER_H_
+#define _YI_VIDEOJS_EVENT_DECODER_H_
+
+#include <utility/YiRapidJSONUtility.h>
+
+#include <vector>
+
+class CYIVideojsEventDecoder
+{
+public:
+    static const int32_t COMPACT_EVENT_VERSION = 1;
+
+    struct VideoTimeChangedEvent
+    {
+        double currentTimeSeconds = -1.0;
+        double bufferStartMs = -1.0;
+        double bufferEndMs = -1.0;
+        double bufferLengthMs = -1.0;
+        bool hasBufferLength = false;
+        bool compact = false;
+    };
+
+    struct BitrateChangedEvent
+    {
+        double initialAudioBitrateKbps = -1.0;
+        double currentAudioBitrateKbps = -1.0;
+        double initialVideoBitrateKbps = -1.0;
+        double currentVideoBitrateKbps = -1.0;
+        double initialTotalBitrateKbps = -1.0;
+        double currentTotalBitrateKbps = -1.0;
+        bool hasAudioBitrate = false;
+        bool hasVideoBitrate = false;
+        bool hasTotalBitrate = false;
+        bool compact = false;
+    };
+
+    struct TimeRange
+    {
+        uint64_t startTimeMs = 0;
+        uint64_t endTimeMs = 0;
+    };
+
+    struct Rendition
+    {
+        double id = -1.0;
+        double bitrateKbps = 0.0;
+        double width = 0.0;
+        double height = 0.0;
+        double frameRate = 0.0;
+        CYIString codecs;
+    };
+
+    struct BufferLengthChangedEvent
+    {
+        int64_t minimumBufferLengthMs = -1;
+        int64_t maximumBufferLengthMs = -1;
+    };
+
+    struct SegmentDownloadedEvent
+    {
+        double renditionId = -1.0;
+        double bytes = 0.0;
+        double downloadTimeMs = 0.0;
+        double mediaDurationMs = 0.0;
+        double bufferLengthMs = 0.0;
+    };
+
+    static bool DecodeVideoTimeChanged(const yi::rapidjson::Value &eventValue, VideoTimeChangedEvent &event, CYIString &errorMessage);
+    static bool DecodeBitrateChanged(const yi::rapidjson::Value &eventValue, BitrateChangedEvent &event, CYIString &errorMessage);
+    static bool DecodeBufferingStateChanged(const yi::rapidjson::Value &eventValue, bool &buffering, CYIString &errorMessage);
+    static bool DecodeSeekableRangesChanged(const yi::rapidjson::Value &eventValue, std::vector<TimeRange> &ranges, CYIString &errorMessage);
+    static bool DecodeRenditionsChanged(const yi::rapidjson::Value &eventValue, std::vector<Rendition> &renditions, CYIString &errorMessage);
+    static bool DecodeBufferLengthChanged(const yi::rapidjson::Value &eventValue, BufferLengthChangedEvent &event, CYIString &errorMessage);
+    static bool DecodeSegmentDownloaded(const yi::rapidjson::Value &eventValue, SegmentDownloadedEvent &event, CYIString &errorMessage);
+
+private:
+    CYIVideojsEventDecoder() = delete;
+};
+
+#endif // _YI_VIDEOJS_EVENT_DECODER_H_
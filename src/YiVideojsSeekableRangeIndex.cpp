@@ -0,0 +1,110 @@
+#include "YiVideojsSeekableRangeIndex.h"
+
+#include <algorithm>
+#include <iterator>
+
+void CYIVideojsSeekableRangeIndex::Clear()
+{
+    m_ranges.clear();
+}
+
+void CYIVideojsSeekableRangeIndex::Add(uint64_t startTimeMs, uint64_t endTimeMs)
+{
+    if (endTimeMs < startTimeMs)
+    {
+        std::swap(startTimeMs, endTimeMs);
+    }
+
+    // ranges are keyed by their start time and kept disjoint, so overlapping or touching ranges are merged on insertion
+    std::map<uint64_t, uint64_t>::iterator rangeIterator = m_ranges.upper_bound(startTimeMs);
+
+    if (rangeIterator != m_ranges.begin())
+    {
+        std::map<uint64_t, uint64_t>::iterator previousRangeIterator = std::prev(rangeIterator);
+
+        if (previousRangeIterator->second >= startTimeMs)
+        {
+            startTimeMs = previousRangeIterator->first;
+            endTimeMs = std::max(endTimeMs, previousRangeIterator->second);
+            m_ranges.erase(previousRangeIterator);
+        }
+    }
+
+    while (rangeIterator != m_ranges.end() && rangeIterator->first <= endTimeMs)
+    {
+        endTimeMs = std::max(endTimeMs, rangeIterator->second);
+        rangeIterator = m_ranges.erase(rangeIterator);
+    }
+
+    m_ranges.emplace_hint(rangeIterator, startTimeMs, endTimeMs);
+}
+
+bool CYIVideojsSeekableRangeIndex::IsEmpty() const
+{
+    return m_ranges.empty();
+}
+
+size_t CYIVideojsSeekableRangeIndex::GetRangeCount() const
+{
+    return m_ranges.size();
+}
+
+bool CYIVideojsSeekableRangeIndex::Contains(uint64_t positionMs) const
+{
+    std::map<uint64_t, uint64_t>::const_iterator rangeIterator = m_ranges.upper_bound(positionMs);
+
+    return rangeIterator != m_ranges.begin() && positionMs <= std::prev(rangeIterator)->second;
+}
+
+uint64_t CYIVideojsSeekableRangeIndex::GetNearestSeekablePositionMs(uint64_t positionMs) const
+{
+    if (m_ranges.empty())
+    {
+        return positionMs;
+    }
+
+    std::map<uint64_t, uint64_t>::const_iterator nextRangeIterator = m_ranges.upper_bound(positionMs);
+
+    if (nextRangeIterator == m_ranges.begin())
+    {
+        return nextRangeIterator->first;
+    }
+
+    uint64_t previousRangeEndMs = std::prev(nextRangeIterator)->second;
+
+    if (positionMs <= previousRangeEndMs)
+    {
+        return positionMs;
+    }
+
+    if (nextRangeIterator == m_ranges.end())
+    {
+        return previousRangeEndMs;
+    }
+
+    // the position falls in a gap between two ranges, ties go to the earlier range
+    return positionMs - previousRangeEndMs <= nextRangeIterator->first - positionMs ? previousRangeEndMs : nextRangeIterator->first;
+}
+
+uint64_t CYIVideojsSeekableRangeIndex::GetEarliestPositionMs() const
+{
+    return m_ranges.empty() ? 0 : m_ranges.begin()->first;
+}
+
+uint64_t CYIVideojsSeekableRangeIndex::GetLiveEdgeMs() const
+{
+    return m_ranges.empty() ? 0 : m_ranges.rbegin()->second;
+}
+
+std::vector<CYIAbstractVideoPlayer::SeekableRange> CYIVideojsSeekableRangeIndex::GetRanges() const
+{
+    std::vector<CYIAbstractVideoPlayer::SeekableRange> ranges;
+    ranges.reserve(m_ranges.size());
+
+    for (const std::pair<const uint64_t, uint64_t> &range : m_ranges)
+    {
+        ranges.push_back(CYIAbstractVideoPlayer::SeekableRange(range.first, range.second));
+    }
+
+    return ranges;
+}
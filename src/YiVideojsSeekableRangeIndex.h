@@ -0,0 +1,27 @@
+#ifndef _YI_VIDEOJS_SEEKABLE_RANGE_INDEX_H_
+#define _YI_VIDEOJS_SEEKABLE_RANGE_INDEX_H_
+
+#include <player/YiAbstractVideoPlayer.h>
+
+#include <map>
+#include <vector>
+
+class CYIVideojsSeekableRangeIndex
+{
+public:
+    void Clear();
+    void Add(uint64_t startTimeMs, uint64_t endTimeMs);
+
+    bool IsEmpty() const;
+    size_t GetRangeCount() const;
+    bool Contains(uint64_t positionMs) const;
+    uint64_t GetNearestSeekablePositionMs(uint64_t positionMs) const;
+    uint64_t GetEarliestPositionMs() const;
+    uint64_t GetLiveEdgeMs() const;
+    std::vector<CYIAbstractVideoPlayer::SeekableRange> GetRanges() const;
+
+private:
+    std::map<uint64_t, uint64_t> m_ranges;
+};
+
+#endif // _YI_VIDEOJS_SEEKABLE_RANGE_INDEX_H_
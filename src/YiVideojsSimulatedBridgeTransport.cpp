@@ -0,0 +1,768 @@
+#include "YiVideojsSimulatedBridgeTransport.h"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#define LOG_TAG "CYIVideojsSimulatedBridgeTransport"
+
+static const char *VIDEO_PLAYER_CLASS_NAME = "CYIVideojsVideoPlayer";
+static const char *VIDEO_PLAYER_TYPE = "Simulated Video.js";
+static const char *VIDEO_PLAYER_VERSION = "0.0.0";
+static const char *INSTANCE_ID_ATTRIBUTE_NAME = "instanceId";
+static const char *COMPACT_EVENT_VERSION_ATTRIBUTE_NAME = "compactEventVersion";
+static const char *STATE_ID_ATTRIBUTE_NAME = "id";
+static const char *PREPARE_ID_ATTRIBUTE_NAME = "prepareId";
+static const char *START_TIME_SECONDS_ATTRIBUTE_NAME = "startTimeSeconds";
+static const char *BATCH_COMMAND_NAME_ATTRIBUTE_NAME = "name";
+static const char *BATCH_COMMAND_ARGUMENTS_ATTRIBUTE_NAME = "args";
+static const char *BATCH_RESULT_ATTRIBUTE_NAME = "result";
+static const char *MESSAGE_CLASS_NAME_ATTRIBUTE_NAME = "className";
+static const char *MESSAGE_INSTANCE_ACCESSOR_NAME_ATTRIBUTE_NAME = "instanceAccessorName";
+static const char *MESSAGE_INSTANCE_ACCESSOR_ARGUMENTS_ATTRIBUTE_NAME = "instanceAccessorArgs";
+static const char *MESSAGE_FUNCTION_NAME_ATTRIBUTE_NAME = "functionName";
+static const char *MESSAGE_FUNCTION_ARGUMENTS_ATTRIBUTE_NAME = "args";
+static const uint32_t TICK_INTERVAL_MS = 10;
+static const double DEFAULT_GOAL_BUFFER_LENGTH_MS = 30000.0;
+static const double DEFAULT_MAX_GOAL_BUFFER_LENGTH_MS = 60000.0;
+
+namespace
+{
+    class SimulatedPendingResponse : public CYIVideojsBridgeTransport::PendingResponse
+    {
+    public:
+        SimulatedPendingResponse(std::shared_ptr<const yi::rapidjson::Document> pResult, const CYIString &errorMessage, std::chrono::steady_clock::time_point readyTime)
+            : m_pResult(std::move(pResult))
+            , m_errorMessage(errorMessage)
+            , m_readyTime(readyTime)
+        {
+        }
+
+        // waits out the simulated latency only when the response becomes ready within the timeout, a response that
+        // would arrive later is reported as missing straight away so that polls and timeouts never stall the caller
+        virtual bool Take(uint32_t timeoutMs, CYIVideojsBridgeTransport::Response &response) override
+        {
+            std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+            if (now < m_readyTime)
+            {
+                std::chrono::steady_clock::duration remaining = m_readyTime - now;
+
+                if (remaining > std::chrono::milliseconds(timeoutMs))
+                {
+                    return false;
+                }
+
+                std::this_thread::sleep_for(remaining);
+            }
+
+            response = CYIVideojsBridgeTransport::Response(m_pResult, m_errorMessage);
+
+            return true;
+        }
+
+    private:
+        std::shared_ptr<const yi::rapidjson::Document> m_pResult;
+        CYIString m_errorMessage;
+        std::chrono::steady_clock::time_point m_readyTime;
+    };
+
+    const yi::rapidjson::Value *GetArgument(const yi::rapidjson::Value &functionArgumentsValue, yi::rapidjson::SizeType index)
+    {
+        if (!functionArgumentsValue.IsArray() || index >= functionArgumentsValue.Size())
+        {
+            return nullptr;
+        }
+
+        return &functionArgumentsValue[index];
+    }
+
+    bool GetNumberArgument(const yi::rapidjson::Value &functionArgumentsValue, yi::rapidjson::SizeType index, double &value)
+    {
+        const yi::rapidjson::Value *pArgument = GetArgument(functionArgumentsValue, index);
+
+        if (!pArgument || !pArgument->IsNumber())
+        {
+            return false;
+        }
+
+        value = pArgument->GetDouble();
+
+        return true;
+    }
+
+    bool MatchesFilter(const yi::rapidjson::Value &filter, const yi::rapidjson::Value &event)
+    {
+        if (!filter.IsObject())
+        {
+            return true;
+        }
+
+        for (yi::rapidjson::Value::ConstMemberIterator filterIterator = filter.MemberBegin(); filterIterator != filter.MemberEnd(); ++filterIterator)
+        {
+            yi::rapidjson::Value::ConstMemberIterator eventIterator = event.FindMember(filterIterator->name);
+
+            if (eventIterator == event.MemberEnd() || eventIterator->value != filterIterator->value)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+CYIVideojsSimulatedBridgeTransport::CYIVideojsSimulatedBridgeTransport()
+    : CYIVideojsSimulatedBridgeTransport(Configuration())
+{
+}
+
+CYIVideojsSimulatedBridgeTransport::CYIVideojsSimulatedBridgeTransport(const Configuration &configuration)
+    : m_configuration(configuration)
+    , m_available(true)
+    , m_nextInstanceId(1)
+    , m_nextEventHandlerId(1)
+    , m_callCount(0)
+    , m_messageBytes(0)
+    , m_messageWriter(m_messageBuffer)
+    , m_eventCount(0)
+    , m_randomGenerator(configuration.randomSeed)
+{
+    m_tickTimer.TimedOut.Connect(*this, &CYIVideojsSimulatedBridgeTransport::OnTickTimerTimedOut);
+    m_tickTimer.Start(TICK_INTERVAL_MS);
+}
+
+CYIVideojsSimulatedBridgeTransport::~CYIVideojsSimulatedBridgeTransport()
+{
+    m_tickTimer.Stop();
+}
+
+const CYIVideojsSimulatedBridgeTransport::Configuration &CYIVideojsSimulatedBridgeTransport::GetConfiguration() const
+{
+    return m_configuration;
+}
+
+void CYIVideojsSimulatedBridgeTransport::SetConfiguration(const Configuration &configuration)
+{
+    m_configuration = configuration;
+    m_randomGenerator.seed(configuration.randomSeed);
+}
+
+void CYIVideojsSimulatedBridgeTransport::SetAvailable(bool available)
+{
+    m_available = available;
+}
+
+void CYIVideojsSimulatedBridgeTransport::SetFunctionHandler(const CYIString &functionName, FunctionHandler handler)
+{
+    if (handler)
+    {
+        m_functionHandlers[functionName] = std::move(handler);
+    }
+    else
+    {
+        m_functionHandlers.erase(functionName);
+    }
+}
+
+void CYIVideojsSimulatedBridgeTransport::EmitEvent(int32_t instanceId, const CYIString &eventName, yi::rapidjson::Value &&data, uint32_t delayMs)
+{
+    std::shared_ptr<yi::rapidjson::Document> pEvent(new yi::rapidjson::Document(yi::rapidjson::kObjectType));
+    yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = pEvent->GetAllocator();
+
+    pEvent->AddMember(yi::rapidjson::StringRef(CYIWebMessagingBridge::EVENT_CONTEXT_ATTRIBUTE_NAME), yi::rapidjson::Value(VIDEO_PLAYER_CLASS_NAME, allocator), allocator);
+    pEvent->AddMember(yi::rapidjson::StringRef(CYIWebMessagingBridge::EVENT_NAME_ATTRIBUTE_NAME), yi::rapidjson::Value(eventName.GetData(), allocator), allocator);
+    pEvent->AddMember(yi::rapidjson::StringRef(INSTANCE_ID_ATTRIBUTE_NAME), yi::rapidjson::Value(instanceId), allocator);
+    pEvent->AddMember(yi::rapidjson::StringRef(CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME), yi::rapidjson::Value(data, allocator), allocator);
+
+    // events scheduled for the same time are delivered in the order they were emitted
+    m_scheduledEvents.emplace(std::chrono::steady_clock::now() + std::chrono::milliseconds(delayMs), std::move(pEvent));
+}
+
+uint64_t CYIVideojsSimulatedBridgeTransport::GetCallCount() const
+{
+    return m_callCount;
+}
+
+uint64_t CYIVideojsSimulatedBridgeTransport::GetMessageBytes() const
+{
+    return m_messageBytes;
+}
+
+uint64_t CYIVideojsSimulatedBridgeTransport::GetEventCount() const
+{
+    return m_eventCount;
+}
+
+size_t CYIVideojsSimulatedBridgeTransport::GetEventHandlerCount() const
+{
+    return m_eventHandlers.size();
+}
+
+bool CYIVideojsSimulatedBridgeTransport::IsAvailable() const
+{
+    return m_available;
+}
+
+CYIVideojsBridgeTransport::FutureResponse CYIVideojsSimulatedBridgeTransport::CallStaticFunction(yi::rapidjson::Document &&message, const CYIString &className, const CYIString &functionName, yi::rapidjson::Value &&functionArgumentsValue, bool *pMessageSent)
+{
+    PostMessage(message, className, CYIString::EmptyString(), functionName, functionArgumentsValue, yi::rapidjson::Value(yi::rapidjson::kArrayType));
+
+    return Invoke(0, functionName, functionArgumentsValue, pMessageSent);
+}
+
+CYIVideojsBridgeTransport::FutureResponse CYIVideojsSimulatedBridgeTransport::CallInstanceFunction(yi::rapidjson::Document &&message, const CYIString &className, const CYIString &instanceAccessorName, const CYIString &functionName, yi::rapidjson::Value &&functionArgumentsValue, yi::rapidjson::Value &&instanceAccessorArgumentsValue, bool *pMessageSent)
+{
+    PostMessage(message, className, instanceAccessorName, functionName, functionArgumentsValue, instanceAccessorArgumentsValue);
+
+    const yi::rapidjson::Value *pInstanceIdValue = GetArgument(instanceAccessorArgumentsValue, 0);
+
+    // like getInstance, the first player created is used when no instance id is specified
+    int32_t instanceId = pInstanceIdValue && pInstanceIdValue->IsInt() ? pInstanceIdValue->GetInt() : (m_players.empty() ? 0 : m_players.begin()->first);
+
+    return Invoke(instanceId, functionName, functionArgumentsValue, pMessageSent);
+}
+
+uint64_t CYIVideojsSimulatedBridgeTransport::RegisterEventHandler(yi::rapidjson::Document &&filterDocument, CYIWebMessagingBridge::EventCallback &&eventCallback)
+{
+    uint64_t eventHandlerId = m_nextEventHandlerId++;
+
+    EventHandler &eventHandler = m_eventHandlers[eventHandlerId];
+    eventHandler.pFilter.reset(new yi::rapidjson::Document(std::move(filterDocument)));
+    eventHandler.callback = std::move(eventCallback);
+
+    return eventHandlerId;
+}
+
+void CYIVideojsSimulatedBridgeTransport::UnregisterEventHandler(uint64_t eventHandlerId)
+{
+    m_eventHandlers.erase(eventHandlerId);
+}
+
+void CYIVideojsSimulatedBridgeTransport::PostMessage(const yi::rapidjson::Document &message, const CYIString &className, const CYIString &instanceAccessorName, const CYIString &functionName, const yi::rapidjson::Value &functionArgumentsValue, const yi::rapidjson::Value &instanceAccessorArgumentsValue)
+{
+    if (!m_available)
+    {
+        return;
+    }
+
+    // the message is serialized like the web messaging bridge does before posting it to the web view, so that the
+    // serialization cost is measured and messages that outlive the pooled document they were built in are caught
+    m_messageBuffer.Clear();
+    m_messageWriter.Reset(m_messageBuffer);
+    m_messageWriter.StartObject();
+
+    if (message.IsObject())
+    {
+        for (yi::rapidjson::Value::ConstMemberIterator memberIterator = message.MemberBegin(); memberIterator != message.MemberEnd(); ++memberIterator)
+        {
+            m_messageWriter.Key(memberIterator->name.GetString(), memberIterator->name.GetStringLength());
+            memberIterator->value.Accept(m_messageWriter);
+        }
+    }
+
+    m_messageWriter.Key(MESSAGE_CLASS_NAME_ATTRIBUTE_NAME);
+    m_messageWriter.String(className.GetData(), static_cast<yi::rapidjson::SizeType>(className.GetLength()));
+
+    if (!instanceAccessorName.IsEmpty())
+    {
+        m_messageWriter.Key(MESSAGE_INSTANCE_ACCESSOR_NAME_ATTRIBUTE_NAME);
+        m_messageWriter.String(instanceAccessorName.GetData(), static_cast<yi::rapidjson::SizeType>(instanceAccessorName.GetLength()));
+        m_messageWriter.Key(MESSAGE_INSTANCE_ACCESSOR_ARGUMENTS_ATTRIBUTE_NAME);
+        instanceAccessorArgumentsValue.Accept(m_messageWriter);
+    }
+
+    m_messageWriter.Key(MESSAGE_FUNCTION_NAME_ATTRIBUTE_NAME);
+    m_messageWriter.String(functionName.GetData(), static_cast<yi::rapidjson::SizeType>(functionName.GetLength()));
+    m_messageWriter.Key(MESSAGE_FUNCTION_ARGUMENTS_ATTRIBUTE_NAME);
+    functionArgumentsValue.Accept(m_messageWriter);
+    m_messageWriter.EndObject();
+
+    m_messageBytes += m_messageBuffer.GetSize();
+}
+
+CYIVideojsBridgeTransport::FutureResponse CYIVideojsSimulatedBridgeTransport::Invoke(int32_t instanceId, const CYIString &functionName, const yi::rapidjson::Value &functionArgumentsValue, bool *pMessageSent)
+{
+    if (pMessageSent)
+    {
+        *pMessageSent = m_available;
+    }
+
+    if (!m_available)
+    {
+        return FutureResponse();
+    }
+
+    m_callCount++;
+
+    uint32_t responseDelayMs = GetResponseDelayMs();
+
+    std::shared_ptr<yi::rapidjson::Document> pResult(new yi::rapidjson::Document());
+    CYIString errorMessage;
+
+    if (!InvokeFunction(instanceId, functionName, functionArgumentsValue, *pResult, errorMessage, responseDelayMs) && errorMessage.IsEmpty())
+    {
+        errorMessage = CYIString(VIDEO_PLAYER_CLASS_NAME) + " failed to execute " + functionName + ".";
+    }
+
+    return FutureResponse(std::unique_ptr<PendingResponse>(new SimulatedPendingResponse(pResult, errorMessage, std::chrono::steady_clock::now() + std::chrono::milliseconds(responseDelayMs))));
+}
+
+bool CYIVideojsSimulatedBridgeTransport::InvokeFunction(int32_t instanceId, const CYIString &functionName, const yi::rapidjson::Value &functionArgumentsValue, yi::rapidjson::Document &result, CYIString &errorMessage, uint32_t responseDelayMs)
+{
+    std::map<CYIString, FunctionHandler>::iterator functionHandlerIterator = m_functionHandlers.find(functionName);
+
+    // scripted handlers take precedence so that individual functions can be made to fail, stall or return custom values
+    if (functionHandlerIterator != m_functionHandlers.end())
+    {
+        return functionHandlerIterator->second(instanceId, functionArgumentsValue, result, errorMessage);
+    }
+
+    if (functionName == "executeBatch")
+    {
+        const yi::rapidjson::Value *pCommandsValue = GetArgument(functionArgumentsValue, 0);
+
+        // the adapter streams its batches into a JSON string, which the web view parses before running the commands
+        yi::rapidjson::Document commands;
+
+        if (pCommandsValue && pCommandsValue->IsString())
+        {
+            commands.Parse(pCommandsValue->GetString(), pCommandsValue->GetStringLength());
+            pCommandsValue = commands.HasParseError() ? nullptr : &commands;
+        }
+
+        if (!pCommandsValue || !pCommandsValue->IsArray())
+        {
+            errorMessage = CYIString(VIDEO_PLAYER_CLASS_NAME) + " received an invalid command batch, expected an array!";
+            return false;
+        }
+
+        yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = result.GetAllocator();
+        result.SetArray();
+
+        for (yi::rapidjson::Value::ConstValueIterator commandIterator = pCommandsValue->Begin(); commandIterator != pCommandsValue->End(); ++commandIterator)
+        {
+            static const yi::rapidjson::Value EMPTY_ARGUMENTS(yi::rapidjson::kArrayType);
+
+            yi::rapidjson::Value commandResultValue(yi::rapidjson::kObjectType);
+            yi::rapidjson::Document commandResult;
+            CYIString commandErrorMessage;
+            bool succeeded = false;
+
+            if (commandIterator->IsObject() && commandIterator->HasMember(BATCH_COMMAND_NAME_ATTRIBUTE_NAME) && (*commandIterator)[BATCH_COMMAND_NAME_ATTRIBUTE_NAME].IsString())
+            {
+                CYIString commandName((*commandIterator)[BATCH_COMMAND_NAME_ATTRIBUTE_NAME].GetString());
+                const yi::rapidjson::Value &commandArguments = commandIterator->HasMember(BATCH_COMMAND_ARGUMENTS_ATTRIBUTE_NAME) ? (*commandIterator)[BATCH_COMMAND_ARGUMENTS_ATTRIBUTE_NAME] : EMPTY_ARGUMENTS;
+
+                if (commandName != "executeBatch")
+                {
+                    succeeded = InvokeFunction(instanceId, commandName, commandArguments, commandResult, commandErrorMessage, responseDelayMs);
+                }
+            }
+
+            if (succeeded)
+            {
+                commandResultValue.AddMember(yi::rapidjson::StringRef(BATCH_RESULT_ATTRIBUTE_NAME), yi::rapidjson::Value(commandResult, allocator), allocator);
+            }
+            else
+            {
+                if (commandErrorMessage.IsEmpty())
+                {
+                    commandErrorMessage = CYIString(VIDEO_PLAYER_CLASS_NAME) + " received an invalid batched command!";
+                }
+
+                yi::rapidjson::Value errorValue(yi::rapidjson::kObjectType);
+                errorValue.AddMember(yi::rapidjson::StringRef(CYIWebMessagingBridge::ERROR_MESSAGE_ATTRIBUTE_NAME), yi::rapidjson::Value(commandErrorMessage.GetData(), allocator), allocator);
+                commandResultValue.AddMember(yi::rapidjson::StringRef(CYIWebMessagingBridge::ERROR_ATTRIBUTE_NAME), errorValue, allocator);
+            }
+
+            result.PushBack(commandResultValue, allocator);
+        }
+
+        return true;
+    }
+
+    return InvokeBuiltInFunction(instanceId, functionName, functionArgumentsValue, result, errorMessage, responseDelayMs);
+}
+
+bool CYIVideojsSimulatedBridgeTransport::InvokeBuiltInFunction(int32_t instanceId, const CYIString &functionName, const yi::rapidjson::Value &functionArgumentsValue, yi::rapidjson::Document &result, CYIString &errorMessage, uint32_t responseDelayMs)
+{
+    yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = result.GetAllocator();
+
+    if (functionName == "getType")
+    {
+        result.SetString(VIDEO_PLAYER_TYPE, allocator);
+        return true;
+    }
+
+    if (functionName == "getVersion")
+    {
+        result.SetString(VIDEO_PLAYER_VERSION, allocator);
+        return true;
+    }
+
+    if (functionName == "getDevicePixelRatio")
+    {
+        result.SetDouble(m_configuration.devicePixelRatio);
+        return true;
+    }
+
+    if (functionName == "createInstance")
+    {
+        double requestedInstanceId = 0.0;
+        int32_t newInstanceId = GetNumberArgument(functionArgumentsValue, 1, requestedInstanceId) ? static_cast<int32_t>(requestedInstanceId) : m_nextInstanceId;
+
+        if (m_players.find(newInstanceId) != m_players.end())
+        {
+            errorMessage = CYIString("A ") + VIDEO_PLAYER_TYPE + " video player instance with id " + CYIString::FromValue(newInstanceId) + " already exists!";
+            return false;
+        }
+
+        m_nextInstanceId = newInstanceId + 1;
+        m_players[newInstanceId].timeUpdateIntervalMs = m_configuration.timeUpdateIntervalMs;
+
+        // the simulated player always sends verbose events, so the compact encoding is never agreed to
+        result.SetObject();
+        result.AddMember(yi::rapidjson::StringRef(INSTANCE_ID_ATTRIBUTE_NAME), yi::rapidjson::Value(newInstanceId), allocator);
+        result.AddMember(yi::rapidjson::StringRef(COMPACT_EVENT_VERSION_ATTRIBUTE_NAME), yi::rapidjson::Value(yi::rapidjson::kNullType), allocator);
+
+        return true;
+    }
+
+    if (functionName == "getStreamFormatSupportMatrix")
+    {
+        const yi::rapidjson::Value *pStreamFormatsValue = GetArgument(functionArgumentsValue, 0);
+        const yi::rapidjson::Value *pDRMTypesValue = GetArgument(functionArgumentsValue, 1);
+
+        if (!pStreamFormatsValue || !pStreamFormatsValue->IsArray() || !pDRMTypesValue || !pDRMTypesValue->IsArray())
+        {
+            errorMessage = CYIString(VIDEO_PLAYER_CLASS_NAME) + " expected stream format and DRM type arrays.";
+            return false;
+        }
+
+        result.SetArray();
+
+        for (yi::rapidjson::SizeType i = 0; i < pStreamFormatsValue->Size(); ++i)
+        {
+            yi::rapidjson::Value supportedValue(yi::rapidjson::kArrayType);
+
+            for (yi::rapidjson::SizeType j = 0; j < pDRMTypesValue->Size(); ++j)
+            {
+                supportedValue.PushBack(yi::rapidjson::Value(true), allocator);
+            }
+
+            result.PushBack(supportedValue, allocator);
+        }
+
+        return true;
+    }
+
+    if (functionName == "isStreamFormatSupported")
+    {
+        result.SetBool(true);
+        return true;
+    }
+
+    SimulatedPlayer *pPlayer = GetPlayer(instanceId, errorMessage);
+
+    if (!pPlayer)
+    {
+        return false;
+    }
+
+    if (functionName == "initialize")
+    {
+        UpdateState(instanceId, *pPlayer, PlayerState::Initialized, responseDelayMs);
+    }
+    else if (functionName == "destroy")
+    {
+        m_players.erase(instanceId);
+    }
+    else if (functionName == "prepare")
+    {
+        const yi::rapidjson::Value *pConfigurationValue = GetArgument(functionArgumentsValue, 0);
+
+        pPlayer->hasPrepareId = false;
+        pPlayer->currentTimeSeconds = 0.0;
+
+        if (pConfigurationValue && pConfigurationValue->IsObject())
+        {
+            yi::rapidjson::Value::ConstMemberIterator prepareIdIterator = pConfigurationValue->FindMember(PREPARE_ID_ATTRIBUTE_NAME);
+            yi::rapidjson::Value::ConstMemberIterator startTimeIterator = pConfigurationValue->FindMember(START_TIME_SECONDS_ATTRIBUTE_NAME);
+
+            if (prepareIdIterator != pConfigurationValue->MemberEnd() && prepareIdIterator->value.IsInt())
+            {
+                pPlayer->prepareId = prepareIdIterator->value.GetInt();
+                pPlayer->hasPrepareId = true;
+            }
+
+            if (startTimeIterator != pConfigurationValue->MemberEnd() && startTimeIterator->value.IsNumber())
+            {
+                pPlayer->currentTimeSeconds = std::max(0.0, startTimeIterator->value.GetDouble());
+            }
+        }
+        else
+        {
+            GetNumberArgument(functionArgumentsValue, 2, pPlayer->currentTimeSeconds);
+        }
+
+        UpdateState(instanceId, *pPlayer, PlayerState::Loading, responseDelayMs);
+        UpdateState(instanceId, *pPlayer, PlayerState::Loaded, responseDelayMs + m_configuration.prepareDelayMs);
+
+        EmitEvent(instanceId, "videoDurationChanged", yi::rapidjson::Value(GetMediaDurationSeconds()), responseDelayMs + m_configuration.prepareDelayMs);
+    }
+    else if (functionName == "play")
+    {
+        if (pPlayer->state != PlayerState::Loaded && pPlayer->state != PlayerState::Paused && pPlayer->state != PlayerState::Complete && pPlayer->state != PlayerState::Playing)
+        {
+            errorMessage = CYIString(VIDEO_PLAYER_CLASS_NAME) + " cannot play before a video has been loaded.";
+            return false;
+        }
+
+        if (pPlayer->state != PlayerState::Playing)
+        {
+            if (pPlayer->state == PlayerState::Complete)
+            {
+                pPlayer->currentTimeSeconds = 0.0;
+            }
+
+            pPlayer->lastTick = std::chrono::steady_clock::now() + std::chrono::milliseconds(responseDelayMs);
+            pPlayer->lastTimeUpdate = pPlayer->lastTick;
+
+            UpdateState(instanceId, *pPlayer, PlayerState::Playing, responseDelayMs);
+        }
+    }
+    else if (functionName == "pause")
+    {
+        if (pPlayer->state == PlayerState::Playing)
+        {
+            UpdateState(instanceId, *pPlayer, PlayerState::Paused, responseDelayMs);
+            SendTimeUpdate(instanceId, *pPlayer, responseDelayMs);
+        }
+    }
+    else if (functionName == "stop")
+    {
+        // like the web view, the player forgets the prepare id along with the source
+        pPlayer->hasPrepareId = false;
+
+        if (pPlayer->state != PlayerState::Uninitialized && pPlayer->state != PlayerState::Initialized)
+        {
+            pPlayer->currentTimeSeconds = 0.0;
+            UpdateState(instanceId, *pPlayer, PlayerState::Initialized, responseDelayMs);
+        }
+    }
+    else if (functionName == "seek")
+    {
+        double timeSeconds = 0.0;
+
+        if (!GetNumberArgument(functionArgumentsValue, 0, timeSeconds))
+        {
+            errorMessage = CYIString(VIDEO_PLAYER_CLASS_NAME) + " requires a numeric seek time.";
+            return false;
+        }
+
+        pPlayer->currentTimeSeconds = std::min(std::max(0.0, timeSeconds), GetMediaDurationSeconds());
+        SendTimeUpdate(instanceId, *pPlayer, responseDelayMs);
+        EmitEvent(instanceId, "seekCompleted", yi::rapidjson::Value(pPlayer->currentTimeSeconds), responseDelayMs + m_configuration.seekDelayMs);
+    }
+    else if (functionName == "getCurrentTime")
+    {
+        result.SetDouble(pPlayer->currentTimeSeconds);
+    }
+    else if (functionName == "getDuration")
+    {
+        result.SetDouble(GetMediaDurationSeconds());
+    }
+    else if (functionName == "isMuted")
+    {
+        result.SetBool(pPlayer->muted);
+    }
+    else if (functionName == "mute" || functionName == "unmute")
+    {
+        pPlayer->muted = functionName == "mute";
+        EmitEvent(instanceId, "muteStatusChanged", yi::rapidjson::Value(pPlayer->muted), responseDelayMs);
+        result.SetBool(pPlayer->muted);
+    }
+    else if (functionName == "getNickname")
+    {
+        result.SetString(pPlayer->nickname.GetData(), allocator);
+    }
+    else if (functionName == "setNickname")
+    {
+        const yi::rapidjson::Value *pNicknameValue = GetArgument(functionArgumentsValue, 0);
+        pPlayer->nickname = pNicknameValue && pNicknameValue->IsString() ? CYIString(pNicknameValue->GetString()) : CYIString();
+        result.SetString(pPlayer->nickname.GetData(), allocator);
+    }
+    else if (functionName == "setHidden")
+    {
+        const yi::rapidjson::Value *pHiddenValue = GetArgument(functionArgumentsValue, 0);
+        pPlayer->hidden = pHiddenValue && pHiddenValue->IsBool() && pHiddenValue->GetBool();
+    }
+    else if (functionName == "setTimeUpdateInterval")
+    {
+        double intervalMs = 0.0;
+
+        if (GetNumberArgument(functionArgumentsValue, 0, intervalMs))
+        {
+            pPlayer->timeUpdateIntervalMs = static_cast<uint32_t>(std::max(0.0, intervalMs));
+        }
+    }
+    else if (functionName == "setBufferLength")
+    {
+        double minimumBufferLengthMs = -1.0;
+        double maximumBufferLengthMs = -1.0;
+
+        GetNumberArgument(functionArgumentsValue, 0, minimumBufferLengthMs);
+        GetNumberArgument(functionArgumentsValue, 1, maximumBufferLengthMs);
+
+        // negative lengths fall back to the Video.js streaming engine defaults, and the maximum never drops below the minimum
+        minimumBufferLengthMs = minimumBufferLengthMs >= 0.0 ? minimumBufferLengthMs : DEFAULT_GOAL_BUFFER_LENGTH_MS;
+        maximumBufferLengthMs = std::max(minimumBufferLengthMs, maximumBufferLengthMs >= 0.0 ? maximumBufferLengthMs : DEFAULT_MAX_GOAL_BUFFER_LENGTH_MS);
+
+        yi::rapidjson::Value bufferLengthValue(yi::rapidjson::kObjectType);
+        bufferLengthValue.AddMember(yi::rapidjson::StringRef("minimumBufferLengthMs"), yi::rapidjson::Value(minimumBufferLengthMs), allocator);
+        bufferLengthValue.AddMember(yi::rapidjson::StringRef("maximumBufferLengthMs"), yi::rapidjson::Value(maximumBufferLengthMs), allocator);
+
+        EmitEvent(instanceId, "bufferLengthChanged", std::move(bufferLengthValue), responseDelayMs);
+    }
+
+    // any other function is accepted and returns null, the same as a void function in the web player
+
+    return true;
+}
+
+CYIVideojsSimulatedBridgeTransport::SimulatedPlayer *CYIVideojsSimulatedBridgeTransport::GetPlayer(int32_t instanceId, CYIString &errorMessage)
+{
+    std::map<int32_t, SimulatedPlayer>::iterator playerIterator = m_players.find(instanceId);
+
+    if (playerIterator == m_players.end())
+    {
+        errorMessage = CYIString("No ") + VIDEO_PLAYER_TYPE + " video player instance exists with id: " + CYIString::FromValue(instanceId);
+        return nullptr;
+    }
+
+    return &playerIterator->second;
+}
+
+void CYIVideojsSimulatedBridgeTransport::UpdateState(int32_t instanceId, SimulatedPlayer &player, PlayerState state, uint32_t delayMs)
+{
+    player.state = state;
+
+    yi::rapidjson::Document stateData(yi::rapidjson::kObjectType);
+    stateData.AddMember(yi::rapidjson::StringRef(STATE_ID_ATTRIBUTE_NAME), yi::rapidjson::Value(static_cast<int32_t>(state)), stateData.GetAllocator());
+
+    if (player.hasPrepareId)
+    {
+        stateData.AddMember(yi::rapidjson::StringRef(PREPARE_ID_ATTRIBUTE_NAME), yi::rapidjson::Value(player.prepareId), stateData.GetAllocator());
+    }
+
+    EmitEvent(instanceId, "stateChanged", std::move(stateData), delayMs);
+}
+
+void CYIVideojsSimulatedBridgeTransport::SendTimeUpdate(int32_t instanceId, SimulatedPlayer &player, uint32_t delayMs)
+{
+    // the whole media is treated as buffered so that buffer length reporting stays deterministic
+    double durationSeconds = GetMediaDurationSeconds();
+
+    yi::rapidjson::Document timeData(yi::rapidjson::kObjectType);
+    yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = timeData.GetAllocator();
+
+    timeData.AddMember(yi::rapidjson::StringRef("currentTimeSeconds"), yi::rapidjson::Value(player.currentTimeSeconds), allocator);
+    timeData.AddMember(yi::rapidjson::StringRef("bufferStartMs"), yi::rapidjson::Value(0.0), allocator);
+    timeData.AddMember(yi::rapidjson::StringRef("bufferEndMs"), yi::rapidjson::Value(durationSeconds * 1000.0), allocator);
+    timeData.AddMember(yi::rapidjson::StringRef("bufferLengthMs"), yi::rapidjson::Value((durationSeconds - player.currentTimeSeconds) * 1000.0), allocator);
+
+    player.lastTimeUpdate = std::chrono::steady_clock::now();
+
+    EmitEvent(instanceId, "videoTimeChanged", std::move(timeData), delayMs);
+}
+
+uint32_t CYIVideojsSimulatedBridgeTransport::GetResponseDelayMs()
+{
+    if (m_configuration.responseJitterMs == 0)
+    {
+        return m_configuration.responseDelayMs;
+    }
+
+    std::uniform_int_distribution<uint32_t> jitterDistribution(0, m_configuration.responseJitterMs);
+
+    return m_configuration.responseDelayMs + jitterDistribution(m_randomGenerator);
+}
+
+double CYIVideojsSimulatedBridgeTransport::GetMediaDurationSeconds() const
+{
+    return m_configuration.mediaDurationMs / 1000.0;
+}
+
+void CYIVideojsSimulatedBridgeTransport::DeliverEvent(const yi::rapidjson::Document &event)
+{
+    // handlers are collected up front since a callback may register or unregister handlers
+    std::vector<CYIWebMessagingBridge::EventCallback> callbacks;
+
+    for (const std::pair<const uint64_t, EventHandler> &eventHandler : m_eventHandlers)
+    {
+        if (MatchesFilter(*eventHandler.second.pFilter, event))
+        {
+            callbacks.push_back(eventHandler.second.callback);
+        }
+    }
+
+    m_eventCount++;
+
+    for (const CYIWebMessagingBridge::EventCallback &callback : callbacks)
+    {
+        callback(event);
+    }
+}
+
+void CYIVideojsSimulatedBridgeTransport::OnTickTimerTimedOut()
+{
+    ProcessEvents();
+
+    m_tickTimer.Start(TICK_INTERVAL_MS);
+}
+
+size_t CYIVideojsSimulatedBridgeTransport::ProcessEvents()
+{
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+    for (std::pair<const int32_t, SimulatedPlayer> &player : m_players)
+    {
+        SimulatedPlayer &simulatedPlayer = player.second;
+
+        if (simulatedPlayer.state != PlayerState::Playing || now < simulatedPlayer.lastTick)
+        {
+            continue;
+        }
+
+        simulatedPlayer.currentTimeSeconds += std::chrono::duration_cast<std::chrono::duration<double>>(now - simulatedPlayer.lastTick).count();
+        simulatedPlayer.lastTick = now;
+
+        if (simulatedPlayer.currentTimeSeconds >= GetMediaDurationSeconds())
+        {
+            simulatedPlayer.currentTimeSeconds = GetMediaDurationSeconds();
+            SendTimeUpdate(player.first, simulatedPlayer, 0);
+            UpdateState(player.first, simulatedPlayer, PlayerState::Complete, 0);
+        }
+        else if (now - simulatedPlayer.lastTimeUpdate >= std::chrono::milliseconds(simulatedPlayer.timeUpdateIntervalMs))
+        {
+            SendTimeUpdate(player.first, simulatedPlayer, 0);
+        }
+    }
+
+    // due events are detached first so that events emitted from within a callback wait for the next tick
+    std::vector<std::shared_ptr<yi::rapidjson::Document>> dueEvents;
+
+    while (!m_scheduledEvents.empty() && m_scheduledEvents.begin()->first <= now)
+    {
+        dueEvents.push_back(std::move(m_scheduledEvents.begin()->second));
+        m_scheduledEvents.erase(m_scheduledEvents.begin());
+    }
+
+    for (const std::shared_ptr<yi::rapidjson::Document> &pEvent : dueEvents)
+    {
+        DeliverEvent(*pEvent);
+    }
+
+    return dueEvents.size();
+}
@@ -0,0 +1,125 @@
+#ifndef _YI_VIDEOJS_SIMULATED_BRIDGE_TRANSPORT_H_
+#define _YI_VIDEOJS_SIMULATED_BRIDGE_TRANSPORT_H_
+
+#include "YiVideojsBridgeTransport.h"
+
+#include <signal/YiSignalHandler.h>
+#include <utility/YiTimer.h>
+
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <random>
+
+class CYIVideojsSimulatedBridgeTransport : public CYIVideojsBridgeTransport,
+                                           public CYISignalHandler
+{
+public:
+    struct Configuration
+    {
+        uint32_t responseDelayMs = 2;
+        uint32_t responseJitterMs = 0;
+        uint32_t prepareDelayMs = 50;
+        uint32_t seekDelayMs = 20;
+        uint64_t mediaDurationMs = 600000;
+        uint32_t timeUpdateIntervalMs = 250;
+        uint32_t randomSeed = 1;
+        double devicePixelRatio = 1.0;
+    };
+
+    typedef std::function<bool(int32_t instanceId, const yi::rapidjson::Value &functionArgumentsValue, yi::rapidjson::Document &result, CYIString &errorMessage)> FunctionHandler;
+
+    CYIVideojsSimulatedBridgeTransport();
+    explicit CYIVideojsSimulatedBridgeTransport(const Configuration &configuration);
+    virtual ~CYIVideojsSimulatedBridgeTransport();
+
+    const Configuration &GetConfiguration() const;
+    void SetConfiguration(const Configuration &configuration);
+
+    void SetAvailable(bool available);
+    void SetFunctionHandler(const CYIString &functionName, FunctionHandler handler);
+    void EmitEvent(int32_t instanceId, const CYIString &eventName, yi::rapidjson::Value &&data, uint32_t delayMs = 0);
+
+    // advances the simulated players and delivers every event that is due, the tick timer does this every 10 ms
+    // while the application runs and host tests without an application loop call it directly
+    size_t ProcessEvents();
+
+    uint64_t GetCallCount() const;
+    uint64_t GetMessageBytes() const;
+    uint64_t GetEventCount() const;
+    size_t GetEventHandlerCount() const;
+
+    virtual bool IsAvailable() const override;
+    virtual FutureResponse CallStaticFunction(yi::rapidjson::Document &&message, const CYIString &className, const CYIString &functionName, yi::rapidjson::Value &&functionArgumentsValue, bool *pMessageSent) override;
+    virtual FutureResponse CallInstanceFunction(yi::rapidjson::Document &&message, const CYIString &className, const CYIString &instanceAccessorName, const CYIString &functionName, yi::rapidjson::Value &&functionArgumentsValue, yi::rapidjson::Value &&instanceAccessorArgumentsValue, bool *pMessageSent) override;
+    virtual uint64_t RegisterEventHandler(yi::rapidjson::Document &&filterDocument, CYIWebMessagingBridge::EventCallback &&eventCallback) override;
+    virtual void UnregisterEventHandler(uint64_t eventHandlerId) override;
+
+private:
+    enum class PlayerState
+    {
+        Uninitialized = 0,
+        Initialized,
+        Loading,
+        Loaded,
+        Paused,
+        Playing,
+        Complete
+    };
+
+    struct SimulatedPlayer
+    {
+        PlayerState state = PlayerState::Uninitialized;
+        int32_t prepareId = 0;
+        bool hasPrepareId = false;
+        bool muted = false;
+        bool hidden = false;
+        CYIString nickname;
+        double currentTimeSeconds = 0.0;
+        uint32_t timeUpdateIntervalMs = 0;
+        std::chrono::steady_clock::time_point lastTick;
+        std::chrono::steady_clock::time_point lastTimeUpdate;
+    };
+
+    struct EventHandler
+    {
+        std::shared_ptr<yi::rapidjson::Document> pFilter;
+        CYIWebMessagingBridge::EventCallback callback;
+    };
+
+    void PostMessage(const yi::rapidjson::Document &message, const CYIString &className, const CYIString &instanceAccessorName, const CYIString &functionName, const yi::rapidjson::Value &functionArgumentsValue, const yi::rapidjson::Value &instanceAccessorArgumentsValue);
+    FutureResponse Invoke(int32_t instanceId, const CYIString &functionName, const yi::rapidjson::Value &functionArgumentsValue, bool *pMessageSent);
+    bool InvokeBuiltInFunction(int32_t instanceId, const CYIString &functionName, const yi::rapidjson::Value &functionArgumentsValue, yi::rapidjson::Document &result, CYIString &errorMessage, uint32_t responseDelayMs);
+    bool InvokeFunction(int32_t instanceId, const CYIString &functionName, const yi::rapidjson::Value &functionArgumentsValue, yi::rapidjson::Document &result, CYIString &errorMessage, uint32_t responseDelayMs);
+
+    SimulatedPlayer *GetPlayer(int32_t instanceId, CYIString &errorMessage);
+    void UpdateState(int32_t instanceId, SimulatedPlayer &player, PlayerState state, uint32_t delayMs);
+    void SendTimeUpdate(int32_t instanceId, SimulatedPlayer &player, uint32_t delayMs);
+    uint32_t GetResponseDelayMs();
+    double GetMediaDurationSeconds() const;
+
+    void DeliverEvent(const yi::rapidjson::Document &event);
+    void OnTickTimerTimedOut();
+
+    Configuration m_configuration;
+    bool m_available;
+    std::map<CYIString, FunctionHandler> m_functionHandlers;
+    std::map<int32_t, SimulatedPlayer> m_players;
+    std::map<uint64_t, EventHandler> m_eventHandlers;
+    std::multimap<std::chrono::steady_clock::time_point, std::shared_ptr<yi::rapidjson::Document>> m_scheduledEvents;
+    int32_t m_nextInstanceId;
+    uint64_t m_nextEventHandlerId;
+    uint64_t m_callCount;
+    uint64_t m_messageBytes;
+    yi::rapidjson::StringBuffer m_messageBuffer;
+    yi::rapidjson::Writer<yi::rapidjson::StringBuffer> m_messageWriter;
+    uint64_t m_eventCount;
+    std::mt19937 m_randomGenerator;
+    CYITimer m_tickTimer;
+};
+
+#endif // _YI_VIDEOJS_SIMULATED_BRIDGE_TRANSPORT_H_
@@ -1,13 +1,17 @@
-#include "player/YiVideojsVideoPlayer.h"
+#include "YiVideojsVideoPlayer.h"
 
-#include "player/YiVideojsVideoPlayerPriv.h"
-#include "player/YiVideojsVideoSurface.h"
+#include "YiVideojsBridgeRecorder.h"
+#include "YiVideojsEventDecoder.h"
+#include "YiVideojsVideoPlayerPriv.h"
+#include "YiVideojsVideoSurface.h"
 
-#include <platform/YiWebBridgeLocator.h>
 #include <player/YiPlayReadyDRMConfiguration.h>
 #include <player/YiVideoPlayerStateManager.h>
 #include <player/YiWidevineModularDRMConfiguration.h>
 
+#include <algorithm>
+#include <cmath>
+
 #define LOG_TAG "CYIVideojsVideoPlayer"
 
 YI_TYPE_DEF(CYIVideojsVideoPlayer, CYIAbstractVideoPlayer);
@@ -15,6 +19,85 @@ YI_TYPE_DEF(CYIVideojsVideoPlayer, CYIAbstractVideoPlayer);
 static const char *VIDEO_PLAYER_CLASS_NAME = "CYIVideojsVideoPlayer";
 static const char *VIDEO_PLAYER_INSTANCE_ACCESSOR_NAME = "getInstance";
 static const double BITRATE_KBPS_SCALE = 1000.0;
+static const uint32_t PENDING_COMMAND_POLL_INTERVAL_MS = 8;
+static const char *EXECUTE_BATCH_FUNCTION_NAME = "executeBatch";
+static const char *BATCH_COMMAND_NAME_ATTRIBUTE_NAME = "name";
+static const char *BATCH_COMMAND_ARGUMENTS_ATTRIBUTE_NAME = "args";
+static const char *BATCH_RESULT_ATTRIBUTE_NAME = "result";
+static const char *INSTANCE_ID_ATTRIBUTE_NAME = "instanceId";
+static const char *COMPACT_EVENT_VERSION_ATTRIBUTE_NAME = "compactEventVersion";
+static const uint64_t EVENT_SIZE_SAMPLE_INTERVAL = 32;
+static const uint64_t MINIMUM_CLOCK_INTERPOLATION_MS = 1000;
+static const uint64_t CLOCK_CORRECTION_TOLERANCE_MS = 250;
+static const char *BATCHED_FUNCTION_NAME_SUFFIX = " (batched)";
+static const uint32_t SEEK_COMPLETION_TIMEOUT_MS = 5000;
+static const uint32_t PREPARE_RESPONSE_TIMEOUT_MS = 3000;
+
+static int32_t s_nextPlayerInstanceId = 1;
+static uint64_t s_playerEventHandlerId = 0;
+static std::unordered_map<int32_t, CYIVideojsVideoPlayerPriv *> s_registeredPlayers;
+static std::unique_ptr<CYIVideojsBridgeRecorder> s_pBridgeRecorder;
+
+static const CYIAbstractVideoPlayer::StreamingFormat STREAMING_FORMATS[] = {
+    CYIAbstractVideoPlayer::StreamingFormat::HLS,
+    CYIAbstractVideoPlayer::StreamingFormat::Smooth,
+    CYIAbstractVideoPlayer::StreamingFormat::DASH,
+    CYIAbstractVideoPlayer::StreamingFormat::MP4
+};
+
+static const CYIAbstractVideoPlayer::DRMScheme DRM_SCHEMES[] = {
+    CYIAbstractVideoPlayer::DRMScheme::None,
+    CYIAbstractVideoPlayer::DRMScheme::FairPlay,
+    CYIAbstractVideoPlayer::DRMScheme::PlayReady,
+    CYIAbstractVideoPlayer::DRMScheme::WidevineModular,
+    CYIAbstractVideoPlayer::DRMScheme::WidevineModularCustomRequest
+};
+
+static size_t GetSupportedFormatIndex(CYIAbstractVideoPlayer::StreamingFormat format, CYIAbstractVideoPlayer::DRMScheme drmScheme)
+{
+    size_t formatIndex = std::find(std::begin(STREAMING_FORMATS), std::end(STREAMING_FORMATS), format) - std::begin(STREAMING_FORMATS);
+    size_t drmSchemeIndex = std::find(std::begin(DRM_SCHEMES), std::end(DRM_SCHEMES), drmScheme) - std::begin(DRM_SCHEMES);
+
+    return formatIndex * (sizeof(DRM_SCHEMES) / sizeof(DRM_SCHEMES[0])) + drmSchemeIndex;
+}
+
+void CYIVideojsVideoPlayer::BridgeLatencyHistogram::Record(uint64_t latencyMs)
+{
+    size_t bucket = 0;
+
+    while (bucket < BUCKET_COUNT - 1 && latencyMs >= (static_cast<uint64_t>(1) << bucket))
+    {
+        bucket++;
+    }
+
+    buckets[bucket]++;
+    responses++;
+    maximumLatencyMs = std::max(maximumLatencyMs, latencyMs);
+}
+
+uint64_t CYIVideojsVideoPlayer::BridgeLatencyHistogram::GetPercentileMs(float percentile) const
+{
+    if (responses == 0)
+    {
+        return 0;
+    }
+
+    uint64_t targetCount = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(responses * std::min(std::max(percentile, 0.0f), 100.0f) / 100.0f)));
+    uint64_t cumulativeCount = 0;
+
+    for (size_t bucket = 0; bucket < BUCKET_COUNT - 1; ++bucket)
+    {
+        cumulativeCount += buckets[bucket];
+
+        if (cumulativeCount >= targetCount)
+        {
+            return static_cast<uint64_t>(1) << bucket;
+        }
+    }
+
+    // the last bucket is open ended, so the slowest response observed is the only meaningful upper bound
+    return maximumLatencyMs;
+}
 
 CYIString StreamFormatToString(CYIAbstractVideoPlayer::StreamingFormat streamFormat)
 {
@@ -105,9 +188,24 @@ CYIString CYIVideojsVideoPlayerPriv::PlayerStateToString(PlayerState state)
 }
 
 CYIVideojsVideoPlayerPriv::CYIVideojsVideoPlayerPriv(CYIVideojsVideoPlayer *pPub, yi::rapidjson::Document &&playerConfiguration)
-    : m_messageHandlersRegistered(false)
+    : m_instanceId(s_nextPlayerInstanceId++)
+    , m_surfaceAttached(false)
+    , m_initialized(false)
+    , m_messageHandlersRegistered(false)
+    , m_videoRectangleRequestInFlight(false)
+    , m_videoRectanglePending(false)
+    , m_videoRectangleSize(0, 0)
+    , m_devicePixelRatio(1.0)
+    , m_maxResolution(0, 0)
+    , m_automaticResolutionCapEnabled(false)
+    , m_sentResolutionCap(0, 0)
+    , m_hasSelectedRendition(false)
+    , m_hasSentABRRendition(false)
+    , m_sentABRRenditionId(0)
     , m_stateBeforeBuffering(CYIAbstractVideoPlayer::PlaybackState::Paused)
     , m_currentTimeMs(0)
+    , m_lastInterpolatedTimeMs(0)
+    , m_timeUpdateIntervalMs(0)
     , m_durationMs(0)
     , m_buffering(false)
     , m_isLive(false)
@@ -118,74 +216,364 @@ CYIVideojsVideoPlayerPriv::CYIVideojsVideoPlayerPriv(CYIVideojsVideoPlayer *pPub
     , m_initialTotalBitrateKbps(-1.0f)
     , m_currentTotalBitrateKbps(-1.0f)
     , m_bufferLengthMs(-1.0f)
+    , m_requestedBufferLength(std::chrono::milliseconds(-1), std::chrono::milliseconds(-1))
+    , m_bufferLength(std::chrono::milliseconds(-1), std::chrono::milliseconds(-1))
     , m_playerConfiguration(std::move(playerConfiguration))
-    , m_bitrateChangedEventHandlerId(0)
-    , m_bufferingStateChangedEventHandlerId(0)
-    , m_liveStatusEventHandlerId(0)
-    , m_playerErrorEventHandlerId(0)
-    , m_audioTracksChangedEventHandlerId(0)
-    , m_videoDurationChangedEventHandlerId(0)
-    , m_videoTimeChangedEventHandlerId(0)
-    , m_stateChangedEventHandlerId(0)
-    , m_textTracksChangedEventHandlerId(0)
-    , m_metadataAvailableEventHandlerId(0)
+    , m_prepareId(0)
+    , m_preparing(false)
+    , m_prepareResponsePending(false)
+    , m_seekInFlight(false)
+    , m_seekPending(false)
+    , m_awaitingSeekPlayback(false)
+    , m_pendingSeekPositionMs(0)
+    , m_supportedFormatsProbed(false)
+    , m_muted(false)
+    , m_textTrackEnabled(false)
+    , m_activeAudioTrack(0)
+    , m_activeTextTrack(0)
+    , m_stateMirrorValidationEnabled(false)
+    , m_asynchronousCommandsEnabled(false)
+    , m_commandBatchingEnabled(false)
+    , m_commandBatchWriter(m_commandBatchBuffer)
+    , m_compactEventEncodingRequested(false)
+    , m_compactEventEncodingActive(false)
+    , m_bridgeLatencyLogIntervalMs(0)
     , m_pPub(pPub)
 {
+    m_pendingCommandTimer.TimedOut.Connect(*this, &CYIVideojsVideoPlayerPriv::OnPendingCommandTimerTimedOut);
+    m_commandBatchTimer.TimedOut.Connect(*this, &CYIVideojsVideoPlayerPriv::OnCommandBatchTimerTimedOut);
+    m_bridgeLatencyLogTimer.TimedOut.Connect(*this, &CYIVideojsVideoPlayerPriv::OnBridgeLatencyLogTimerTimedOut);
+    m_seekTimeoutTimer.TimedOut.Connect(*this, &CYIVideojsVideoPlayerPriv::OnSeekTimeoutTimerTimedOut);
+    m_prepareResponseTimer.TimedOut.Connect(*this, &CYIVideojsVideoPlayerPriv::OnPrepareResponseTimerTimedOut);
+
     RegisterEventHandlers();
 }
 
 CYIVideojsVideoPlayerPriv::~CYIVideojsVideoPlayerPriv()
 {
+    m_bridgeLatencyLogTimer.Stop();
+    m_seekTimeoutTimer.Stop();
+    m_prepareResponseTimer.Stop();
+
+    m_commandBatchTimer.Stop();
+    m_queuedCommands.clear();
+
+    m_pendingCommandTimer.Stop();
+    m_pendingCommands.clear();
+
     DestroyPlayerInstance();
     UnregisterEventHandlers();
 }
 
 void CYIVideojsVideoPlayerPriv::SetVideoRectangle(const YI_RECT_REL &videoRectangle)
 {
-    static const char *FUNCTION_NAME = "setVideoRectangle";
-
     if(videoRectangle == m_previousVideoRectangle) {
         return;
     }
 
     m_previousVideoRectangle = videoRectangle;
+    m_videoRectangleSize = glm::ivec2(videoRectangle.width, videoRectangle.height);
 
-    yi::rapidjson::Document command(yi::rapidjson::kObjectType);
-    yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = command.GetAllocator();
+    if (m_automaticResolutionCapEnabled)
+    {
+        UpdateResolutionCap();
+    }
 
-    yi::rapidjson::Value arguments(yi::rapidjson::kArrayType);
-    arguments.PushBack(videoRectangle.x, allocator);
-    arguments.PushBack(videoRectangle.y, allocator);
-    arguments.PushBack(videoRectangle.width, allocator);
-    arguments.PushBack(videoRectangle.height, allocator);
+    // while a request is in flight only the most recent rectangle is kept, it is sent as soon as the web view responds
+    if (m_videoRectangleRequestInFlight)
+    {
+        m_pendingVideoRectangle = videoRectangle;
+        m_videoRectanglePending = true;
+        return;
+    }
+
+    SendVideoRectangle(videoRectangle);
+}
+
+void CYIVideojsVideoPlayerPriv::SendVideoRectangle(const YI_RECT_REL &videoRectangle)
+{
+    static const char *FUNCTION_NAME = "setVideoRectangle";
 
     bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallPlayerInstanceFunction(std::move(command), FUNCTION_NAME, std::move(arguments), &messageSent);
+    CYIVideojsBridgeTransport::FutureResponse futureResponse = SendPlayerFunction(FUNCTION_NAME, &messageSent, videoRectangle.x, videoRectangle.y, videoRectangle.width, videoRectangle.height);
 
     if (!messageSent)
     {
         YI_LOGE(LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
+        return;
     }
-    else
+
+    m_videoRectangleRequestInFlight = true;
+
+    PendingCommand pendingCommand;
+    pendingCommand.functionName = FUNCTION_NAME;
+    pendingCommand.futureResponse = std::move(futureResponse);
+    pendingCommand.sentTime = std::chrono::steady_clock::now();
+    pendingCommand.timeoutMs = CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS;
+    pendingCommand.finishedCallback = [this]() {
+        OnVideoRectangleRequestFinished();
+    };
+
+    EnqueuePendingCommand(std::move(pendingCommand));
+}
+
+void CYIVideojsVideoPlayerPriv::OnVideoRectangleRequestFinished()
+{
+    m_videoRectangleRequestInFlight = false;
+
+    if (m_videoRectanglePending)
+    {
+        m_videoRectanglePending = false;
+        SendVideoRectangle(m_pendingVideoRectangle);
+    }
+}
+
+void CYIVideojsVideoPlayerPriv::SetMaxResolution(const glm::ivec2 &maxResolution)
+{
+    m_maxResolution = glm::ivec2(std::max(maxResolution.x, 0), std::max(maxResolution.y, 0));
+
+    UpdateResolutionCap();
+}
+
+glm::ivec2 CYIVideojsVideoPlayerPriv::GetMaxResolution() const
+{
+    return m_maxResolution;
+}
+
+void CYIVideojsVideoPlayerPriv::SetAutomaticResolutionCapEnabled(bool enabled)
+{
+    m_automaticResolutionCapEnabled = enabled;
+
+    UpdateResolutionCap();
+}
+
+bool CYIVideojsVideoPlayerPriv::IsAutomaticResolutionCapEnabled() const
+{
+    return m_automaticResolutionCapEnabled;
+}
+
+std::vector<CYIVideojsVideoPlayer::VideoRendition> CYIVideojsVideoPlayerPriv::GetVideoRenditions() const
+{
+    return m_videoRenditions;
+}
+
+bool CYIVideojsVideoPlayerPriv::SelectRendition(uint32_t id)
+{
+    static const char *FUNCTION_NAME = "selectRendition";
+
+    std::vector<CYIVideojsVideoPlayer::VideoRendition>::const_iterator renditionIterator = std::find_if(m_videoRenditions.begin(), m_videoRenditions.end(), [id](const CYIVideojsVideoPlayer::VideoRendition &rendition) {
+        return rendition.id == id;
+    });
+
+    if (renditionIterator == m_videoRenditions.end())
+    {
+        YI_LOGE(LOG_TAG, "SelectRendition failed, rendition %u is not part of the current ladder of %u video rendition(s).", id, static_cast<uint32_t>(m_videoRenditions.size()));
+        return false;
+    }
+
+    m_hasSelectedRendition = true;
+
+    DispatchPlayerCommand(FUNCTION_NAME, id);
+
+    return true;
+}
+
+void CYIVideojsVideoPlayerPriv::SelectAutomaticRendition()
+{
+    static const char *FUNCTION_NAME = "selectAutomaticRendition";
+
+    m_hasSelectedRendition = false;
+
+    if (!m_initialized)
+    {
+        return;
+    }
+
+    DispatchPlayerCommand(FUNCTION_NAME);
+}
+
+bool CYIVideojsVideoPlayerPriv::IsAutomaticRenditionSelectionEnabled() const
+{
+    return !m_hasSelectedRendition;
+}
+
+void CYIVideojsVideoPlayerPriv::SetABRController(std::unique_ptr<CYIVideojsABRController> pABRController)
+{
+    m_pABRController = std::move(pABRController);
+    m_hasSentABRRendition = false;
+
+    // a controller installed mid-stream has missed the renditionsChanged event for the current source
+    NotifyABRControllerRenditions();
+    SendExternalABREnabled();
+}
+
+CYIVideojsABRController *CYIVideojsVideoPlayerPriv::GetABRController() const
+{
+    return m_pABRController.get();
+}
+
+void CYIVideojsVideoPlayerPriv::SendExternalABREnabled()
+{
+    static const char *FUNCTION_NAME = "setExternalABREnabled";
+
+    if (!m_initialized)
+    {
+        return;
+    }
+
+    DispatchPlayerCommand(FUNCTION_NAME, m_pABRController != nullptr);
+}
+
+void CYIVideojsVideoPlayerPriv::NotifyABRControllerRenditions()
+{
+    if (!m_pABRController || m_videoRenditions.empty())
+    {
+        return;
+    }
+
+    std::vector<uint64_t> bitratesKbps;
+    bitratesKbps.reserve(m_videoRenditions.size());
+
+    for (const CYIVideojsVideoPlayer::VideoRendition &rendition : m_videoRenditions)
+    {
+        bitratesKbps.push_back(rendition.bitrateKbps);
+    }
+
+    m_pABRController->OnRenditionsChanged(bitratesKbps);
+}
+
+void CYIVideojsVideoPlayerPriv::UpdateResolutionCap()
+{
+    static const char *FUNCTION_NAME = "setMaxResolution";
+
+    glm::ivec2 resolutionCap = m_maxResolution;
+
+    if (m_automaticResolutionCapEnabled && m_videoRectangleSize.x > 0 && m_videoRectangleSize.y > 0)
+    {
+        // the rectangle is in web view layout units while renditions are measured in device pixels
+        glm::ivec2 surfaceSize(static_cast<int32_t>(std::ceil(m_videoRectangleSize.x * m_devicePixelRatio)), static_cast<int32_t>(std::ceil(m_videoRectangleSize.y * m_devicePixelRatio)));
+        glm::ivec2 surfaceCap = QuantizeResolutionCap(surfaceSize);
+
+        // a component of 0 is unlimited, so the surface cap replaces it rather than being compared against it
+        if (surfaceCap.x > 0)
+        {
+            resolutionCap.x = resolutionCap.x > 0 ? std::min(resolutionCap.x, surfaceCap.x) : surfaceCap.x;
+        }
+
+        if (surfaceCap.y > 0)
+        {
+            resolutionCap.y = resolutionCap.y > 0 ? std::min(resolutionCap.y, surfaceCap.y) : surfaceCap.y;
+        }
+    }
+
+    // the rectangle changes every frame while the surface animates, the quantized cap only changes when it crosses a rendition
+    if (!m_initialized || resolutionCap == m_sentResolutionCap)
+    {
+        return;
+    }
+
+    m_sentResolutionCap = resolutionCap;
+
+    DispatchPlayerCommand(FUNCTION_NAME, static_cast<int32_t>(resolutionCap.x), static_cast<int32_t>(resolutionCap.y));
+}
+
+glm::ivec2 CYIVideojsVideoPlayerPriv::QuantizeResolutionCap(const glm::ivec2 &surfaceSize) const
+{
+    // used until the web view has pushed the ladder of the current source
+    static const glm::ivec2 STANDARD_RESOLUTIONS[] = {
+        glm::ivec2(426, 240),
+        glm::ivec2(640, 360),
+        glm::ivec2(854, 480),
+        glm::ivec2(1280, 720),
+        glm::ivec2(1920, 1080),
+        glm::ivec2(2560, 1440),
+        glm::ivec2(3840, 2160)
+    };
+
+    glm::ivec2 resolutionCap(0, 0);
+    bool hasSizedRendition = false;
+
+    // the cap is rounded up to the smallest rendition that covers the surface, so that rendition is never filtered out
+    for (const CYIVideojsVideoPlayer::VideoRendition &rendition : m_videoRenditions)
     {
-        bool valueAssigned = false;
-        CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
+        if (rendition.width <= 0 || rendition.height <= 0)
+        {
+            continue;
+        }
 
-        if (!valueAssigned)
+        hasSizedRendition = true;
+
+        if (rendition.width >= surfaceSize.x && rendition.height >= surfaceSize.y && (resolutionCap.y == 0 || rendition.height < resolutionCap.y || (rendition.height == resolutionCap.y && rendition.width < resolutionCap.x)))
         {
-            YI_LOGE(LOG_TAG, "SetVideoRectangle did not receive a response from the web messaging bridge!");
+            resolutionCap = glm::ivec2(rendition.width, rendition.height);
         }
-        else if (response.HasError())
+    }
+
+    // a surface larger than every rendition leaves the ladder unlimited
+    if (hasSizedRendition)
+    {
+        return resolutionCap;
+    }
+
+    for (const glm::ivec2 &standardResolution : STANDARD_RESOLUTIONS)
+    {
+        if (standardResolution.x >= surfaceSize.x && standardResolution.y >= surfaceSize.y)
         {
-            YI_LOGE(LOG_TAG, "%s", response.GetError()->GetMessage().GetData());
+            return standardResolution;
         }
     }
+
+    return glm::ivec2(0, 0);
 }
 
 void CYIVideojsVideoPlayerPriv::Init()
 {
     CreatePlayerInstance();
     InitializePlayerInstance();
+    ProbeSupportedFormats();
+
+    m_initialized = true;
+
+    // the web player may have been given a default nickname, the mirror has to start out from that value
+    m_nickname = QueryNickname();
+    m_devicePixelRatio = QueryDevicePixelRatio();
+
+    if (m_timeUpdateIntervalMs > 0)
+    {
+        SetTimeUpdateIntervalMs(m_timeUpdateIntervalMs);
+    }
+
+    // the web player answers with the buffer goals it applied, so GetBufferLength is accurate before the first prepare
+    SetBufferLength(m_requestedBufferLength);
+
+    UpdateResolutionCap();
+
+    if (m_pABRController)
+    {
+        SendExternalABREnabled();
+    }
+
+    // players that are not attached to a surface view, such as warm standby instances, stay hidden while they load
+    SetSurfaceAttached(m_surfaceAttached);
+}
+
+void CYIVideojsVideoPlayerPriv::SetSurfaceAttached(bool attached)
+{
+    static const char *FUNCTION_NAME = "setHidden";
+
+    m_surfaceAttached = attached;
+
+    if (!m_initialized)
+    {
+        return;
+    }
+
+    DispatchPlayerCommand(FUNCTION_NAME, !attached);
+}
+
+int32_t CYIVideojsVideoPlayerPriv::GetInstanceId() const
+{
+    return m_instanceId;
 }
 
 void CYIVideojsVideoPlayerPriv::CreatePlayerInstance()
@@ -198,17 +586,47 @@ void CYIVideojsVideoPlayerPriv::CreatePlayerInstance()
     yi::rapidjson::Value arguments(yi::rapidjson::kArrayType);
 
     arguments.PushBack(m_playerConfiguration, allocator);
+    arguments.PushBack(yi::rapidjson::Value(m_instanceId), allocator);
+
+    yi::rapidjson::Value eventEncodingValue(yi::rapidjson::kObjectType);
+
+    if (m_compactEventEncodingRequested)
+    {
+        eventEncodingValue.AddMember(yi::rapidjson::StringRef(COMPACT_EVENT_VERSION_ATTRIBUTE_NAME), yi::rapidjson::Value(static_cast<int32_t>(CYIVideojsEventDecoder::COMPACT_EVENT_VERSION)), allocator);
+    }
+
+    arguments.PushBack(eventEncodingValue, allocator);
 
     bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallStaticPlayerFunction(std::move(command), FUNCTION_NAME, std::move(arguments), &messageSent);
+    CYIVideojsBridgeTransport::FutureResponse futureResponse = CallStaticPlayerFunction(std::move(command), FUNCTION_NAME, std::move(arguments), &messageSent);
 
     YI_ASSERT(messageSent, LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
 
     bool valueAssigned = false;
-    CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
+    CYIVideojsBridgeTransport::Response response = TakeResponse(FUNCTION_NAME, futureResponse, &valueAssigned);
 
     YI_ASSERT(valueAssigned, LOG_TAG, "Failed to create Video.js video player instance, no response received from web messaging bridge!");
-    YI_ASSERT(!response.HasError(), LOG_TAG, "%s", response.GetError()->GetMessage().GetData());
+    YI_ASSERT(!response.HasError(), LOG_TAG, "%s", response.GetErrorMessage().GetData());
+
+    m_compactEventEncodingActive = false;
+
+    if (m_compactEventEncodingRequested)
+    {
+        const yi::rapidjson::Value *pData = response.GetResult();
+
+        // older web players resolve with only the instance id, in which case events remain in the verbose encoding
+        if (pData && pData->IsObject() && pData->HasMember(COMPACT_EVENT_VERSION_ATTRIBUTE_NAME))
+        {
+            const yi::rapidjson::Value &compactEventVersionValue = (*pData)[COMPACT_EVENT_VERSION_ATTRIBUTE_NAME];
+
+            m_compactEventEncodingActive = compactEventVersionValue.IsInt() && compactEventVersionValue.GetInt() == CYIVideojsEventDecoder::COMPACT_EVENT_VERSION;
+        }
+
+        if (!m_compactEventEncodingActive)
+        {
+            YI_LOGW(LOG_TAG, "Web player did not accept compact event version %d, falling back to verbose events.", static_cast<int32_t>(CYIVideojsEventDecoder::COMPACT_EVENT_VERSION));
+        }
+    }
 }
 
 void CYIVideojsVideoPlayerPriv::InitializePlayerInstance()
@@ -220,15 +638,15 @@ void CYIVideojsVideoPlayerPriv::InitializePlayerInstance()
     yi::rapidjson::Value arguments(yi::rapidjson::kArrayType);
 
     bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallPlayerInstanceFunction(std::move(command), FUNCTION_NAME, std::move(arguments), &messageSent);
+    CYIVideojsBridgeTransport::FutureResponse futureResponse = CallPlayerInstanceFunction(std::move(command), FUNCTION_NAME, std::move(arguments), &messageSent);
 
     YI_ASSERT(messageSent, LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
 
     bool valueAssigned = false;
-    CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
+    CYIVideojsBridgeTransport::Response response = TakeResponse(FUNCTION_NAME, futureResponse, &valueAssigned);
 
     YI_ASSERT(valueAssigned, LOG_TAG, "Failed to initialize Video.js video player instance, no response received from web messaging bridge!");
-    YI_ASSERT(!response.HasError(), LOG_TAG, "%s", response.GetError()->GetMessage().GetData());
+    YI_ASSERT(!response.HasError(), LOG_TAG, "%s", response.GetErrorMessage().GetData());
 }
 
 void CYIVideojsVideoPlayerPriv::DestroyPlayerInstance()
@@ -308,24 +726,79 @@ bool CYIVideojsVideoPlayerPriv::ConvertValueToTrackInfo(const yi::rapidjson::Val
     return true;
 }
 
-uint64_t CYIVideojsVideoPlayerPriv::RegisterEventHandler(const CYIString &eventName, CYIWebMessagingBridge::EventCallback &&eventCallback)
+const std::unordered_map<std::string, CYIVideojsVideoPlayerPriv::EventHandler> &CYIVideojsVideoPlayerPriv::GetEventHandlers()
+{
+    static const std::unordered_map<std::string, EventHandler> eventHandlers = {
+        { "bitrateChanged", &CYIVideojsVideoPlayerPriv::OnBitrateChanged },
+        { "bufferingStateChanged", &CYIVideojsVideoPlayerPriv::OnBufferingStateChanged },
+        { "liveStatus", &CYIVideojsVideoPlayerPriv::OnLiveStatusUpdated },
+        { "playerError", &CYIVideojsVideoPlayerPriv::OnPlayerErrorThrown },
+        { "audioTracksChanged", &CYIVideojsVideoPlayerPriv::OnAudioTracksChanged },
+        { "videoDurationChanged", &CYIVideojsVideoPlayerPriv::OnVideoDurationChanged },
+        { "videoTimeChanged", &CYIVideojsVideoPlayerPriv::OnVideoTimeChanged },
+        { "stateChanged", &CYIVideojsVideoPlayerPriv::OnStateChanged },
+        { "textTracksChanged", &CYIVideojsVideoPlayerPriv::OnTextTracksChanged },
+        { "metadataAvailable", &CYIVideojsVideoPlayerPriv::OnMetadataAvailable },
+        { "muteStatusChanged", &CYIVideojsVideoPlayerPriv::OnMuteStatusChanged },
+        { "textTrackStatusChanged", &CYIVideojsVideoPlayerPriv::OnTextTrackStatusChanged },
+        { "activeAudioTrackChanged", &CYIVideojsVideoPlayerPriv::OnActiveAudioTrackChanged },
+        { "activeTextTrackChanged", &CYIVideojsVideoPlayerPriv::OnActiveTextTrackChanged },
+        { "seekCompleted", &CYIVideojsVideoPlayerPriv::OnSeekCompleted },
+        { "seekableRangesChanged", &CYIVideojsVideoPlayerPriv::OnSeekableRangesChanged },
+        { "bufferLengthChanged", &CYIVideojsVideoPlayerPriv::OnBufferLengthChanged },
+        { "renditionsChanged", &CYIVideojsVideoPlayerPriv::OnRenditionsChanged },
+        { "segmentDownloaded", &CYIVideojsVideoPlayerPriv::OnSegmentDownloaded }
+    };
+
+    return eventHandlers;
+}
+
+void CYIVideojsVideoPlayerPriv::OnPlayerEvent(const yi::rapidjson::Value &eventValue)
 {
-    yi::rapidjson::Document filter(yi::rapidjson::kObjectType);
-    yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = filter.GetAllocator();
+    if (!eventValue.IsObject())
+    {
+        YI_LOGE(LOG_TAG, "OnPlayerEvent encountered an invalid event value, expected object, received %s. JSON string for event: %s", CYIRapidJSONUtility::TypeToString(eventValue.GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(eventValue).GetData());
+        return;
+    }
 
-    yi::rapidjson::Value contextNameValue(VIDEO_PLAYER_CLASS_NAME, allocator);
-    filter.AddMember(yi::rapidjson::StringRef(CYIWebMessagingBridge::EVENT_CONTEXT_ATTRIBUTE_NAME), contextNameValue, allocator);
+    if (s_pBridgeRecorder)
+    {
+        s_pBridgeRecorder->RecordEvent(eventValue);
+    }
 
-    yi::rapidjson::Value eventNameValue(eventName.GetData(), allocator);
-    filter.AddMember(yi::rapidjson::StringRef(CYIWebMessagingBridge::EVENT_NAME_ATTRIBUTE_NAME), eventNameValue, allocator);
+    yi::rapidjson::Value::ConstMemberIterator instanceIdIterator = eventValue.FindMember(INSTANCE_ID_ATTRIBUTE_NAME);
 
-    return CYIWebBridgeLocator::GetWebMessagingBridge()->RegisterEventHandler(std::move(filter), std::move(eventCallback));
-}
+    if (instanceIdIterator == eventValue.MemberEnd() || !instanceIdIterator->value.IsInt())
+    {
+        YI_LOGE(LOG_TAG, "OnPlayerEvent event value is missing a valid '%s' attribute! JSON string for event: %s", INSTANCE_ID_ATTRIBUTE_NAME, CYIRapidJSONUtility::CreateStringFromValue(eventValue).GetData());
+        return;
+    }
 
-void CYIVideojsVideoPlayerPriv::UnregisterEventHandler(uint64_t &eventHandlerId)
-{
-    CYIWebBridgeLocator::GetWebMessagingBridge()->UnregisterEventHandler(eventHandlerId);
-    eventHandlerId = 0;
+    std::unordered_map<int32_t, CYIVideojsVideoPlayerPriv *>::const_iterator playerIterator = s_registeredPlayers.find(instanceIdIterator->value.GetInt());
+
+    // events can still arrive for an instance that was destroyed while they were queued in the web view
+    if (playerIterator == s_registeredPlayers.end())
+    {
+        return;
+    }
+
+    yi::rapidjson::Value::ConstMemberIterator eventNameIterator = eventValue.FindMember(CYIWebMessagingBridge::EVENT_NAME_ATTRIBUTE_NAME);
+
+    if (eventNameIterator == eventValue.MemberEnd() || !eventNameIterator->value.IsString())
+    {
+        YI_LOGE(LOG_TAG, "OnPlayerEvent event value is missing a valid '%s' attribute! JSON string for event: %s", CYIWebMessagingBridge::EVENT_NAME_ATTRIBUTE_NAME, CYIRapidJSONUtility::CreateStringFromValue(eventValue).GetData());
+        return;
+    }
+
+    const std::unordered_map<std::string, EventHandler> &eventHandlers = GetEventHandlers();
+    std::unordered_map<std::string, EventHandler>::const_iterator eventHandlerIterator = eventHandlers.find(std::string(eventNameIterator->value.GetString(), eventNameIterator->value.GetStringLength()));
+
+    if (eventHandlerIterator == eventHandlers.end())
+    {
+        return;
+    }
+
+    (playerIterator->second->*(eventHandlerIterator->second))(eventValue);
 }
 
 void CYIVideojsVideoPlayerPriv::RegisterEventHandlers()
@@ -335,16 +808,19 @@ void CYIVideojsVideoPlayerPriv::RegisterEventHandlers()
         return;
     }
 
-    m_bitrateChangedEventHandlerId = RegisterEventHandler("bitrateChanged", std::bind(&CYIVideojsVideoPlayerPriv::OnBitrateChanged, this, std::placeholders::_1));
-    m_bufferingStateChangedEventHandlerId = RegisterEventHandler("bufferingStateChanged", std::bind(&CYIVideojsVideoPlayerPriv::OnBufferingStateChanged, this, std::placeholders::_1));
-    m_liveStatusEventHandlerId = RegisterEventHandler("liveStatus", std::bind(&CYIVideojsVideoPlayerPriv::OnLiveStatusUpdated, this, std::placeholders::_1));
-    m_playerErrorEventHandlerId = RegisterEventHandler("playerError", std::bind(&CYIVideojsVideoPlayerPriv::OnPlayerErrorThrown, this, std::placeholders::_1));
-    m_audioTracksChangedEventHandlerId = RegisterEventHandler("audioTracksChanged", std::bind(&CYIVideojsVideoPlayerPriv::OnAudioTracksChanged, this, std::placeholders::_1));
-    m_videoDurationChangedEventHandlerId = RegisterEventHandler("videoDurationChanged", std::bind(&CYIVideojsVideoPlayerPriv::OnVideoDurationChanged, this, std::placeholders::_1));
-    m_videoTimeChangedEventHandlerId = RegisterEventHandler("videoTimeChanged", std::bind(&CYIVideojsVideoPlayerPriv::OnVideoTimeChanged, this, std::placeholders::_1));
-    m_stateChangedEventHandlerId = RegisterEventHandler("stateChanged", std::bind(&CYIVideojsVideoPlayerPriv::OnStateChanged, this, std::placeholders::_1));
-    m_textTracksChangedEventHandlerId = RegisterEventHandler("textTracksChanged", std::bind(&CYIVideojsVideoPlayerPriv::OnTextTracksChanged, this, std::placeholders::_1));
-    m_metadataAvailableEventHandlerId = RegisterEventHandler("metadataAvailable", std::bind(&CYIVideojsVideoPlayerPriv::OnMetadataAvailable, this, std::placeholders::_1));
+    // a single bridge handler is shared by every instance, events are routed to the owning instance by id
+    if (s_registeredPlayers.empty())
+    {
+        yi::rapidjson::Document filter(yi::rapidjson::kObjectType);
+        yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = filter.GetAllocator();
+
+        yi::rapidjson::Value contextNameValue(VIDEO_PLAYER_CLASS_NAME, allocator);
+        filter.AddMember(yi::rapidjson::StringRef(CYIWebMessagingBridge::EVENT_CONTEXT_ATTRIBUTE_NAME), contextNameValue, allocator);
+
+        s_playerEventHandlerId = CYIVideojsBridgeTransport::GetTransport()->RegisterEventHandler(std::move(filter), &CYIVideojsVideoPlayerPriv::OnPlayerEvent);
+    }
+
+    s_registeredPlayers[m_instanceId] = this;
 
     m_messageHandlersRegistered = true;
 }
@@ -356,157 +832,751 @@ void CYIVideojsVideoPlayerPriv::UnregisterEventHandlers()
         return;
     }
 
-    UnregisterEventHandler(m_bitrateChangedEventHandlerId);
-    UnregisterEventHandler(m_bufferingStateChangedEventHandlerId);
-    UnregisterEventHandler(m_liveStatusEventHandlerId);
-    UnregisterEventHandler(m_playerErrorEventHandlerId);
-    UnregisterEventHandler(m_audioTracksChangedEventHandlerId);
-    UnregisterEventHandler(m_videoDurationChangedEventHandlerId);
-    UnregisterEventHandler(m_videoTimeChangedEventHandlerId);
-    UnregisterEventHandler(m_stateChangedEventHandlerId);
-    UnregisterEventHandler(m_textTracksChangedEventHandlerId);
-    UnregisterEventHandler(m_metadataAvailableEventHandlerId);
+    s_registeredPlayers.erase(m_instanceId);
+
+    if (s_registeredPlayers.empty())
+    {
+        CYIVideojsBridgeTransport::GetTransport()->UnregisterEventHandler(s_playerEventHandlerId);
+        s_playerEventHandlerId = 0;
+    }
 
     m_messageHandlersRegistered = false;
 }
 
-CYIWebMessagingBridge::FutureResponse CYIVideojsVideoPlayerPriv::CallStaticPlayerFunction(yi::rapidjson::Document &&message, const CYIString &functionName, yi::rapidjson::Value &&playerFunctionArgumentsValue, bool *pMessageSent) const
+CYIVideojsBridgeTransport::FutureResponse CYIVideojsVideoPlayerPriv::CallStaticPlayerFunction(yi::rapidjson::Document &&message, const CYIString &functionName, yi::rapidjson::Value &&playerFunctionArgumentsValue, bool *pMessageSent) const
 {
-    return CYIWebBridgeLocator::GetWebMessagingBridge()->CallStaticFunctionWithArgs(std::move(message), VIDEO_PLAYER_CLASS_NAME, functionName, std::move(playerFunctionArgumentsValue), pMessageSent);
-}
+    FlushCommandBatch(CommandBatchFlushReason::Barrier);
 
-CYIWebMessagingBridge::FutureResponse CYIVideojsVideoPlayerPriv::CallPlayerInstanceFunction(yi::rapidjson::Document &&message, const CYIString &functionName, yi::rapidjson::Value &&playerFunctionArgumentsValue, bool *pMessageSent) const
-{
-    return CYIWebBridgeLocator::GetWebMessagingBridge()->CallInstanceFunctionWithArgs(std::move(message), VIDEO_PLAYER_CLASS_NAME, VIDEO_PLAYER_INSTANCE_ACCESSOR_NAME, functionName, std::move(playerFunctionArgumentsValue), yi::rapidjson::Value(yi::rapidjson::kArrayType), pMessageSent);
+    if (s_pBridgeRecorder)
+    {
+        s_pBridgeRecorder->RecordCall(0, functionName, playerFunctionArgumentsValue);
+    }
+
+    return CYIVideojsBridgeTransport::GetTransport()->CallStaticFunction(std::move(message), VIDEO_PLAYER_CLASS_NAME, functionName, std::move(playerFunctionArgumentsValue), pMessageSent);
 }
 
-void CYIVideojsVideoPlayerPriv::OnBitrateChanged(const yi::rapidjson::Value &eventValue)
+CYIVideojsBridgeTransport::FutureResponse CYIVideojsVideoPlayerPriv::CallPlayerInstanceFunction(yi::rapidjson::Document &&message, const CYIString &functionName, yi::rapidjson::Value &&playerFunctionArgumentsValue, bool *pMessageSent) const
 {
-    static const char *INITIAL_AUDIO_BITRATE_ATTRIBUTE_NAME = "initialAudioBitrateKbps";
-    static const char *CURRENT_AUDIO_BITRATE_ATTRIBUTE_NAME = "currentAudioBitrateKbps";
-    static const char *INITIAL_VIDEO_BITRATE_ATTRIBUTE_NAME = "initialVideoBitrateKbps";
-    static const char *CURRENT_VIDEO_BITRATE_ATTRIBUTE_NAME = "currentVideoBitrateKbps";
-    static const char *INITIAL_TOTAL_BITRATE_ATTRIBUTE_NAME = "initialTotalBitrateKbps";
-    static const char *CURRENT_TOTAL_BITRATE_ATTRIBUTE_NAME = "currentTotalBitrateKbps";
+    FlushCommandBatch(CommandBatchFlushReason::Barrier);
 
-    if (!eventValue.IsObject())
-    {
-        YI_LOGE(LOG_TAG, "OnBitrateChanged encountered an invalid event value, expected object, received %s. JSON string for event: %s", CYIRapidJSONUtility::TypeToString(eventValue.GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(eventValue).GetData());
-        return;
-    }
+    yi::rapidjson::Value instanceAccessorArgumentsValue(yi::rapidjson::kArrayType);
+    instanceAccessorArgumentsValue.PushBack(yi::rapidjson::Value(m_instanceId), message.GetAllocator());
 
-    if (!eventValue.HasMember(CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME))
+    if (s_pBridgeRecorder)
     {
-        YI_LOGE(LOG_TAG, "OnBitrateChanged event value is missing '%s' attribute!", CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME);
-        return;
+        s_pBridgeRecorder->RecordCall(m_instanceId, functionName, playerFunctionArgumentsValue);
     }
 
-    const yi::rapidjson::Value &eventDataValue = eventValue[CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME];
+    return CYIVideojsBridgeTransport::GetTransport()->CallInstanceFunction(std::move(message), VIDEO_PLAYER_CLASS_NAME, VIDEO_PLAYER_INSTANCE_ACCESSOR_NAME, functionName, std::move(playerFunctionArgumentsValue), std::move(instanceAccessorArgumentsValue), pMessageSent);
+}
 
-    if (!eventDataValue.IsObject())
+void CYIVideojsVideoPlayerPriv::DispatchCommand(const char *functionName, yi::rapidjson::Document &&command, yi::rapidjson::Value &&arguments, CommandCompletionCallback &&completionCallback) const
+{
+    if (!m_asynchronousCommandsEnabled || !m_commandBatchingEnabled)
     {
-        YI_LOGE(LOG_TAG, "OnBitrateChanged expected an object type for event '%s', received %s. JSON string for event '%s': %s", CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME, CYIRapidJSONUtility::TypeToString(eventDataValue.GetType()).GetData(), CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME, CYIRapidJSONUtility::CreateStringFromValue(eventDataValue).GetData());
-        return;
+        bool messageSent = false;
+        CYIVideojsBridgeTransport::FutureResponse futureResponse = CallPlayerInstanceFunction(std::move(command), functionName, std::move(arguments), &messageSent);
+
+        if (!messageSent)
+        {
+            YI_LOGE(LOG_TAG, "Failed to invoke %s function.", functionName);
+        }
+        else
+        {
+            ProcessCommandResponse(functionName, std::move(futureResponse), std::move(completionCallback));
+        }
+
+        return;
     }
 
-    if (eventDataValue.HasMember(INITIAL_AUDIO_BITRATE_ATTRIBUTE_NAME) || eventDataValue.HasMember(CURRENT_AUDIO_BITRATE_ATTRIBUTE_NAME))
+    // batched commands are streamed into a buffer that keeps its capacity across batches rather than copied into a
+    // document, the arguments are serialized before the pooled command document they were built in is released
+    if (m_queuedCommands.empty())
     {
-        CYIParsingError initialAudioBitrateParsingError;
-        float initialAudioBitrateKbps = -1;
+        m_commandBatchBuffer.Clear();
+        m_commandBatchWriter.Reset(m_commandBatchBuffer);
+        m_commandBatchWriter.StartArray();
+    }
 
-        CYIRapidJSONUtility::GetFloatField(&eventDataValue, INITIAL_AUDIO_BITRATE_ATTRIBUTE_NAME, &initialAudioBitrateKbps, initialAudioBitrateParsingError);
+    m_commandBatchWriter.StartObject();
+    m_commandBatchWriter.Key(BATCH_COMMAND_NAME_ATTRIBUTE_NAME);
+    m_commandBatchWriter.String(functionName);
+    m_commandBatchWriter.Key(BATCH_COMMAND_ARGUMENTS_ATTRIBUTE_NAME);
+    arguments.Accept(m_commandBatchWriter);
+    m_commandBatchWriter.EndObject();
 
-        if (initialAudioBitrateParsingError.HasError())
-        {
-            YI_LOGE(LOG_TAG, "OnBitrateChanged encountered an invalid float value for event data '%s'. JSON string for event data: %s", INITIAL_AUDIO_BITRATE_ATTRIBUTE_NAME, CYIRapidJSONUtility::CreateStringFromValue(eventDataValue).GetData());
-            return;
-        }
+    QueuedCommand queuedCommand;
+    queuedCommand.functionName = functionName;
+    queuedCommand.completionCallback = std::move(completionCallback);
+    queuedCommand.queuedTime = std::chrono::steady_clock::now();
+    m_queuedCommands.push_back(std::move(queuedCommand));
 
-        CYIParsingError currentAudioBitrateParsingError;
-        float currentAudioBitrateKbps = -1;
+    if (m_queuedCommands.size() == 1)
+    {
+        // a zero length timer fires on the next pass through the main loop, after the current update tick has completed
+        m_commandBatchTimer.Start(0);
+    }
+}
 
-        CYIRapidJSONUtility::GetFloatField(&eventDataValue, CURRENT_AUDIO_BITRATE_ATTRIBUTE_NAME, &m_currentAudioBitrateKbps, currentAudioBitrateParsingError);
+void CYIVideojsVideoPlayerPriv::FlushCommandBatch(CommandBatchFlushReason reason) const
+{
+    if (m_queuedCommands.empty())
+    {
+        return;
+    }
 
-        if (currentAudioBitrateParsingError.HasError())
-        {
-            YI_LOGE(LOG_TAG, "OnBitrateChanged encountered an invalid float value for event data '%s'. JSON string for event data: %s", CURRENT_AUDIO_BITRATE_ATTRIBUTE_NAME, CYIRapidJSONUtility::CreateStringFromValue(eventDataValue).GetData());
-            return;
-        }
+    m_commandBatchTimer.Stop();
 
-        float previousAudioBitrateKbps = m_currentAudioBitrateKbps;
+    m_commandBatchWriter.EndArray();
 
-        m_initialAudioBitrateKbps = initialAudioBitrateKbps;
-        m_currentAudioBitrateKbps = currentAudioBitrateKbps;
+    // swap the queue out first, the call below re-enters this function as an ordering barrier. The queue continues in the
+    // storage of a batch that has already completed, so the next frame does not regrow it while its commands are issued.
+    std::vector<QueuedCommand> batchedCommands;
+    batchedCommands.swap(m_queuedCommands);
+    m_queuedCommands.swap(m_spareCommandBatch);
 
-        if (!YI_FLOAT_EQUAL(previousAudioBitrateKbps, m_currentAudioBitrateKbps))
+    if (m_queuedCommands.capacity() < batchedCommands.size())
+    {
+        m_queuedCommands.reserve(batchedCommands.size());
+    }
+
+    // the batch is sent as a single JSON string argument that refers to the writer buffer, which is left untouched until
+    // the bridge has serialized the message since the queue is empty while the call is made
+    CYIVideojsDocumentPool::Lease commandLease = m_documentPool.Acquire();
+    yi::rapidjson::Document command(yi::rapidjson::kObjectType, commandLease.GetAllocator());
+
+    yi::rapidjson::Value arguments(yi::rapidjson::kArrayType);
+    arguments.PushBack(yi::rapidjson::Value(yi::rapidjson::StringRef(m_commandBatchBuffer.GetString(), static_cast<yi::rapidjson::SizeType>(m_commandBatchBuffer.GetSize()))), command.GetAllocator());
+
+    uint32_t batchSize = static_cast<uint32_t>(batchedCommands.size());
+
+    m_commandBatchStatistics.batchesSent++;
+    m_commandBatchStatistics.commandsBatched += batchSize;
+    m_commandBatchStatistics.largestBatchSize = std::max(m_commandBatchStatistics.largestBatchSize, batchSize);
+
+    if (reason == CommandBatchFlushReason::EndOfFrame)
+    {
+        m_commandBatchStatistics.endOfFrameFlushes++;
+    }
+    else
+    {
+        m_commandBatchStatistics.barrierFlushes++;
+    }
+
+    YI_LOGD(LOG_TAG, "Flushing batch of %u command(s) (%s).", batchSize, reason == CommandBatchFlushReason::EndOfFrame ? "end of frame" : "barrier");
+
+    bool messageSent = false;
+    CYIVideojsBridgeTransport::FutureResponse futureResponse = CallPlayerInstanceFunction(std::move(command), EXECUTE_BATCH_FUNCTION_NAME, std::move(arguments), &messageSent);
+
+    if (!messageSent)
+    {
+        YI_LOGE(LOG_TAG, "Failed to invoke %s function, %u command(s) were dropped.", EXECUTE_BATCH_FUNCTION_NAME, batchSize);
+        return;
+    }
+
+    // once the batch has completed, its storage is handed back to be reused by a later batch
+    ProcessCommandResponse(EXECUTE_BATCH_FUNCTION_NAME, std::move(futureResponse), [this, batchedCommands = std::move(batchedCommands)](const yi::rapidjson::Value &result) mutable {
+        OnCommandBatchResponse(batchedCommands, result);
+
+        batchedCommands.clear();
+
+        if (batchedCommands.capacity() > m_spareCommandBatch.capacity())
         {
-            m_pPub->AudioBitrateChanged(m_currentAudioBitrateKbps);
+            m_spareCommandBatch.swap(batchedCommands);
         }
+    });
+}
+
+void CYIVideojsVideoPlayerPriv::OnCommandBatchResponse(const std::vector<QueuedCommand> &batchedCommands, const yi::rapidjson::Value &result) const
+{
+    static const yi::rapidjson::Value EMPTY_RESULT;
+
+    if (!result.IsArray() || result.Size() != batchedCommands.size())
+    {
+        YI_LOGE(LOG_TAG, "%s expected an array of %zu results, received %s. JSON string for result: %s", EXECUTE_BATCH_FUNCTION_NAME, batchedCommands.size(), CYIRapidJSONUtility::TypeToString(result.GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(result).GetData());
+        return;
     }
 
-    if (eventDataValue.HasMember(INITIAL_VIDEO_BITRATE_ATTRIBUTE_NAME) || eventDataValue.HasMember(CURRENT_VIDEO_BITRATE_ATTRIBUTE_NAME))
+    for (yi::rapidjson::SizeType i = 0; i < result.Size(); ++i)
     {
-        CYIParsingError initialVideoBitrateParsingError;
-        float initialVideoBitrateKbps = -1;
+        const QueuedCommand &batchedCommand = batchedCommands[i];
+        const yi::rapidjson::Value &commandResult = result[i];
 
-        CYIRapidJSONUtility::GetFloatField(&eventDataValue, INITIAL_VIDEO_BITRATE_ATTRIBUTE_NAME, &initialVideoBitrateKbps, initialVideoBitrateParsingError);
+        CYIString errorMessage;
 
-        if (initialVideoBitrateParsingError.HasError())
+        if (commandResult.IsObject() && commandResult.HasMember(CYIWebMessagingBridge::ERROR_ATTRIBUTE_NAME))
         {
-            YI_LOGE(LOG_TAG, "OnBitrateChanged encountered an invalid float value for event data '%s'. JSON string for event data: %s", INITIAL_VIDEO_BITRATE_ATTRIBUTE_NAME, CYIRapidJSONUtility::CreateStringFromValue(eventDataValue).GetData());
-            return;
+            CYIParsingError parsingError;
+            CYIRapidJSONUtility::GetStringField(&commandResult[CYIWebMessagingBridge::ERROR_ATTRIBUTE_NAME], CYIWebMessagingBridge::ERROR_MESSAGE_ATTRIBUTE_NAME, errorMessage, parsingError);
+
+            if (parsingError.HasError() || errorMessage.IsEmpty())
+            {
+                errorMessage = "Unknown error.";
+            }
         }
 
-        CYIParsingError currentVideoBitrateParsingError;
-        float currentVideoBitrateKbps = -1;
+        const yi::rapidjson::Value &value = commandResult.IsObject() && commandResult.HasMember(BATCH_RESULT_ATTRIBUTE_NAME) ? commandResult[BATCH_RESULT_ATTRIBUTE_NAME] : EMPTY_RESULT;
+
+        CompleteCommandWithResult(CYIString(batchedCommand.functionName) + BATCHED_FUNCTION_NAME_SUFFIX, errorMessage, value, batchedCommand.completionCallback, batchedCommand.queuedTime, true);
+    }
+}
+
+void CYIVideojsVideoPlayerPriv::OnCommandBatchTimerTimedOut()
+{
+    FlushCommandBatch(CommandBatchFlushReason::EndOfFrame);
+}
+
+void CYIVideojsVideoPlayerPriv::ProcessCommandResponse(const char *functionName, CYIVideojsBridgeTransport::FutureResponse &&futureResponse, CommandCompletionCallback &&completionCallback, uint32_t timeoutMs) const
+{
+    std::chrono::steady_clock::time_point sentTime = std::chrono::steady_clock::now();
+
+    if (m_asynchronousCommandsEnabled)
+    {
+        PendingCommand pendingCommand;
+        pendingCommand.functionName = functionName;
+        pendingCommand.futureResponse = std::move(futureResponse);
+        pendingCommand.completionCallback = std::move(completionCallback);
+        pendingCommand.sentTime = sentTime;
+        pendingCommand.timeoutMs = timeoutMs;
+
+        EnqueuePendingCommand(std::move(pendingCommand));
 
-        CYIRapidJSONUtility::GetFloatField(&eventDataValue, CURRENT_VIDEO_BITRATE_ATTRIBUTE_NAME, &currentVideoBitrateKbps, currentVideoBitrateParsingError);
+        return;
+    }
+
+    bool valueAssigned = false;
+    CYIVideojsBridgeTransport::Response response = futureResponse.Take(timeoutMs, &valueAssigned);
+
+    CompleteCommand(functionName, valueAssigned ? &response : nullptr, completionCallback, sentTime, false);
+}
+
+void CYIVideojsVideoPlayerPriv::CompleteCommand(const CYIString &functionName, CYIVideojsBridgeTransport::Response *pResponse, const CommandCompletionCallback &completionCallback, std::chrono::steady_clock::time_point sentTime, bool asynchronous) const
+{
+    static const yi::rapidjson::Value EMPTY_RESULT;
+
+    CYIString errorMessage;
+    const yi::rapidjson::Value *pResult = nullptr;
+
+    if (!pResponse)
+    {
+        errorMessage = functionName + " did not receive a response from the web messaging bridge!";
+    }
+    else if (pResponse->HasError())
+    {
+        errorMessage = pResponse->GetErrorMessage();
+    }
+    else
+    {
+        pResult = pResponse->GetResult();
+    }
+
+    CompleteCommandWithResult(functionName, errorMessage, pResult ? *pResult : EMPTY_RESULT, completionCallback, sentTime, asynchronous, !pResponse);
+}
 
-        if (currentVideoBitrateParsingError.HasError())
+void CYIVideojsVideoPlayerPriv::CompleteCommandWithResult(const CYIString &functionName, const CYIString &errorMessage, const yi::rapidjson::Value &result, const CommandCompletionCallback &completionCallback, std::chrono::steady_clock::time_point sentTime, bool asynchronous, bool timedOut) const
+{
+    uint32_t latencyMs = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - sentTime).count());
+
+    RecordBridgeLatency(functionName, sentTime, timedOut ? BridgeCallOutcome::Timeout : (errorMessage.IsEmpty() ? BridgeCallOutcome::Response : BridgeCallOutcome::Error));
+
+    if (!errorMessage.IsEmpty())
+    {
+        // a failed command is not a playback error, so it is only logged rather than raised through ErrorOccurred, which
+        // applications treat as fatal to playback. The completion callback only ever receives successful results.
+        YI_LOGE(LOG_TAG, "%s failed after %u ms (%s): %s", functionName.GetData(), latencyMs, asynchronous ? "asynchronous" : "synchronous", errorMessage.GetData());
+
+        return;
+    }
+
+    YI_LOGD(LOG_TAG, "%s completed in %u ms (%s).", functionName.GetData(), latencyMs, asynchronous ? "asynchronous" : "synchronous");
+
+    if (completionCallback)
+    {
+        completionCallback(result);
+    }
+}
+
+void CYIVideojsVideoPlayerPriv::EnqueuePendingCommand(PendingCommand &&pendingCommand) const
+{
+    m_pendingCommands.push_back(std::move(pendingCommand));
+
+    if (m_pendingCommands.size() == 1)
+    {
+        m_pendingCommandTimer.Start(PENDING_COMMAND_POLL_INTERVAL_MS);
+    }
+}
+
+void CYIVideojsVideoPlayerPriv::OnPendingCommandTimerTimedOut()
+{
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+    // Every pending response is polled on its own, so a slow command does not hold back the commands sent after it.
+    // The ready ones are completed in the order they were sent. They are moved out of the pending list first, since
+    // their callbacks can send further commands.
+    std::list<PendingCommand> completedCommands;
+
+    for (std::list<PendingCommand>::iterator pendingCommandIterator = m_pendingCommands.begin(); pendingCommandIterator != m_pendingCommands.end();)
+    {
+        PendingCommand &pendingCommand = *pendingCommandIterator;
+        pendingCommand.response = pendingCommand.futureResponse.Take(0, &pendingCommand.responseReceived);
+
+        if (!pendingCommand.responseReceived && std::chrono::duration_cast<std::chrono::milliseconds>(now - pendingCommand.sentTime).count() < pendingCommand.timeoutMs)
         {
-            YI_LOGE(LOG_TAG, "OnBitrateChanged encountered an invalid float value for event data '%s'. JSON string for event data: %s", CURRENT_VIDEO_BITRATE_ATTRIBUTE_NAME, CYIRapidJSONUtility::CreateStringFromValue(eventDataValue).GetData());
-            return;
+            ++pendingCommandIterator;
+            continue;
         }
 
-        float previousVideoBitrateKbps = m_currentVideoBitrateKbps;
+        completedCommands.splice(completedCommands.end(), m_pendingCommands, pendingCommandIterator++);
+    }
 
-        m_initialVideoBitrateKbps = initialVideoBitrateKbps;
-        m_currentVideoBitrateKbps = currentVideoBitrateKbps;
+    for (PendingCommand &completedCommand : completedCommands)
+    {
+        if (completedCommand.cancelledCallback && completedCommand.cancelledCallback())
+        {
+            YI_LOGD(LOG_TAG, "%s was cancelled, ignoring its response.", completedCommand.functionName.GetData());
+        }
+        else
+        {
+            CompleteCommand(completedCommand.functionName, completedCommand.responseReceived ? &completedCommand.response : nullptr, completedCommand.completionCallback, completedCommand.sentTime, true);
+        }
 
-        if (!YI_FLOAT_EQUAL(previousVideoBitrateKbps, m_currentVideoBitrateKbps))
+        if (completedCommand.finishedCallback)
         {
-            m_pPub->VideoBitrateChanged(m_currentVideoBitrateKbps);
+            completedCommand.finishedCallback();
         }
     }
 
-    if (eventDataValue.HasMember(INITIAL_TOTAL_BITRATE_ATTRIBUTE_NAME) || eventDataValue.HasMember(CURRENT_TOTAL_BITRATE_ATTRIBUTE_NAME))
+    if (m_pendingCommands.empty())
+    {
+        m_pendingCommandTimer.Stop();
+    }
+    else
+    {
+        m_pendingCommandTimer.Start(PENDING_COMMAND_POLL_INTERVAL_MS);
+    }
+}
+
+void CYIVideojsVideoPlayerPriv::SetAsynchronousCommandsEnabled(bool enabled)
+{
+    if (!enabled)
     {
-        CYIParsingError initialTotalBitrateParsingError;
-        float initialTotalBitrateKbps = -1;
+        FlushCommandBatch(CommandBatchFlushReason::Barrier);
+    }
 
-        CYIRapidJSONUtility::GetFloatField(&eventDataValue, INITIAL_TOTAL_BITRATE_ATTRIBUTE_NAME, &initialTotalBitrateKbps, initialTotalBitrateParsingError);
+    m_asynchronousCommandsEnabled = enabled;
+}
+
+bool CYIVideojsVideoPlayerPriv::AreAsynchronousCommandsEnabled() const
+{
+    return m_asynchronousCommandsEnabled;
+}
+
+void CYIVideojsVideoPlayerPriv::SetCommandBatchingEnabled(bool enabled)
+{
+    if (!enabled)
+    {
+        FlushCommandBatch(CommandBatchFlushReason::Barrier);
+    }
+
+    m_commandBatchingEnabled = enabled;
+}
+
+bool CYIVideojsVideoPlayerPriv::IsCommandBatchingEnabled() const
+{
+    return m_commandBatchingEnabled;
+}
+
+CYIVideojsVideoPlayer::CommandBatchStatistics CYIVideojsVideoPlayerPriv::GetCommandBatchStatistics() const
+{
+    return m_commandBatchStatistics;
+}
 
-        if (initialTotalBitrateParsingError.HasError())
+void CYIVideojsVideoPlayerPriv::SetStateMirrorValidationEnabled(bool enabled)
+{
+    m_stateMirrorValidationEnabled = enabled;
+}
+
+bool CYIVideojsVideoPlayerPriv::IsStateMirrorValidationEnabled() const
+{
+    return m_stateMirrorValidationEnabled;
+}
+
+CYIVideojsVideoPlayer::PrepareStatistics CYIVideojsVideoPlayerPriv::GetPrepareStatistics() const
+{
+    return m_prepareStatistics;
+}
+
+CYIVideojsVideoPlayer::SeekStatistics CYIVideojsVideoPlayerPriv::GetSeekStatistics() const
+{
+    return m_seekStatistics;
+}
+
+std::map<CYIString, CYIVideojsVideoPlayer::BridgeLatencyHistogram> CYIVideojsVideoPlayerPriv::GetBridgeLatencyHistograms() const
+{
+    return m_bridgeLatencyHistograms;
+}
+
+void CYIVideojsVideoPlayerPriv::ResetBridgeLatencyHistograms()
+{
+    m_bridgeLatencyHistograms.clear();
+}
+
+CYIVideojsVideoPlayer::DocumentPoolStatistics CYIVideojsVideoPlayerPriv::GetDocumentPoolStatistics() const
+{
+    CYIVideojsDocumentPool::Statistics poolStatistics = m_documentPool.GetStatistics();
+
+    CYIVideojsVideoPlayer::DocumentPoolStatistics statistics;
+    statistics.slotCount = poolStatistics.slotCount;
+    statistics.slotsInUse = poolStatistics.slotsInUse;
+    statistics.highWaterSlotsInUse = poolStatistics.highWaterSlotsInUse;
+    statistics.slotSizeBytes = poolStatistics.chunkSize;
+    statistics.highWaterBytesUsed = poolStatistics.highWaterBytesUsed;
+    statistics.leases = poolStatistics.leases;
+    statistics.exhaustedLeases = poolStatistics.exhaustedLeases;
+    statistics.chunkOverflows = poolStatistics.chunkOverflows;
+
+    return statistics;
+}
+
+void CYIVideojsVideoPlayerPriv::ResetDocumentPoolStatistics()
+{
+    m_documentPool.ResetStatistics();
+}
+
+void CYIVideojsVideoPlayerPriv::SetBridgeLatencyLogIntervalMs(uint32_t intervalMs)
+{
+    m_bridgeLatencyLogIntervalMs = intervalMs;
+
+    m_bridgeLatencyLogTimer.Stop();
+
+    if (m_bridgeLatencyLogIntervalMs > 0)
+    {
+        m_bridgeLatencyLogTimer.Start(m_bridgeLatencyLogIntervalMs);
+    }
+}
+
+void CYIVideojsVideoPlayerPriv::LogBridgeLatencyHistograms() const
+{
+    // percentiles are bucket upper bounds, and asynchronous latencies include up to one pending command poll interval
+    YI_LOGI(LOG_TAG, "Bridge latency for player instance %d (asynchronous calls are polled every %u ms):", m_instanceId, PENDING_COMMAND_POLL_INTERVAL_MS);
+
+    for (const std::pair<const CYIString, CYIVideojsVideoPlayer::BridgeLatencyHistogram> &entry : m_bridgeLatencyHistograms)
+    {
+        const CYIVideojsVideoPlayer::BridgeLatencyHistogram &histogram = entry.second;
+
+        YI_LOGI(LOG_TAG, "    %s: %llu response(s), p50 <= %llu ms, p99 <= %llu ms, max %llu ms, %llu error(s), %llu timeout(s)", entry.first.GetData(), static_cast<unsigned long long>(histogram.responses), static_cast<unsigned long long>(histogram.GetPercentileMs(50.0f)), static_cast<unsigned long long>(histogram.GetPercentileMs(99.0f)), static_cast<unsigned long long>(histogram.maximumLatencyMs), static_cast<unsigned long long>(histogram.errors), static_cast<unsigned long long>(histogram.timeouts));
+    }
+}
+
+void CYIVideojsVideoPlayerPriv::OnBridgeLatencyLogTimerTimedOut()
+{
+    LogBridgeLatencyHistograms();
+
+    if (m_bridgeLatencyLogIntervalMs > 0)
+    {
+        m_bridgeLatencyLogTimer.Start(m_bridgeLatencyLogIntervalMs);
+    }
+}
+
+CYIVideojsBridgeTransport::Response CYIVideojsVideoPlayerPriv::TakeResponse(const CYIString &functionName, CYIVideojsBridgeTransport::FutureResponse &futureResponse, bool *pValueAssigned, uint32_t timeoutMs) const
+{
+    // blocking calls are taken immediately after they are sent, so the time spent waiting here is the round trip
+    std::chrono::steady_clock::time_point sentTime = std::chrono::steady_clock::now();
+
+    bool valueAssigned = false;
+    CYIVideojsBridgeTransport::Response response = futureResponse.Take(timeoutMs, &valueAssigned);
+
+    RecordBridgeLatency(functionName, sentTime, !valueAssigned ? BridgeCallOutcome::Timeout : (response.HasError() ? BridgeCallOutcome::Error : BridgeCallOutcome::Response));
+
+    if (pValueAssigned)
+    {
+        *pValueAssigned = valueAssigned;
+    }
+
+    return response;
+}
+
+void CYIVideojsVideoPlayerPriv::AppendArgument(yi::rapidjson::Value &arguments, yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator, bool value)
+{
+    arguments.PushBack(yi::rapidjson::Value().SetBool(value), allocator);
+}
+
+void CYIVideojsVideoPlayerPriv::AppendArgument(yi::rapidjson::Value &arguments, yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator, int32_t value)
+{
+    arguments.PushBack(yi::rapidjson::Value(value), allocator);
+}
+
+void CYIVideojsVideoPlayerPriv::AppendArgument(yi::rapidjson::Value &arguments, yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator, uint32_t value)
+{
+    arguments.PushBack(yi::rapidjson::Value(value), allocator);
+}
+
+void CYIVideojsVideoPlayerPriv::AppendArgument(yi::rapidjson::Value &arguments, yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator, int64_t value)
+{
+    arguments.PushBack(yi::rapidjson::Value(value), allocator);
+}
+
+void CYIVideojsVideoPlayerPriv::AppendArgument(yi::rapidjson::Value &arguments, yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator, uint64_t value)
+{
+    arguments.PushBack(yi::rapidjson::Value(value), allocator);
+}
+
+void CYIVideojsVideoPlayerPriv::AppendArgument(yi::rapidjson::Value &arguments, yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator, double value)
+{
+    arguments.PushBack(yi::rapidjson::Value(value), allocator);
+}
+
+void CYIVideojsVideoPlayerPriv::AppendArgument(yi::rapidjson::Value &arguments, yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator, const char *value)
+{
+    arguments.PushBack(yi::rapidjson::Value(value, allocator), allocator);
+}
+
+void CYIVideojsVideoPlayerPriv::AppendArgument(yi::rapidjson::Value &arguments, yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator, const CYIString &value)
+{
+    arguments.PushBack(yi::rapidjson::Value(value.GetData(), allocator), allocator);
+}
+
+void CYIVideojsVideoPlayerPriv::AppendArgument(yi::rapidjson::Value &arguments, yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator, const yi::rapidjson::Value &value)
+{
+    arguments.PushBack(yi::rapidjson::Value(value, allocator), allocator);
+}
+
+void CYIVideojsVideoPlayerPriv::AppendArgument(yi::rapidjson::Value &arguments, yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator, yi::rapidjson::Value &&value)
+{
+    arguments.PushBack(value, allocator);
+}
+
+bool CYIVideojsVideoPlayerPriv::TakeResult(const char *functionName, CYIVideojsBridgeTransport::FutureResponse &futureResponse, bool messageSent, CYIVideojsBridgeTransport::Response &response) const
+{
+    if (!messageSent)
+    {
+        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", functionName);
+        return false;
+    }
+
+    bool valueAssigned = false;
+    response = TakeResponse(functionName, futureResponse, &valueAssigned);
+
+    if (!valueAssigned)
+    {
+        YI_LOGE(LOG_TAG, "%s did not receive a response from the web messaging bridge!", functionName);
+        return false;
+    }
+
+    if (response.HasError())
+    {
+        YI_LOGE(LOG_TAG, "%s", response.GetErrorMessage().GetData());
+        return false;
+    }
+
+    return true;
+}
+
+bool CYIVideojsVideoPlayerPriv::DecodeResult(const char *functionName, const yi::rapidjson::Value &resultValue, bool &result)
+{
+    if (!resultValue.IsBool())
+    {
+        YI_LOGE(LOG_TAG, "%s expected a boolean type for result, received %s. JSON string for result: %s", functionName, CYIRapidJSONUtility::TypeToString(resultValue.GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(resultValue).GetData());
+        return false;
+    }
+
+    result = resultValue.GetBool();
+
+    return true;
+}
+
+bool CYIVideojsVideoPlayerPriv::DecodeResult(const char *functionName, const yi::rapidjson::Value &resultValue, int32_t &result)
+{
+    if (!resultValue.IsInt())
+    {
+        YI_LOGE(LOG_TAG, "%s expected an integer type for result, received %s. JSON string for result: %s", functionName, CYIRapidJSONUtility::TypeToString(resultValue.GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(resultValue).GetData());
+        return false;
+    }
+
+    result = resultValue.GetInt();
+
+    return true;
+}
+
+bool CYIVideojsVideoPlayerPriv::DecodeResult(const char *functionName, const yi::rapidjson::Value &resultValue, double &result)
+{
+    if (!resultValue.IsNumber())
+    {
+        YI_LOGE(LOG_TAG, "%s expected a number type for result, received %s. JSON string for result: %s", functionName, CYIRapidJSONUtility::TypeToString(resultValue.GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(resultValue).GetData());
+        return false;
+    }
+
+    result = resultValue.GetDouble();
+
+    return true;
+}
+
+bool CYIVideojsVideoPlayerPriv::DecodeResult(const char *functionName, const yi::rapidjson::Value &resultValue, CYIString &result)
+{
+    if (!resultValue.IsString())
+    {
+        YI_LOGE(LOG_TAG, "%s expected a string type for result, received %s. JSON string for result: %s", functionName, CYIRapidJSONUtility::TypeToString(resultValue.GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(resultValue).GetData());
+        return false;
+    }
+
+    result = resultValue.GetString();
+
+    return true;
+}
+
+bool CYIVideojsVideoPlayerPriv::DecodeResult(const char *, const yi::rapidjson::Value &resultValue, yi::rapidjson::Document &result)
+{
+    result.CopyFrom(resultValue, result.GetAllocator());
+
+    return true;
+}
+
+bool CYIVideojsVideoPlayerPriv::DecodeResult(const char *, const yi::rapidjson::Value &, IgnoredResult &)
+{
+    return true;
+}
+
+void CYIVideojsVideoPlayerPriv::RecordBridgeLatency(const CYIString &functionName, std::chrono::steady_clock::time_point sentTime, BridgeCallOutcome outcome) const
+{
+    if (s_pBridgeRecorder)
+    {
+        static const char *OUTCOME_NAMES[] = { "response", "error", "timeout" };
+
+        s_pBridgeRecorder->RecordResponse(functionName, static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - sentTime).count()), OUTCOME_NAMES[static_cast<int32_t>(outcome)]);
+    }
+
+    // an answered batch is recorded through each of the commands it carried, recording the executeBatch call too would count them twice
+    if (outcome == BridgeCallOutcome::Response && functionName == EXECUTE_BATCH_FUNCTION_NAME)
+    {
+        return;
+    }
+
+    CYIVideojsVideoPlayer::BridgeLatencyHistogram &histogram = m_bridgeLatencyHistograms[functionName];
+
+    if (outcome == BridgeCallOutcome::Timeout)
+    {
+        histogram.timeouts++;
+        return;
+    }
+
+    if (outcome == BridgeCallOutcome::Error)
+    {
+        histogram.errors++;
+    }
+
+    histogram.Record(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - sentTime).count()));
+}
+
+void CYIVideojsVideoPlayerPriv::SetCompactEventEncodingEnabled(bool enabled)
+{
+    if (m_initialized)
+    {
+        YI_LOGW(LOG_TAG, "SetCompactEventEncodingEnabled must be called before the player is initialized, ignoring request.");
+        return;
+    }
+
+    m_compactEventEncodingRequested = enabled;
+}
+
+bool CYIVideojsVideoPlayerPriv::IsCompactEventEncodingActive() const
+{
+    return m_compactEventEncodingActive;
+}
+
+CYIVideojsVideoPlayer::EventEncodingStatistics CYIVideojsVideoPlayerPriv::GetEventEncodingStatistics() const
+{
+    static const double NANOSECONDS_PER_MICROSECOND = 1000.0;
+
+    CYIVideojsVideoPlayer::EventEncodingStatistics statistics;
+
+    statistics.compactEventsDecoded = m_compactEventCounters.eventsDecoded;
+    statistics.verboseEventsDecoded = m_verboseEventCounters.eventsDecoded;
+
+    if (m_compactEventCounters.eventsSampled > 0)
+    {
+        statistics.averageCompactEventBytes = static_cast<double>(m_compactEventCounters.sampledBytes) / m_compactEventCounters.eventsSampled;
+    }
+
+    if (m_verboseEventCounters.eventsSampled > 0)
+    {
+        statistics.averageVerboseEventBytes = static_cast<double>(m_verboseEventCounters.sampledBytes) / m_verboseEventCounters.eventsSampled;
+    }
+
+    if (m_compactEventCounters.eventsDecoded > 0)
+    {
+        statistics.averageCompactDecodeTimeUs = m_compactEventCounters.decodeTimeNs / NANOSECONDS_PER_MICROSECOND / m_compactEventCounters.eventsDecoded;
+    }
+
+    if (m_verboseEventCounters.eventsDecoded > 0)
+    {
+        statistics.averageVerboseDecodeTimeUs = m_verboseEventCounters.decodeTimeNs / NANOSECONDS_PER_MICROSECOND / m_verboseEventCounters.eventsDecoded;
+    }
+
+    return statistics;
+}
+
+void CYIVideojsVideoPlayerPriv::RecordEventDecoded(const yi::rapidjson::Value &eventValue, bool compact, std::chrono::steady_clock::time_point decodeStartTime)
+{
+    EventEncodingCounters &counters = compact ? m_compactEventCounters : m_verboseEventCounters;
+
+    counters.decodeTimeNs += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - decodeStartTime).count());
+
+    // serializing the event is far more expensive than decoding it, so the payload size is only sampled periodically
+    if (counters.eventsDecoded % EVENT_SIZE_SAMPLE_INTERVAL == 0)
+    {
+        counters.sampledBytes += CYIRapidJSONUtility::CreateStringFromValue(eventValue).GetLength();
+        counters.eventsSampled++;
+    }
+
+    counters.eventsDecoded++;
+}
+
+void CYIVideojsVideoPlayerPriv::OnBitrateChanged(const yi::rapidjson::Value &eventValue)
+{
+    std::chrono::steady_clock::time_point decodeStartTime = std::chrono::steady_clock::now();
+    CYIVideojsEventDecoder::BitrateChangedEvent event;
+    CYIString errorMessage;
+
+    if (!CYIVideojsEventDecoder::DecodeBitrateChanged(eventValue, event, errorMessage))
+    {
+        YI_LOGE(LOG_TAG, "OnBitrateChanged failed to decode event: %s. JSON string for event: %s", errorMessage.GetData(), CYIRapidJSONUtility::CreateStringFromValue(eventValue).GetData());
+        return;
+    }
+
+    RecordEventDecoded(eventValue, event.compact, decodeStartTime);
+
+    if (event.hasAudioBitrate)
+    {
+        float previousAudioBitrateKbps = m_currentAudioBitrateKbps;
+
+        m_initialAudioBitrateKbps = static_cast<float>(event.initialAudioBitrateKbps);
+        m_currentAudioBitrateKbps = static_cast<float>(event.currentAudioBitrateKbps);
+
+        if (!YI_FLOAT_EQUAL(previousAudioBitrateKbps, m_currentAudioBitrateKbps))
         {
-            YI_LOGE(LOG_TAG, "OnBitrateChanged encountered an invalid float value for event data '%s'. JSON string for event data: %s", INITIAL_TOTAL_BITRATE_ATTRIBUTE_NAME, CYIRapidJSONUtility::CreateStringFromValue(eventDataValue).GetData());
-            return;
+            m_pPub->AudioBitrateChanged(m_currentAudioBitrateKbps);
         }
+    }
 
-        CYIParsingError currentTotalBitrateParsingError;
-        float currentTotalBitrateKbps = -1;
+    if (event.hasVideoBitrate)
+    {
+        float previousVideoBitrateKbps = m_currentVideoBitrateKbps;
 
-        CYIRapidJSONUtility::GetFloatField(&eventDataValue, CURRENT_TOTAL_BITRATE_ATTRIBUTE_NAME, &currentTotalBitrateKbps, currentTotalBitrateParsingError);
+        m_initialVideoBitrateKbps = static_cast<float>(event.initialVideoBitrateKbps);
+        m_currentVideoBitrateKbps = static_cast<float>(event.currentVideoBitrateKbps);
 
-        if (currentTotalBitrateParsingError.HasError())
+        if (!YI_FLOAT_EQUAL(previousVideoBitrateKbps, m_currentVideoBitrateKbps))
         {
-            YI_LOGE(LOG_TAG, "OnBitrateChanged encountered an invalid float value for event data '%s'. JSON string for event data: %s", CURRENT_TOTAL_BITRATE_ATTRIBUTE_NAME, CYIRapidJSONUtility::CreateStringFromValue(eventDataValue).GetData());
-            return;
+            m_pPub->VideoBitrateChanged(m_currentVideoBitrateKbps);
         }
+    }
 
+    if (event.hasTotalBitrate)
+    {
         float previousTotalBitrateKbps = m_currentTotalBitrateKbps;
 
-        m_initialTotalBitrateKbps = initialTotalBitrateKbps;
-        m_currentTotalBitrateKbps = currentTotalBitrateKbps;
+        m_initialTotalBitrateKbps = static_cast<float>(event.initialTotalBitrateKbps);
+        m_currentTotalBitrateKbps = static_cast<float>(event.currentTotalBitrateKbps);
 
         if (!YI_FLOAT_EQUAL(previousTotalBitrateKbps, m_currentTotalBitrateKbps))
         {
@@ -517,19 +1587,11 @@ void CYIVideojsVideoPlayerPriv::OnBitrateChanged(const yi::rapidjson::Value &eve
 
 void CYIVideojsVideoPlayerPriv::OnBufferingStateChanged(const yi::rapidjson::Value &eventValue)
 {
-    if (!eventValue.IsObject())
-    {
-        YI_LOGE(LOG_TAG, "OnBufferingStateChanged encountered an invalid event value, expected object, received %s. JSON string for event: %s", CYIRapidJSONUtility::TypeToString(eventValue.GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(eventValue).GetData());
-        return;
-    }
-
-    CYIParsingError parsingError;
-
-    CYIRapidJSONUtility::GetBooleanField(&eventValue, CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME, &m_buffering, parsingError);
+    CYIString errorMessage;
 
-    if (parsingError.HasError())
+    if (!CYIVideojsEventDecoder::DecodeBufferingStateChanged(eventValue, m_buffering, errorMessage))
     {
-        YI_LOGE(LOG_TAG, "OnBufferingStateChanged event value is does not contain a valid boolean value for '%s'. JSON string for event value: %s", CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME, CYIRapidJSONUtility::CreateStringFromValue(eventValue).GetData());
+        YI_LOGE(LOG_TAG, "OnBufferingStateChanged failed to decode event: %s. JSON string for event: %s", errorMessage.GetData(), CYIRapidJSONUtility::CreateStringFromValue(eventValue).GetData());
         return;
     }
 
@@ -544,10 +1606,16 @@ void CYIVideojsVideoPlayerPriv::OnBufferingStateChanged(const yi::rapidjson::Val
     }
     else
     {
+        if (m_awaitingSeekPlayback)
+        {
+            CompleteSeek();
+        }
+
         if (m_pPub->GetPlayerState() == CYIAbstractVideoPlayer::PlaybackState::Buffering)
         {
             if (m_stateBeforeBuffering == CYIAbstractVideoPlayer::PlaybackState::Playing)
             {
+                AnchorPlaybackClock(m_currentTimeMs);
                 m_pPub->m_pStateManager->TransitionToPlaybackPlaying();
             }
             else if (m_stateBeforeBuffering == CYIAbstractVideoPlayer::PlaybackState::Paused)
@@ -577,6 +1645,129 @@ void CYIVideojsVideoPlayerPriv::OnLiveStatusUpdated(const yi::rapidjson::Value &
     }
 }
 
+void CYIVideojsVideoPlayerPriv::OnSeekableRangesChanged(const yi::rapidjson::Value &eventValue)
+{
+    std::vector<CYIVideojsEventDecoder::TimeRange> ranges;
+    CYIString errorMessage;
+
+    if (!CYIVideojsEventDecoder::DecodeSeekableRangesChanged(eventValue, ranges, errorMessage))
+    {
+        YI_LOGE(LOG_TAG, "OnSeekableRangesChanged failed to decode event: %s. JSON string for event: %s", errorMessage.GetData(), CYIRapidJSONUtility::CreateStringFromValue(eventValue).GetData());
+        return;
+    }
+
+    // the web view always sends the complete window, so the index is rebuilt rather than patched
+    m_seekableRanges.Clear();
+
+    for (const CYIVideojsEventDecoder::TimeRange &range : ranges)
+    {
+        m_seekableRanges.Add(range.startTimeMs, range.endTimeMs);
+    }
+}
+
+void CYIVideojsVideoPlayerPriv::OnBufferLengthChanged(const yi::rapidjson::Value &eventValue)
+{
+    CYIVideojsEventDecoder::BufferLengthChangedEvent event;
+    CYIString errorMessage;
+
+    if (!CYIVideojsEventDecoder::DecodeBufferLengthChanged(eventValue, event, errorMessage))
+    {
+        YI_LOGE(LOG_TAG, "OnBufferLengthChanged failed to decode event: %s. JSON string for event: %s", errorMessage.GetData(), CYIRapidJSONUtility::CreateStringFromValue(eventValue).GetData());
+        return;
+    }
+
+    m_bufferLength = CYIAbstractVideoPlayer::BufferLength(std::chrono::milliseconds(event.minimumBufferLengthMs), std::chrono::milliseconds(event.maximumBufferLengthMs));
+
+    YI_LOGD(LOG_TAG, "Buffer goals changed to %lld ms minimum and %lld ms maximum.", static_cast<long long>(event.minimumBufferLengthMs), static_cast<long long>(event.maximumBufferLengthMs));
+}
+
+void CYIVideojsVideoPlayerPriv::OnRenditionsChanged(const yi::rapidjson::Value &eventValue)
+{
+    std::vector<CYIVideojsEventDecoder::Rendition> renditions;
+    CYIString errorMessage;
+
+    if (!CYIVideojsEventDecoder::DecodeRenditionsChanged(eventValue, renditions, errorMessage))
+    {
+        YI_LOGE(LOG_TAG, "OnRenditionsChanged failed to decode event: %s. JSON string for event: %s", errorMessage.GetData(), CYIRapidJSONUtility::CreateStringFromValue(eventValue).GetData());
+        return;
+    }
+
+    m_videoRenditions.clear();
+    m_videoRenditions.reserve(renditions.size());
+
+    for (const CYIVideojsEventDecoder::Rendition &rendition : renditions)
+    {
+        CYIVideojsVideoPlayer::VideoRendition videoRendition;
+        videoRendition.id = static_cast<uint32_t>(rendition.id);
+        videoRendition.bitrateKbps = static_cast<uint64_t>(rendition.bitrateKbps);
+        videoRendition.width = static_cast<int32_t>(rendition.width);
+        videoRendition.height = static_cast<int32_t>(rendition.height);
+        videoRendition.frameRate = static_cast<float>(rendition.frameRate);
+        videoRendition.codecs = rendition.codecs;
+        m_videoRenditions.push_back(std::move(videoRendition));
+    }
+
+    YI_LOGD(LOG_TAG, "Received a ladder of %u video rendition(s).", static_cast<uint32_t>(m_videoRenditions.size()));
+
+    m_hasSentABRRendition = false;
+    NotifyABRControllerRenditions();
+
+    if (m_automaticResolutionCapEnabled)
+    {
+        UpdateResolutionCap();
+    }
+}
+
+void CYIVideojsVideoPlayerPriv::OnSegmentDownloaded(const yi::rapidjson::Value &eventValue)
+{
+    static const char *FUNCTION_NAME = "setABRRendition";
+
+    CYIVideojsEventDecoder::SegmentDownloadedEvent event;
+    CYIString errorMessage;
+
+    if (!CYIVideojsEventDecoder::DecodeSegmentDownloaded(eventValue, event, errorMessage))
+    {
+        YI_LOGE(LOG_TAG, "OnSegmentDownloaded failed to decode event: %s. JSON string for event: %s", errorMessage.GetData(), CYIRapidJSONUtility::CreateStringFromValue(eventValue).GetData());
+        return;
+    }
+
+    // samples that were already in flight when the controller was removed are dropped
+    if (!m_pABRController)
+    {
+        return;
+    }
+
+    CYIVideojsABRController::SegmentSample sample;
+    sample.renditionId = static_cast<uint32_t>(event.renditionId);
+    sample.bytes = static_cast<uint64_t>(event.bytes);
+    sample.downloadTimeMs = static_cast<uint64_t>(event.downloadTimeMs);
+    sample.mediaDurationMs = static_cast<uint64_t>(event.mediaDurationMs);
+    sample.bufferLengthMs = static_cast<uint64_t>(event.bufferLengthMs);
+
+    uint32_t renditionId = m_pABRController->OnSegmentDownloaded(sample);
+
+    std::vector<CYIVideojsVideoPlayer::VideoRendition>::const_iterator renditionIterator = std::find_if(m_videoRenditions.begin(), m_videoRenditions.end(), [renditionId](const CYIVideojsVideoPlayer::VideoRendition &rendition) {
+        return rendition.id == renditionId;
+    });
+
+    if (renditionIterator == m_videoRenditions.end())
+    {
+        YI_LOGE(LOG_TAG, "OnSegmentDownloaded ignored the ABR controller decision, rendition %u is not part of the current ladder of %u video rendition(s).", renditionId, static_cast<uint32_t>(m_videoRenditions.size()));
+        return;
+    }
+
+    // the web view keeps fetching from the last decision, so only changes cross the bridge
+    if (m_hasSentABRRendition && renditionId == m_sentABRRenditionId)
+    {
+        return;
+    }
+
+    m_hasSentABRRendition = true;
+    m_sentABRRenditionId = renditionId;
+
+    DispatchPlayerCommand(FUNCTION_NAME, renditionId);
+}
+
 void CYIVideojsVideoPlayerPriv::OnPlayerErrorThrown(const yi::rapidjson::Value &eventValue)
 {
     static const char *ERROR_CODE_ATTRIBUTE_NAME = "code";
@@ -710,91 +1901,96 @@ void CYIVideojsVideoPlayerPriv::OnVideoDurationChanged(const yi::rapidjson::Valu
 
 void CYIVideojsVideoPlayerPriv::OnVideoTimeChanged(const yi::rapidjson::Value &eventValue)
 {
-    static const char *CURRENT_TIME_ATTRIBUTE_NAME = "currentTimeSeconds";
-    static const char *BUFFER_LENGTH_ATTRIBUTE_NAME = "bufferLengthMs";
+    std::chrono::steady_clock::time_point decodeStartTime = std::chrono::steady_clock::now();
+    CYIVideojsEventDecoder::VideoTimeChangedEvent event;
+    CYIString errorMessage;
 
-    if (!eventValue.IsObject())
+    if (!CYIVideojsEventDecoder::DecodeVideoTimeChanged(eventValue, event, errorMessage))
     {
-        YI_LOGE(LOG_TAG, "OnVideoTimeChanged encountered an invalid event value, expected object, received %s. JSON string for event: %s", CYIRapidJSONUtility::TypeToString(eventValue.GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(eventValue).GetData());
+        YI_LOGE(LOG_TAG, "OnVideoTimeChanged failed to decode event: %s. JSON string for event: %s", errorMessage.GetData(), CYIRapidJSONUtility::CreateStringFromValue(eventValue).GetData());
         return;
     }
 
-    if (!eventValue.HasMember(CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME))
+    RecordEventDecoded(eventValue, event.compact, decodeStartTime);
+
+    if (event.currentTimeSeconds < 0)
     {
-        YI_LOGE(LOG_TAG, "OnVideoTimeChanged event value is missing '%s' attribute!", CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME);
+        YI_LOGE(LOG_TAG, "OnVideoTimeChanged encountered a negative current time value: %f. JSON string for event: %s", event.currentTimeSeconds, CYIRapidJSONUtility::CreateStringFromValue(eventValue).GetData());
         return;
     }
 
-    const yi::rapidjson::Value &eventDataValue = eventValue[CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME];
+    AnchorPlaybackClock(static_cast<uint64_t>(event.currentTimeSeconds * 1000.0));
 
-    if (!eventDataValue.IsObject())
+    if (m_pPub->GetPlayerState() == CYIAbstractVideoPlayer::PlaybackState::Paused || m_pPub->GetPlayerState() == CYIAbstractVideoPlayer::PlaybackState::Buffering)
     {
-        YI_LOGE(LOG_TAG, "OnVideoTimeChanged expected an object type for event '%s', received %s. JSON string for event '%s': %s", CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME, CYIRapidJSONUtility::TypeToString(eventDataValue.GetType()).GetData(), CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME, CYIRapidJSONUtility::CreateStringFromValue(eventDataValue).GetData());
-        return;
+        m_pPub->UpdateCurrentTime();
     }
 
-    if (!eventDataValue.HasMember(CURRENT_TIME_ATTRIBUTE_NAME))
+    if (event.hasBufferLength)
     {
-        YI_LOGE(LOG_TAG, "OnVideoTimeChanged event data is missing '%s' attribute! JSON string for event data: %s", CURRENT_TIME_ATTRIBUTE_NAME, CYIRapidJSONUtility::CreateStringFromValue(eventDataValue).GetData());
-        return;
+        m_bufferLengthMs = static_cast<float>(event.bufferLengthMs);
     }
+}
 
-    const yi::rapidjson::Value &currentTimeValue = eventDataValue[CURRENT_TIME_ATTRIBUTE_NAME];
-
-    double currentTimeSeconds;
-
-    if (!currentTimeValue.IsNumber())
+void CYIVideojsVideoPlayerPriv::OnStateChanged(const yi::rapidjson::Value &eventValue)
+{
+    if (!eventValue.IsObject())
     {
-        YI_LOGE(LOG_TAG, "OnVideoTimeChanged encountered an invalid number value for event data '%s'. JSON string for event data: %s", CURRENT_TIME_ATTRIBUTE_NAME, CYIRapidJSONUtility::CreateStringFromValue(eventDataValue).GetData());
+        YI_LOGE(LOG_TAG, "OnStateChanged encountered an invalid event value, expected object, received %s. JSON string for event: %s", CYIRapidJSONUtility::TypeToString(eventValue.GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(eventValue).GetData());
         return;
     }
 
-    currentTimeSeconds = currentTimeValue.GetDouble();
+    static const char *STATE_ID_ATTRIBUTE_NAME = "id";
+    static const char *PREPARE_ID_ATTRIBUTE_NAME = "prepareId";
 
-    if(currentTimeSeconds < 0) {
-        YI_LOGE(LOG_TAG, "OnVideoTimeChanged encountered a negative number value for event data '%s'. JSON string for event data: %s", CURRENT_TIME_ATTRIBUTE_NAME, CYIRapidJSONUtility::CreateStringFromValue(eventDataValue).GetData());
+    if (!eventValue.HasMember(CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME) || !eventValue[CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME].IsObject())
+    {
+        YI_LOGE(LOG_TAG, "OnStateChanged event value is does not contain a valid object value for '%s'. JSON string for event value: %s", CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME, CYIRapidJSONUtility::CreateStringFromValue(eventValue).GetData());
         return;
     }
 
-    m_currentTimeMs = static_cast<uint64_t>(currentTimeSeconds * 1000.0f);
-
-    if (m_pPub->GetPlayerState() == CYIAbstractVideoPlayer::PlaybackState::Paused || m_pPub->GetPlayerState() == CYIAbstractVideoPlayer::PlaybackState::Buffering)
-    {
-        m_pPub->UpdateCurrentTime();
-    }
+    const yi::rapidjson::Value &stateDataValue = eventValue[CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME];
 
     CYIParsingError parsingError;
 
-    CYIRapidJSONUtility::GetFloatField(&eventDataValue, BUFFER_LENGTH_ATTRIBUTE_NAME, &m_bufferLengthMs, parsingError);
+    int32_t stateValue = -1;
 
-    if (parsingError.HasError() && parsingError.GetParsingErrorCode() != CYIParsingError::ErrorType::DataFieldMissing)
-    {
-        YI_LOGE(LOG_TAG, "OnVideoTimeChanged encountered an invalid float value for event data '%s'. JSON string for event data: %s", BUFFER_LENGTH_ATTRIBUTE_NAME, CYIRapidJSONUtility::CreateStringFromValue(eventDataValue).GetData());
-        return;
-    }
-}
+    CYIRapidJSONUtility::GetIntegerField(&stateDataValue, STATE_ID_ATTRIBUTE_NAME, &stateValue, parsingError);
 
-void CYIVideojsVideoPlayerPriv::OnStateChanged(const yi::rapidjson::Value &eventValue)
-{
-    if (!eventValue.IsObject())
+    if (parsingError.HasError())
     {
-        YI_LOGE(LOG_TAG, "OnStateChanged encountered an invalid event value, expected object, received %s. JSON string for event: %s", CYIRapidJSONUtility::TypeToString(eventValue.GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(eventValue).GetData());
+        YI_LOGE(LOG_TAG, "OnStateChanged event data does not contain a valid integer value for '%s'. JSON string for event data: %s", STATE_ID_ATTRIBUTE_NAME, CYIRapidJSONUtility::CreateStringFromValue(stateDataValue).GetData());
         return;
     }
 
-    CYIParsingError parsingError;
+    PlayerState state = static_cast<PlayerState>(stateValue);
 
-    int32_t stateValue = -1;
+    // every state raised while a source is loaded carries the id of the prepare that loaded it, so any state from a
+    // replaced or stopped source is stale. States raised without a source, such as after a stop, carry no id.
+    CYIParsingError prepareIdParsingError;
 
-    CYIRapidJSONUtility::GetIntegerField(&eventValue, CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME, &stateValue, parsingError);
+    int32_t prepareId = 0;
 
-    if (parsingError.HasError())
+    CYIRapidJSONUtility::GetIntegerField(&stateDataValue, PREPARE_ID_ATTRIBUTE_NAME, &prepareId, prepareIdParsingError);
+
+    if (!prepareIdParsingError.HasError() && prepareId != m_prepareId)
     {
-        YI_LOGE(LOG_TAG, "OnStateChanged event value is does not contain a valid integer value for '%s'. JSON string for event value: %s", CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME, CYIRapidJSONUtility::CreateStringFromValue(eventValue).GetData());
+        YI_LOGD(LOG_TAG, "OnStateChanged ignoring %s state from stale prepare #%d, current prepare is #%d.", PlayerStateToString(state).GetData(), prepareId, m_prepareId);
         return;
     }
 
-    PlayerState state = static_cast<PlayerState>(stateValue);
+    if (state == PlayerState::Loaded && m_preparing)
+    {
+        m_preparing = false;
+
+        uint64_t latencyMs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_prepareStartTime).count());
+
+        m_prepareStatistics.preparesCompleted++;
+        m_prepareStatistics.lastPrepareLatencyMs = latencyMs;
+        m_prepareStatistics.maximumPrepareLatencyMs = std::max(m_prepareStatistics.maximumPrepareLatencyMs, latencyMs);
+
+        YI_LOGD(LOG_TAG, "Prepare #%d became ready in %llu ms.", m_prepareId, static_cast<unsigned long long>(latencyMs));
+    }
 
     switch (state)
     {
@@ -819,6 +2015,7 @@ void CYIVideojsVideoPlayerPriv::OnStateChanged(const yi::rapidjson::Value &event
         }
         case PlayerState::Playing:
         {
+            AnchorPlaybackClock(m_currentTimeMs);
             m_pPub->m_pStateManager->TransitionToPlaybackPlaying();
             break;
         }
@@ -987,6 +2184,128 @@ void CYIVideojsVideoPlayerPriv::OnMetadataAvailable(const yi::rapidjson::Value &
     MetadataAvailable.Emit(timedMetadata);
 }
 
+void CYIVideojsVideoPlayerPriv::OnMuteStatusChanged(const yi::rapidjson::Value &eventValue)
+{
+    if (!eventValue.IsObject())
+    {
+        YI_LOGE(LOG_TAG, "OnMuteStatusChanged encountered an invalid event value, expected object, received %s. JSON string for event: %s", CYIRapidJSONUtility::TypeToString(eventValue.GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(eventValue).GetData());
+        return;
+    }
+
+    CYIParsingError parsingError;
+
+    CYIRapidJSONUtility::GetBooleanField(&eventValue, CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME, &m_muted, parsingError);
+
+    if (parsingError.HasError())
+    {
+        YI_LOGE(LOG_TAG, "OnMuteStatusChanged event value is does not contain a valid boolean value for '%s'. JSON string for event value: %s", CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME, CYIRapidJSONUtility::CreateStringFromValue(eventValue).GetData());
+        return;
+    }
+}
+
+void CYIVideojsVideoPlayerPriv::OnTextTrackStatusChanged(const yi::rapidjson::Value &eventValue)
+{
+    if (!eventValue.IsObject())
+    {
+        YI_LOGE(LOG_TAG, "OnTextTrackStatusChanged encountered an invalid event value, expected object, received %s. JSON string for event: %s", CYIRapidJSONUtility::TypeToString(eventValue.GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(eventValue).GetData());
+        return;
+    }
+
+    CYIParsingError parsingError;
+
+    CYIRapidJSONUtility::GetBooleanField(&eventValue, CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME, &m_textTrackEnabled, parsingError);
+
+    if (parsingError.HasError())
+    {
+        YI_LOGE(LOG_TAG, "OnTextTrackStatusChanged event value is does not contain a valid boolean value for '%s'. JSON string for event value: %s", CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME, CYIRapidJSONUtility::CreateStringFromValue(eventValue).GetData());
+        return;
+    }
+}
+
+void CYIVideojsVideoPlayerPriv::OnActiveAudioTrackChanged(const yi::rapidjson::Value &eventValue)
+{
+    if (!eventValue.IsObject())
+    {
+        YI_LOGE(LOG_TAG, "OnActiveAudioTrackChanged encountered an invalid event value, expected object, received %s. JSON string for event: %s", CYIRapidJSONUtility::TypeToString(eventValue.GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(eventValue).GetData());
+        return;
+    }
+
+    CYIAbstractVideoPlayer::AudioTrackInfo audioTrackInfo(0);
+
+    // a missing or null track means that no audio track is currently active
+    if (eventValue.HasMember(CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME) && !eventValue[CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME].IsNull())
+    {
+        if (!ConvertValueToTrackInfo(eventValue[CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME], audioTrackInfo))
+        {
+            YI_LOGE(LOG_TAG, "OnActiveAudioTrackChanged encountered an invalid audio track. JSON string for event value: %s", CYIRapidJSONUtility::CreateStringFromValue(eventValue).GetData());
+            return;
+        }
+    }
+
+    m_activeAudioTrack = audioTrackInfo;
+}
+
+void CYIVideojsVideoPlayerPriv::OnActiveTextTrackChanged(const yi::rapidjson::Value &eventValue)
+{
+    if (!eventValue.IsObject())
+    {
+        YI_LOGE(LOG_TAG, "OnActiveTextTrackChanged encountered an invalid event value, expected object, received %s. JSON string for event: %s", CYIRapidJSONUtility::TypeToString(eventValue.GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(eventValue).GetData());
+        return;
+    }
+
+    // a missing track means that no text track is currently active
+    if (!eventValue.HasMember(CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME))
+    {
+        UpdateActiveTextTrack("OnActiveTextTrackChanged", yi::rapidjson::Value());
+        return;
+    }
+
+    UpdateActiveTextTrack("OnActiveTextTrackChanged", eventValue[CYIWebMessagingBridge::EVENT_DATA_ATTRIBUTE_NAME]);
+}
+
+void CYIVideojsVideoPlayerPriv::UpdateActiveTextTrack(const char *functionName, const yi::rapidjson::Value &textTrackValue)
+{
+    CYIAbstractVideoPlayer::ClosedCaptionsTrackInfo textTrackInfo(0);
+
+    // only a track that is showing is reported as active, so a null track also means that text tracks are disabled
+    if (!textTrackValue.IsNull() && !ConvertValueToTrackInfo(textTrackValue, textTrackInfo))
+    {
+        YI_LOGE(LOG_TAG, "%s encountered an invalid text track. JSON string for text track: %s", functionName, CYIRapidJSONUtility::CreateStringFromValue(textTrackValue).GetData());
+        return;
+    }
+
+    m_activeTextTrack = textTrackInfo;
+    m_textTrackEnabled = !textTrackValue.IsNull();
+}
+
+void CYIVideojsVideoPlayerPriv::OnSeekCompleted(const yi::rapidjson::Value &)
+{
+    // completions of seeks that were cancelled by Stop or Prepare, or that already timed out, are ignored
+    if (!m_seekInFlight)
+    {
+        return;
+    }
+
+    m_seekTimeoutTimer.Stop();
+    m_seekInFlight = false;
+
+    if (m_seekPending)
+    {
+        m_seekPending = false;
+        SendSeek(m_pendingSeekPositionMs);
+        return;
+    }
+
+    // the web view may still be refilling its buffer at the new position, in which case playback resumes once buffering ends
+    if (m_buffering)
+    {
+        m_awaitingSeekPlayback = true;
+        return;
+    }
+
+    CompleteSeek();
+}
+
 void CYIVideojsVideoPlayerPriv::AddDRMConfigurationToValue(CYIAbstractVideoPlayer::DRMConfiguration *pDRMConfiguration, yi::rapidjson::Value &value, yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator)
 {
     if (!pDRMConfiguration)
@@ -1053,85 +2372,52 @@ CYIString CYIVideojsVideoPlayerPriv::GetName() const
 
     if (type.IsEmpty())
     {
-        bool messageSent = false;
-        CYIWebMessagingBridge::FutureResponse futureResponse = CallStaticPlayerFunction(yi::rapidjson::Document(), FUNCTION_NAME, yi::rapidjson::Value(yi::rapidjson::kArrayType), &messageSent);
+        InvokeStaticPlayerFunction(FUNCTION_NAME, type);
+    }
 
-        if (!messageSent)
-        {
-            YI_LOGE(LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
-        }
-        else
-        {
-            bool valueAssigned = false;
-            CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
+    return CYIString(type.IsEmpty() ? "Invalid" : type);
+}
 
-            if (!valueAssigned)
-            {
-                YI_LOGE(LOG_TAG, "GetName did not receive a response from the web messaging bridge!");
-            }
-            else if (response.HasError())
-            {
-                YI_LOGE(LOG_TAG, "%s", response.GetError()->GetMessage().GetData());
-            }
-            else
-            {
-                const yi::rapidjson::Value *pData = response.GetResult();
+CYIString CYIVideojsVideoPlayerPriv::GetNickname() const
+{
+    if (m_stateMirrorValidationEnabled)
+    {
+        CYIString nickname = QueryNickname();
 
-                if (!pData->IsString())
-                {
-                    YI_LOGE(LOG_TAG, "GetName expected a string type for result, received %s. JSON string for result: %s", CYIRapidJSONUtility::TypeToString(pData->GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(*pData).GetData());
-                }
-                else
-                {
-                    type = pData->GetString();
-                }
-            }
+        if (nickname != m_nickname)
+        {
+            YI_LOGW(LOG_TAG, "GetNickname mirrored value '%s' has drifted from the web view value '%s'.", m_nickname.GetData(), nickname.GetData());
         }
     }
 
-    return CYIString(type.IsEmpty() ? "Invalid" : type);
+    return m_nickname;
 }
 
-CYIString CYIVideojsVideoPlayerPriv::GetNickname() const
+CYIString CYIVideojsVideoPlayerPriv::QueryNickname() const
 {
     static const char *FUNCTION_NAME = "getNickname";
 
-    bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallPlayerInstanceFunction(yi::rapidjson::Document(), FUNCTION_NAME, yi::rapidjson::Value(yi::rapidjson::kArrayType), &messageSent);
+    CYIVideojsDocumentPool::Lease resultLease = m_documentPool.Acquire();
+    yi::rapidjson::Document result(resultLease.GetAllocator());
 
-    if (!messageSent)
+    // a player without a nickname answers with null
+    if (!InvokePlayerFunction(FUNCTION_NAME, result) || !result.IsString())
     {
-        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
+        return CYIString::EmptyString();
     }
-    else
-    {
-        bool valueAssigned = false;
-        CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
 
-        if (!valueAssigned)
-        {
-            YI_LOGE(LOG_TAG, "GetNickname did not receive a response from the web messaging bridge!");
-        }
-        else if (response.HasError())
-        {
-            YI_LOGE(LOG_TAG, "%s", response.GetError()->GetMessage().GetData());
-        }
-        else
-        {
-            const yi::rapidjson::Value *pData = response.GetResult();
+    return CYIString(result.GetString());
+}
 
-            if (!pData->IsString())
-            {
-                YI_LOGE(LOG_TAG, "GetNickname expected a string type for result, received %s. JSON string for result: %s", CYIRapidJSONUtility::TypeToString(pData->GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(*pData).GetData());
-            }
-            else
-            {
-                return pData->GetString();
-            }
-        }
-    }
+double CYIVideojsVideoPlayerPriv::QueryDevicePixelRatio() const
+{
+    static const char *FUNCTION_NAME = "getDevicePixelRatio";
 
-    return CYIString::EmptyString();
+    double devicePixelRatio = 1.0;
+
+    InvokeStaticPlayerFunction(FUNCTION_NAME, devicePixelRatio);
+
+    return devicePixelRatio > 0.0 ? devicePixelRatio : 1.0;
 }
 
 CYIString CYIVideojsVideoPlayerPriv::GetVersion() const
@@ -1141,40 +2427,7 @@ CYIString CYIVideojsVideoPlayerPriv::GetVersion() const
 
     if (version.IsEmpty())
     {
-        bool messageSent = false;
-        CYIWebMessagingBridge::FutureResponse futureResponse = CallStaticPlayerFunction(yi::rapidjson::Document(), FUNCTION_NAME, yi::rapidjson::Value(yi::rapidjson::kArrayType), &messageSent);
-
-        if (!messageSent)
-        {
-            YI_LOGE(LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
-        }
-        else
-        {
-            bool valueAssigned = false;
-            CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
-
-            if (!valueAssigned)
-            {
-                YI_LOGE(LOG_TAG, "GetVersion did not receive a response from the web messaging bridge!");
-            }
-            else if (response.HasError())
-            {
-                YI_LOGE(LOG_TAG, "%s", response.GetError()->GetMessage().GetData());
-            }
-            else
-            {
-                const yi::rapidjson::Value *pData = response.GetResult();
-
-                if (!pData->IsString())
-                {
-                    YI_LOGE(LOG_TAG, "GetVersion expected a string type for result, received %s. JSON string for result: %s", CYIRapidJSONUtility::TypeToString(pData->GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(*pData).GetData());
-                }
-                else
-                {
-                    version = pData->GetString();
-                }
-            }
-        }
+        InvokeStaticPlayerFunction(FUNCTION_NAME, version);
     }
 
     return version.IsEmpty() ? "Unknown" : version;
@@ -1184,34 +2437,12 @@ void CYIVideojsVideoPlayerPriv::SetNickname(const CYIString &nickname) const
 {
     static const char *FUNCTION_NAME = "setNickname";
 
-    yi::rapidjson::Document command(yi::rapidjson::kObjectType);
-    yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = command.GetAllocator();
-
-    yi::rapidjson::Value arguments(yi::rapidjson::kArrayType);
-    yi::rapidjson::Value nicknameValue(nickname.GetData(), allocator);
-    arguments.PushBack(nicknameValue, allocator);
-
-    bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallPlayerInstanceFunction(std::move(command), FUNCTION_NAME, std::move(arguments), &messageSent);
-
-    if (!messageSent)
-    {
-        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
-    }
-    else
-    {
-        bool valueAssigned = false;
-        CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
+    m_nickname = nickname;
 
-        if (!valueAssigned)
-        {
-            YI_LOGE(LOG_TAG, "SetNickname did not receive a response from the web messaging bridge!");
-        }
-        else if (response.HasError())
-        {
-            YI_LOGE(LOG_TAG, "%s", response.GetError()->GetMessage().GetData());
-        }
-    }
+    DispatchPlayerCommandWithCompletion(FUNCTION_NAME, [this](const yi::rapidjson::Value &result) {
+        // the web view trims the nickname, so the acknowledged value is the authoritative one
+        m_nickname = result.IsString() ? CYIString(result.GetString()) : CYIString::EmptyString();
+    }, nickname);
 }
 
 CYIAbstractVideoPlayer::Statistics CYIVideojsVideoPlayerPriv::GetStatistics() const
@@ -1225,6 +2456,7 @@ CYIAbstractVideoPlayer::Statistics CYIVideojsVideoPlayerPriv::GetStatistics() co
     stats.totalBitrateKbps = m_currentTotalBitrateKbps;
     stats.defaultTotalBitrateKbps = m_initialTotalBitrateKbps;
     stats.bufferLengthMs = m_bufferLengthMs;
+    stats.minimumBufferLengthMs = static_cast<float>(m_bufferLength.min.count());
     return stats;
 }
 
@@ -1234,74 +2466,141 @@ std::unique_ptr<CYIVideoSurface> CYIVideojsVideoPlayerPriv::CreateSurface()
     return pSurface;
 }
 
-bool CYIVideojsVideoPlayerPriv::SupportsFormat(CYIAbstractVideoPlayer::StreamingFormat format, CYIAbstractVideoPlayer::DRMScheme drmScheme) const
+void CYIVideojsVideoPlayerPriv::ProbeSupportedFormats()
 {
-    static const char *FUNCTION_NAME = "isStreamFormatSupported";
+    static const char *FUNCTION_NAME = "getStreamFormatSupportMatrix";
+
+    static_assert((sizeof(STREAMING_FORMATS) / sizeof(STREAMING_FORMATS[0])) == STREAMING_FORMAT_COUNT, "Streaming format list does not match the supported format matrix size.");
+    static_assert((sizeof(DRM_SCHEMES) / sizeof(DRM_SCHEMES[0])) == DRM_SCHEME_COUNT, "DRM scheme list does not match the supported format matrix size.");
+
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+    m_supportedFormatsProbed = false;
+    m_supportedFormats.reset();
 
     yi::rapidjson::Document command(yi::rapidjson::kObjectType);
     yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = command.GetAllocator();
 
-    yi::rapidjson::Value arguments(yi::rapidjson::kArrayType);
-    CYIString streamFormatName(StreamFormatToString(format));
+    yi::rapidjson::Value streamFormatsValue(yi::rapidjson::kArrayType);
 
-    yi::rapidjson::Value streamFormatValue(streamFormatName.GetData(), allocator);
-    arguments.PushBack(streamFormatValue, allocator);
+    for (CYIAbstractVideoPlayer::StreamingFormat format : STREAMING_FORMATS)
+    {
+        streamFormatsValue.PushBack(yi::rapidjson::Value(StreamFormatToString(format).GetData(), allocator), allocator);
+    }
 
-    CYIString drmSchemeName(DRMSchemeToString(drmScheme));
-    if (drmScheme != CYIAbstractVideoPlayer::DRMScheme::None && !drmSchemeName.IsEmpty())
+    // a null DRM type checks for unencrypted playback support, matching the arguments passed by QuerySupportsFormat
+    yi::rapidjson::Value drmTypesValue(yi::rapidjson::kArrayType);
+
+    for (CYIAbstractVideoPlayer::DRMScheme drmScheme : DRM_SCHEMES)
     {
-        yi::rapidjson::Value drmSchemeValue(drmSchemeName.GetData(), allocator);
-        arguments.PushBack(drmSchemeValue, allocator);
+        if (drmScheme == CYIAbstractVideoPlayer::DRMScheme::None)
+        {
+            drmTypesValue.PushBack(yi::rapidjson::Value(yi::rapidjson::kNullType), allocator);
+        }
+        else
+        {
+            drmTypesValue.PushBack(yi::rapidjson::Value(DRMSchemeToString(drmScheme).GetData(), allocator), allocator);
+        }
     }
 
+    yi::rapidjson::Value arguments(yi::rapidjson::kArrayType);
+    arguments.PushBack(streamFormatsValue, allocator);
+    arguments.PushBack(drmTypesValue, allocator);
+
     bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallPlayerInstanceFunction(std::move(command), FUNCTION_NAME, std::move(arguments), &messageSent);
+    CYIVideojsBridgeTransport::FutureResponse futureResponse = CallPlayerInstanceFunction(std::move(command), FUNCTION_NAME, std::move(arguments), &messageSent);
 
     if (!messageSent)
     {
         YI_LOGE(LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
+        return;
     }
-    else
+
+    bool valueAssigned = false;
+    CYIVideojsBridgeTransport::Response response = TakeResponse(FUNCTION_NAME, futureResponse, &valueAssigned);
+
+    if (!valueAssigned)
+    {
+        YI_LOGE(LOG_TAG, "ProbeSupportedFormats did not receive a response from the web messaging bridge!");
+        return;
+    }
+    else if (response.HasError())
     {
-        bool valueAssigned = false;
-        CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
+        YI_LOGE(LOG_TAG, "%s", response.GetErrorMessage().GetData());
+        return;
+    }
 
-        if (!valueAssigned)
-        {
-            YI_LOGE(LOG_TAG, "SupportsFormat did not receive a response from the web messaging bridge!");
-        }
-        else if (response.HasError())
+    const yi::rapidjson::Value *pData = response.GetResult();
+
+    if (!pData->IsArray() || pData->Size() != STREAMING_FORMAT_COUNT)
+    {
+        YI_LOGE(LOG_TAG, "ProbeSupportedFormats expected an array of %zu stream format results, received %s. JSON string for result: %s", STREAMING_FORMAT_COUNT, CYIRapidJSONUtility::TypeToString(pData->GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(*pData).GetData());
+        return;
+    }
+
+    for (yi::rapidjson::SizeType formatIndex = 0; formatIndex < pData->Size(); ++formatIndex)
+    {
+        const yi::rapidjson::Value &drmResultsValue = (*pData)[formatIndex];
+
+        if (!drmResultsValue.IsArray() || drmResultsValue.Size() != DRM_SCHEME_COUNT)
         {
-            YI_LOGE(LOG_TAG, "%s", response.GetError()->GetMessage().GetData());
+            YI_LOGE(LOG_TAG, "ProbeSupportedFormats expected an array of %zu DRM results for %s. JSON string for result: %s", DRM_SCHEME_COUNT, StreamFormatToString(STREAMING_FORMATS[formatIndex]).GetData(), CYIRapidJSONUtility::CreateStringFromValue(drmResultsValue).GetData());
+            m_supportedFormats.reset();
+            return;
         }
-        else
+
+        for (yi::rapidjson::SizeType drmSchemeIndex = 0; drmSchemeIndex < drmResultsValue.Size(); ++drmSchemeIndex)
         {
-            const yi::rapidjson::Value *pData = response.GetResult();
+            const yi::rapidjson::Value &supportedValue = drmResultsValue[drmSchemeIndex];
 
-            if (!pData->IsBool())
-            {
-                YI_LOGE(LOG_TAG, "SupportsFormat expected a boolean type for result, received %s. JSON string for result: %s", CYIRapidJSONUtility::TypeToString(pData->GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(*pData).GetData());
-            }
-            else
-            {
-                return pData->GetBool();
-            }
+            m_supportedFormats.set(formatIndex * DRM_SCHEME_COUNT + drmSchemeIndex, supportedValue.IsBool() && supportedValue.GetBool());
         }
     }
 
-    return false;
+    m_supportedFormatsProbed = true;
+
+    YI_LOGI(LOG_TAG, "Probed %zu stream format and DRM combinations in %lld ms.", m_supportedFormats.size(), static_cast<long long>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count()));
+}
+
+bool CYIVideojsVideoPlayerPriv::SupportsFormat(CYIAbstractVideoPlayer::StreamingFormat format, CYIAbstractVideoPlayer::DRMScheme drmScheme) const
+{
+    size_t supportedFormatIndex = GetSupportedFormatIndex(format, drmScheme);
+
+    if (m_supportedFormatsProbed && supportedFormatIndex < m_supportedFormats.size())
+    {
+        return m_supportedFormats.test(supportedFormatIndex);
+    }
+
+    return QuerySupportsFormat(format, drmScheme);
+}
+
+bool CYIVideojsVideoPlayerPriv::QuerySupportsFormat(CYIAbstractVideoPlayer::StreamingFormat format, CYIAbstractVideoPlayer::DRMScheme drmScheme) const
+{
+    static const char *FUNCTION_NAME = "isStreamFormatSupported";
+
+    CYIString drmSchemeName(DRMSchemeToString(drmScheme));
+
+    bool supported = false;
+
+    if (drmScheme != CYIAbstractVideoPlayer::DRMScheme::None && !drmSchemeName.IsEmpty())
+    {
+        InvokePlayerFunction(FUNCTION_NAME, supported, StreamFormatToString(format), drmSchemeName);
+    }
+    else
+    {
+        InvokePlayerFunction(FUNCTION_NAME, supported, StreamFormatToString(format));
+    }
+
+    return supported;
 }
 
 void CYIVideojsVideoPlayerPriv::Prepare(const CYIUrl &videoURI, CYIAbstractVideoPlayer::StreamingFormat format)
 {
     static const char *FUNCTION_NAME = "prepare";
-    static const uint32_t PREPARE_TIMEOUT_MS = 3000;
-
-    yi::rapidjson::Document command(yi::rapidjson::kObjectType);
-    yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = command.GetAllocator();
 
-    yi::rapidjson::Value arguments(yi::rapidjson::kArrayType);
-    yi::rapidjson::Value playerConfigurationValue(yi::rapidjson::kObjectType);
+    CYIVideojsDocumentPool::Lease configurationLease = m_documentPool.Acquire();
+    yi::rapidjson::Document playerConfigurationValue(yi::rapidjson::kObjectType, configurationLease.GetAllocator());
+    yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = playerConfigurationValue.GetAllocator();
 
     CYIString url(videoURI.ToString());
     yi::rapidjson::Value urlValue(url.GetData(), allocator);
@@ -1315,117 +2614,133 @@ void CYIVideojsVideoPlayerPriv::Prepare(const CYIUrl &videoURI, CYIAbstractVideo
 
     playerConfigurationValue.AddMember(yi::rapidjson::StringRef("maxBitrateKbps"), yi::rapidjson::Value(static_cast<double>(m_pPub->m_maxBitrate) / BITRATE_KBPS_SCALE), allocator);
 
+    // the buffer goals are applied before the source is set so that the first segment requests already honour them
+    yi::rapidjson::Value bufferLengthValue(yi::rapidjson::kObjectType);
+    bufferLengthValue.AddMember(yi::rapidjson::StringRef("minimumBufferLengthMs"), yi::rapidjson::Value(static_cast<int64_t>(m_requestedBufferLength.min.count())), allocator);
+    bufferLengthValue.AddMember(yi::rapidjson::StringRef("maximumBufferLengthMs"), yi::rapidjson::Value(static_cast<int64_t>(m_requestedBufferLength.max.count())), allocator);
+    playerConfigurationValue.AddMember(yi::rapidjson::StringRef("bufferLength"), bufferLengthValue, allocator);
+
     AddDRMConfigurationToValue(m_pPub->m_pDRMConfiguration.get(), playerConfigurationValue, allocator);
 
-    arguments.PushBack(playerConfigurationValue, allocator);
+    CancelPrepare();
+    CancelSeek();
+    m_seekableRanges.Clear();
+
+    // rendition ids index the ladder of the previous source, so a new source always starts with automatic selection
+    m_videoRenditions.clear();
+    m_hasSelectedRendition = false;
+    m_hasSentABRRendition = false;
+
+    playerConfigurationValue.AddMember(yi::rapidjson::StringRef("prepareId"), yi::rapidjson::Value(m_prepareId), allocator);
 
     bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallPlayerInstanceFunction(std::move(command), FUNCTION_NAME, std::move(arguments), &messageSent);
+    CYIVideojsBridgeTransport::FutureResponse futureResponse = SendPlayerFunction(FUNCTION_NAME, &messageSent, playerConfigurationValue);
 
     if (!messageSent)
     {
         YI_LOGE(LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
+        return;
     }
-    else
+
+    m_preparing = true;
+    m_prepareStartTime = std::chrono::steady_clock::now();
+    m_prepareStatistics.preparesStarted++;
+
+    // the prepare completes through the state changed events and its response is only used to log errors, so it is
+    // polled on its own rather than holding back the ordered command responses
+    m_prepareFutureResponse = std::move(futureResponse);
+    m_prepareResponsePending = true;
+    m_prepareResponseTimer.Start(PENDING_COMMAND_POLL_INTERVAL_MS);
+}
+
+void CYIVideojsVideoPlayerPriv::CancelPrepare()
+{
+    if (m_preparing)
     {
-        bool valueAssigned = false;
-        CYIWebMessagingBridge::Response response = futureResponse.Take(PREPARE_TIMEOUT_MS, &valueAssigned);
+        m_preparing = false;
+        m_prepareStatistics.preparesCancelled++;
 
-        if (!valueAssigned)
-        {
-            YI_LOGE(LOG_TAG, "Prepare did not receive a response from the web messaging bridge!");
-        }
-        else if (response.HasError())
-        {
-            YI_LOGE(LOG_TAG, "%s", response.GetError()->GetMessage().GetData());
-        }
+        YI_LOGD(LOG_TAG, "Cancelled outstanding prepare #%d.", m_prepareId);
     }
+
+    // the response to a replaced prepare is of no interest anymore
+    m_prepareResponseTimer.Stop();
+    m_prepareResponsePending = false;
+    m_prepareFutureResponse = CYIVideojsBridgeTransport::FutureResponse();
+
+    // any state events tagged with the previous prepare id are now stale
+    ++m_prepareId;
 }
 
-void CYIVideojsVideoPlayerPriv::Play()
+void CYIVideojsVideoPlayerPriv::OnPrepareResponseTimerTimedOut()
 {
-    static const char *FUNCTION_NAME = "play";
+    static const char *FUNCTION_NAME = "prepare";
 
-    bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallPlayerInstanceFunction(yi::rapidjson::Document(), FUNCTION_NAME, yi::rapidjson::Value(yi::rapidjson::kArrayType), &messageSent);
+    if (!m_prepareResponsePending)
+    {
+        return;
+    }
 
-    if (!messageSent)
+    bool valueAssigned = false;
+    CYIVideojsBridgeTransport::Response response = m_prepareFutureResponse.Take(0, &valueAssigned);
+
+    if (!valueAssigned && std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_prepareStartTime).count() < PREPARE_RESPONSE_TIMEOUT_MS)
     {
-        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
+        m_prepareResponseTimer.Start(PENDING_COMMAND_POLL_INTERVAL_MS);
+        return;
+    }
+
+    m_prepareResponsePending = false;
+    m_prepareFutureResponse = CYIVideojsBridgeTransport::FutureResponse();
+
+    if (!valueAssigned)
+    {
+        // a slow acknowledgement does not mean that the prepare failed, it still completes through its state events
+        RecordBridgeLatency(FUNCTION_NAME, m_prepareStartTime, BridgeCallOutcome::Timeout);
+        YI_LOGW(LOG_TAG, "Prepare #%d was not acknowledged within %u ms.", m_prepareId, PREPARE_RESPONSE_TIMEOUT_MS);
+    }
+    else if (response.HasError())
+    {
+        RecordBridgeLatency(FUNCTION_NAME, m_prepareStartTime, BridgeCallOutcome::Error);
+        YI_LOGE(LOG_TAG, "Prepare #%d failed: %s", m_prepareId, response.GetErrorMessage().GetData());
     }
     else
     {
-        bool valueAssigned = false;
-        CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
-
-        if (!valueAssigned)
-        {
-            YI_LOGE(LOG_TAG, "Play did not receive a response from the web messaging bridge!");
-        }
-        else if (response.HasError())
-        {
-            YI_LOGE(LOG_TAG, "%s", response.GetError()->GetMessage().GetData());
-        }
+        RecordBridgeLatency(FUNCTION_NAME, m_prepareStartTime, BridgeCallOutcome::Response);
     }
 }
 
-void CYIVideojsVideoPlayerPriv::Pause()
+void CYIVideojsVideoPlayerPriv::Play()
 {
-    static const char *FUNCTION_NAME = "pause";
+    static const char *FUNCTION_NAME = "play";
 
-    bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallPlayerInstanceFunction(yi::rapidjson::Document(), FUNCTION_NAME, yi::rapidjson::Value(yi::rapidjson::kArrayType), &messageSent);
+    DispatchPlayerCommand(FUNCTION_NAME);
+}
 
-    if (!messageSent)
-    {
-        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
-    }
-    else
-    {
-        bool valueAssigned = false;
-        CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
+void CYIVideojsVideoPlayerPriv::Pause()
+{
+    static const char *FUNCTION_NAME = "pause";
 
-        if (!valueAssigned)
-        {
-            YI_LOGE(LOG_TAG, "Pause did not receive a response from the web messaging bridge!");
-        }
-        else if (response.HasError())
-        {
-            YI_LOGE(LOG_TAG, "%s", response.GetError()->GetMessage().GetData());
-        }
-    }
+    DispatchPlayerCommand(FUNCTION_NAME);
 }
 
 void CYIVideojsVideoPlayerPriv::Stop()
 {
     static const char *FUNCTION_NAME = "stop";
 
-    bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallPlayerInstanceFunction(yi::rapidjson::Document(), FUNCTION_NAME, yi::rapidjson::Value(yi::rapidjson::kArrayType), &messageSent);
-
-    if (!messageSent)
-    {
-        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
-    }
-    else
-    {
-        bool valueAssigned = false;
-        CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
+    CancelPrepare();
+    CancelSeek();
 
-        if (!valueAssigned)
-        {
-            YI_LOGE(LOG_TAG, "Stop did not receive a response from the web messaging bridge!");
-        }
-        else if (response.HasError())
-        {
-            YI_LOGE(LOG_TAG, "%s", response.GetError()->GetMessage().GetData());
-        }
-    }
+    DispatchPlayerCommand(FUNCTION_NAME);
 
     m_durationMs = 0;
-    m_currentTimeMs = 0;
+    AnchorPlaybackClock(0);
     m_buffering = false;
     m_isLive = false;
+    m_seekableRanges.Clear();
+    m_videoRenditions.clear();
+    m_hasSelectedRendition = false;
+    m_hasSentABRRendition = false;
     m_currentAudioBitrateKbps = -1.0f;
     m_initialAudioBitrateKbps = -1.0f;
     m_currentVideoBitrateKbps = -1.0f;
@@ -1439,6 +2754,31 @@ void CYIVideojsVideoPlayerPriv::Stop()
     m_textTracks.clear();
 }
 
+std::vector<CYIAbstractVideoPlayer::SeekableRange> CYIVideojsVideoPlayerPriv::GetLiveSeekableRanges() const
+{
+    if (!m_isLive)
+    {
+        return std::vector<CYIAbstractVideoPlayer::SeekableRange>();
+    }
+
+    return m_seekableRanges.GetRanges();
+}
+
+uint64_t CYIVideojsVideoPlayerPriv::GetNearestSeekablePositionMs(uint64_t positionMs) const
+{
+    if (m_isLive)
+    {
+        return m_seekableRanges.GetNearestSeekablePositionMs(positionMs);
+    }
+
+    return m_durationMs > 0 ? std::min(positionMs, m_durationMs) : positionMs;
+}
+
+uint64_t CYIVideojsVideoPlayerPriv::GetLiveEdgeMs() const
+{
+    return m_isLive ? m_seekableRanges.GetLiveEdgeMs() : 0;
+}
+
 uint64_t CYIVideojsVideoPlayerPriv::GetDurationMs() const
 {
     return m_durationMs;
@@ -1446,88 +2786,212 @@ uint64_t CYIVideojsVideoPlayerPriv::GetDurationMs() const
 
 uint64_t CYIVideojsVideoPlayerPriv::GetCurrentTimeMs() const
 {
-    return m_currentTimeMs;
+    if (m_pPub->GetPlayerState() != CYIAbstractVideoPlayer::PlaybackState::Playing)
+    {
+        m_lastInterpolatedTimeMs = m_currentTimeMs;
+        return m_currentTimeMs;
+    }
+
+    // the clock only runs ahead of the last update for a bounded time, so a stall that is never reported does not drift forever
+    uint64_t maximumInterpolationMs = std::max(MINIMUM_CLOCK_INTERPOLATION_MS, static_cast<uint64_t>(m_timeUpdateIntervalMs) * 2);
+    uint64_t elapsedMs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_currentTimeAnchor).count());
+    uint64_t interpolatedTimeMs = m_currentTimeMs + std::min(elapsedMs, maximumInterpolationMs);
+
+    if (!m_isLive && m_durationMs > 0)
+    {
+        interpolatedTimeMs = std::min(interpolatedTimeMs, m_durationMs);
+    }
+
+    // small corrections from the web view are absorbed rather than moving the clock backwards
+    if (interpolatedTimeMs < m_lastInterpolatedTimeMs && m_lastInterpolatedTimeMs - interpolatedTimeMs <= CLOCK_CORRECTION_TOLERANCE_MS)
+    {
+        interpolatedTimeMs = m_lastInterpolatedTimeMs;
+    }
+
+    m_lastInterpolatedTimeMs = interpolatedTimeMs;
+
+    return interpolatedTimeMs;
+}
+
+void CYIVideojsVideoPlayerPriv::AnchorPlaybackClock(uint64_t currentTimeMs)
+{
+    m_currentTimeMs = currentTimeMs;
+    m_currentTimeAnchor = std::chrono::steady_clock::now();
 }
 
-void CYIVideojsVideoPlayerPriv::Seek(uint64_t seekPositionMS)
+void CYIVideojsVideoPlayerPriv::SetTimeUpdateIntervalMs(uint32_t intervalMs)
 {
-    static const char *FUNCTION_NAME = "seek";
+    static const char *FUNCTION_NAME = "setTimeUpdateInterval";
 
-    yi::rapidjson::Document command(yi::rapidjson::kObjectType);
-    yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = command.GetAllocator();
+    m_timeUpdateIntervalMs = intervalMs;
 
-    yi::rapidjson::Value arguments(yi::rapidjson::kArrayType);
-    arguments.PushBack(yi::rapidjson::Value(seekPositionMS / 1000.0), allocator);
+    if (!m_initialized)
+    {
+        return;
+    }
 
-    bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallPlayerInstanceFunction(std::move(command), FUNCTION_NAME, std::move(arguments), &messageSent);
+    DispatchPlayerCommand(FUNCTION_NAME, intervalMs);
+}
 
-    if (!messageSent)
+void CYIVideojsVideoPlayerPriv::SetMaxBitrate(uint64_t maxBitrate)
+{
+    static const char *FUNCTION_NAME = "setMaxBitrate";
+
+    if (!m_initialized)
     {
-        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
+        return;
     }
-    else
+
+    // the cap is also sent with every prepare, this pushes changes to a source that is already playing
+    DispatchPlayerCommand(FUNCTION_NAME, static_cast<double>(maxBitrate) / BITRATE_KBPS_SCALE);
+}
+
+uint32_t CYIVideojsVideoPlayerPriv::GetTimeUpdateIntervalMs() const
+{
+    return m_timeUpdateIntervalMs;
+}
+
+void CYIVideojsVideoPlayerPriv::Seek(uint64_t seekPositionMS)
+{
+    m_seekStatistics.seeksRequested++;
+
+    // live targets outside the DVR window would fail or rebuffer in the web view, so they are moved to the closest seekable position
+    if (m_isLive && !m_seekableRanges.IsEmpty())
     {
-        bool valueAssigned = false;
-        CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
+        seekPositionMS = m_seekableRanges.GetNearestSeekablePositionMs(seekPositionMS);
+    }
 
-        if (!valueAssigned)
-        {
-            YI_LOGE(LOG_TAG, "Seek did not receive a response from the web messaging bridge!");
-        }
-        else if (response.HasError())
+    if (m_seekInFlight)
+    {
+        // only the latest target is kept, any target that was already waiting is dropped without being fetched
+        if (m_seekPending)
         {
-            YI_LOGE(LOG_TAG, "%s", response.GetError()->GetMessage().GetData());
+            m_seekStatistics.seeksSuperseded++;
         }
+
+        m_seekPending = true;
+        m_pendingSeekPositionMs = seekPositionMS;
+    }
+    else
+    {
+        SendSeek(seekPositionMS);
     }
+
+    // jump the clock to the seek target so that it does not keep running from the old position until the web view reports back
+    AnchorPlaybackClock(seekPositionMS);
+    m_lastInterpolatedTimeMs = seekPositionMS;
 }
 
-bool CYIVideojsVideoPlayerPriv::SelectAudioTrack(uint32_t id)
+void CYIVideojsVideoPlayerPriv::SendSeek(uint64_t seekPositionMS)
 {
-    static const char *FUNCTION_NAME = "selectAudioTrack";
+    static const char *FUNCTION_NAME = "seek";
 
-    yi::rapidjson::Document command(yi::rapidjson::kObjectType);
-    yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = command.GetAllocator();
+    DispatchPlayerCommand(FUNCTION_NAME, seekPositionMS / 1000.0);
 
-    yi::rapidjson::Value arguments(yi::rapidjson::kArrayType);
-    arguments.PushBack(yi::rapidjson::Value(id), allocator);
+    m_seekInFlight = true;
+    m_awaitingSeekPlayback = false;
+    m_seekSentTime = std::chrono::steady_clock::now();
+    m_seekStatistics.seeksSent++;
 
-    bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallPlayerInstanceFunction(std::move(command), FUNCTION_NAME, std::move(arguments), &messageSent);
+    m_seekTimeoutTimer.Start(SEEK_COMPLETION_TIMEOUT_MS);
+}
 
-    if (!messageSent)
+void CYIVideojsVideoPlayerPriv::CompleteSeek()
+{
+    m_awaitingSeekPlayback = false;
+
+    uint64_t latencyMs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_seekSentTime).count());
+
+    m_seekStatistics.seeksCompleted++;
+    m_seekStatistics.lastSeekLatencyMs = latencyMs;
+    m_seekStatistics.maximumSeekLatencyMs = std::max(m_seekStatistics.maximumSeekLatencyMs, latencyMs);
+
+    YI_LOGD(LOG_TAG, "Seek resumed playback in %llu ms.", static_cast<unsigned long long>(latencyMs));
+}
+
+void CYIVideojsVideoPlayerPriv::CancelSeek()
+{
+    m_seekTimeoutTimer.Stop();
+
+    if (m_seekPending)
     {
-        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
+        m_seekStatistics.seeksSuperseded++;
     }
-    else
+
+    m_seekInFlight = false;
+    m_seekPending = false;
+    m_awaitingSeekPlayback = false;
+}
+
+void CYIVideojsVideoPlayerPriv::OnSeekTimeoutTimerTimedOut()
+{
+    if (!m_seekInFlight)
     {
-        bool valueAssigned = false;
-        CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
+        return;
+    }
 
-        if (!valueAssigned)
-        {
-            YI_LOGE(LOG_TAG, "SelectAudioTrack did not receive a response from the web messaging bridge!");
-        }
-        else if (response.HasError())
-        {
-            YI_LOGE(LOG_TAG, "%s", response.GetError()->GetMessage().GetData());
-        }
-        else
-        {
-            const yi::rapidjson::Value *pData = response.GetResult();
+    YI_LOGW(LOG_TAG, "Seek did not complete within %u ms, no longer waiting for it.", SEEK_COMPLETION_TIMEOUT_MS);
 
-            if (!pData->IsBool())
-            {
-                YI_LOGE(LOG_TAG, "SelectAudioTrack expected a boolean type for result, received %s. JSON string for result: %s", CYIRapidJSONUtility::TypeToString(pData->GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(*pData).GetData());
-            }
-            else
+    m_seekInFlight = false;
+    m_seekStatistics.seeksTimedOut++;
+
+    if (m_seekPending)
+    {
+        m_seekPending = false;
+        SendSeek(m_pendingSeekPositionMs);
+    }
+}
+
+bool CYIVideojsVideoPlayerPriv::SelectAudioTrack(uint32_t id)
+{
+    static const char *FUNCTION_NAME = "selectAudioTrack";
+
+    if (m_asynchronousCommandsEnabled)
+    {
+        // the selection is assumed to succeed, the completion runs after this function has returned so it only captures by value
+        DispatchPlayerCommandWithCompletion(FUNCTION_NAME, [this, id](const yi::rapidjson::Value &result) {
+            if (!OnAudioTrackSelected(id, result) && result.IsBool())
             {
-                return pData->GetBool();
+                YI_LOGW(LOG_TAG, "SelectAudioTrack was rejected by the web view.");
             }
+        }, id);
+
+        return true;
+    }
+
+    // synchronous commands complete before DispatchPlayerCommandWithCompletion returns
+    bool selected = false;
+
+    DispatchPlayerCommandWithCompletion(FUNCTION_NAME, [this, id, &selected](const yi::rapidjson::Value &result) {
+        selected = OnAudioTrackSelected(id, result);
+    }, id);
+
+    return selected;
+}
+
+bool CYIVideojsVideoPlayerPriv::OnAudioTrackSelected(uint32_t id, const yi::rapidjson::Value &result)
+{
+    if (!result.IsBool())
+    {
+        YI_LOGE(LOG_TAG, "SelectAudioTrack expected a boolean type for result, received %s. JSON string for result: %s", CYIRapidJSONUtility::TypeToString(result.GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(result).GetData());
+        return false;
+    }
+
+    if (!result.GetBool())
+    {
+        return false;
+    }
+
+    for (const CYIAbstractVideoPlayer::AudioTrackInfo &audioTrack : m_audioTracks)
+    {
+        if (audioTrack.id == id)
+        {
+            m_activeAudioTrack = audioTrack;
+            break;
         }
     }
 
-    return false;
+    return true;
 }
 
 std::vector<CYIAbstractVideoPlayer::AudioTrackInfo> CYIVideojsVideoPlayerPriv::GetAudioTracks() const
@@ -1536,46 +3000,38 @@ std::vector<CYIAbstractVideoPlayer::AudioTrackInfo> CYIVideojsVideoPlayerPriv::G
 }
 
 CYIAbstractVideoPlayer::AudioTrackInfo CYIVideojsVideoPlayerPriv::GetActiveAudioTrack() const
+{
+    if (m_stateMirrorValidationEnabled)
+    {
+        CYIAbstractVideoPlayer::AudioTrackInfo audioTrackInfo = QueryActiveAudioTrack();
+
+        if (audioTrackInfo.id != m_activeAudioTrack.id)
+        {
+            YI_LOGW(LOG_TAG, "GetActiveAudioTrack mirrored track id %u has drifted from the web view track id %u.", m_activeAudioTrack.id, audioTrackInfo.id);
+        }
+    }
+
+    return m_activeAudioTrack;
+}
+
+CYIAbstractVideoPlayer::AudioTrackInfo CYIVideojsVideoPlayerPriv::QueryActiveAudioTrack() const
 {
     static const char *FUNCTION_NAME = "getActiveAudioTrack";
 
     CYIAbstractVideoPlayer::AudioTrackInfo audioTrackInfo(0);
 
-    bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallPlayerInstanceFunction(yi::rapidjson::Document(), FUNCTION_NAME, yi::rapidjson::Value(yi::rapidjson::kArrayType), &messageSent);
+    CYIVideojsDocumentPool::Lease resultLease = m_documentPool.Acquire();
+    yi::rapidjson::Document result(resultLease.GetAllocator());
 
-    if (!messageSent)
+    if (InvokePlayerFunction(FUNCTION_NAME, result))
     {
-        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
-    }
-    else
-    {
-        bool valueAssigned = false;
-        CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
-
-        if (!valueAssigned)
-        {
-            YI_LOGE(LOG_TAG, "GetActiveAudioTrack did not receive a response from the web messaging bridge!");
-        }
-        else if (response.HasError())
+        if (!result.IsObject())
         {
-            YI_LOGE(LOG_TAG, "%s", response.GetError()->GetMessage().GetData());
+            YI_LOGE(LOG_TAG, "GetActiveAudioTrack expected an object type for result, received %s. JSON string for result: %s", CYIRapidJSONUtility::TypeToString(result.GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(result).GetData());
         }
-        else
+        else if (!ConvertValueToTrackInfo(result, audioTrackInfo))
         {
-            const yi::rapidjson::Value *pData = response.GetResult();
-
-            if (!pData->IsObject())
-            {
-                YI_LOGE(LOG_TAG, "GetActiveAudioTrack expected an object type for result, received %s. JSON string for result: %s", CYIRapidJSONUtility::TypeToString(pData->GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(*pData).GetData());
-            }
-            else
-            {
-                if (!ConvertValueToTrackInfo(*pData, audioTrackInfo))
-                {
-                    YI_LOGW(LOG_TAG, "GetActiveAudioTrack data is invalid. JSON string for track data: %s", CYIRapidJSONUtility::CreateStringFromValue(*pData).GetData());
-                }
-            }
+            YI_LOGW(LOG_TAG, "GetActiveAudioTrack data is invalid. JSON string for track data: %s", CYIRapidJSONUtility::CreateStringFromValue(result).GetData());
         }
     }
 
@@ -1584,44 +3040,28 @@ CYIAbstractVideoPlayer::AudioTrackInfo CYIVideojsVideoPlayerPriv::GetActiveAudio
 
 bool CYIVideojsVideoPlayerPriv::IsMuted() const
 {
-    static const char *FUNCTION_NAME = "isMuted";
-
-    bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallPlayerInstanceFunction(yi::rapidjson::Document(), FUNCTION_NAME, yi::rapidjson::Value(yi::rapidjson::kArrayType), &messageSent);
-
-    if (!messageSent)
-    {
-        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
-    }
-    else
+    if (m_stateMirrorValidationEnabled)
     {
-        bool valueAssigned = false;
-        CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
+        bool muted = QueryIsMuted();
 
-        if (!valueAssigned)
+        if (muted != m_muted)
         {
-            YI_LOGE(LOG_TAG, "IsMuted did not receive a response from the web messaging bridge!");
-        }
-        else if (response.HasError())
-        {
-            YI_LOGE(LOG_TAG, "%s", response.GetError()->GetMessage().GetData());
-        }
-        else
-        {
-            const yi::rapidjson::Value *pData = response.GetResult();
-
-            if (!pData->IsBool())
-            {
-                YI_LOGE(LOG_TAG, "IsMuted expected a boolean type for result, received %s. JSON string for result: %s", CYIRapidJSONUtility::TypeToString(pData->GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(*pData).GetData());
-            }
-            else
-            {
-                return pData->GetBool();
-            }
+            YI_LOGW(LOG_TAG, "IsMuted mirrored value %s has drifted from the web view value %s.", m_muted ? "true" : "false", muted ? "true" : "false");
         }
     }
 
-    return false;
+    return m_muted;
+}
+
+bool CYIVideojsVideoPlayerPriv::QueryIsMuted() const
+{
+    static const char *FUNCTION_NAME = "isMuted";
+
+    bool muted = false;
+
+    InvokePlayerFunction(FUNCTION_NAME, muted);
+
+    return muted;
 }
 
 void CYIVideojsVideoPlayerPriv::Mute(bool mute)
@@ -1629,95 +3069,54 @@ void CYIVideojsVideoPlayerPriv::Mute(bool mute)
     static const char *MUTE_FUNCTION_NAME = "mute";
     static const char *UNMUTE_FUNCTION_NAME = "unmute";
 
-    bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallPlayerInstanceFunction(yi::rapidjson::Document(), mute ? MUTE_FUNCTION_NAME: UNMUTE_FUNCTION_NAME, yi::rapidjson::Value(yi::rapidjson::kArrayType), &messageSent);
-
-    if (!messageSent)
-    {
-        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", mute ? MUTE_FUNCTION_NAME: UNMUTE_FUNCTION_NAME);
-    }
-    else
-    {
-        bool valueAssigned = false;
-        CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
+    // the mirrored state is updated immediately so that IsMuted reflects the request, the acknowledgement then confirms it
+    m_muted = mute;
 
-        if (!valueAssigned)
+    DispatchPlayerCommandWithCompletion(mute ? MUTE_FUNCTION_NAME : UNMUTE_FUNCTION_NAME, [this](const yi::rapidjson::Value &result) {
+        if (result.IsBool())
         {
-            YI_LOGE(LOG_TAG, "DisableTextTrack did not receive a response from the web messaging bridge!");
+            m_muted = result.GetBool();
         }
-        else if (response.HasError())
-        {
-            YI_LOGE(LOG_TAG, "%s", response.GetError()->GetMessage().GetData());
-        }
-    }
+    });
 }
 
 bool CYIVideojsVideoPlayerPriv::IsTextTrackEnabled() const
 {
-    static const char *FUNCTION_NAME = "isTextTrackEnabled";
-
-    bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallPlayerInstanceFunction(yi::rapidjson::Document(), FUNCTION_NAME, yi::rapidjson::Value(yi::rapidjson::kArrayType), &messageSent);
-
-    if (!messageSent)
+    if (m_stateMirrorValidationEnabled)
     {
-        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
-    }
-    else
-    {
-        bool valueAssigned = false;
-        CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
+        bool textTrackEnabled = QueryIsTextTrackEnabled();
 
-        if (!valueAssigned)
-        {
-            YI_LOGE(LOG_TAG, "IsTextTrackEnabled did not receive a response from the web messaging bridge!");
-        }
-        else if (response.HasError())
-        {
-            YI_LOGE(LOG_TAG, "%s", response.GetError()->GetMessage().GetData());
-        }
-        else
+        if (textTrackEnabled != m_textTrackEnabled)
         {
-            const yi::rapidjson::Value *pData = response.GetResult();
-
-            if (!pData->IsBool())
-            {
-                YI_LOGE(LOG_TAG, "IsTextTrackEnabled expected a boolean type for result, received %s. JSON string for result: %s", CYIRapidJSONUtility::TypeToString(pData->GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(*pData).GetData());
-            }
-            else
-            {
-                return pData->GetBool();
-            }
+            YI_LOGW(LOG_TAG, "IsTextTrackEnabled mirrored value %s has drifted from the web view value %s.", m_textTrackEnabled ? "true" : "false", textTrackEnabled ? "true" : "false");
         }
     }
 
-    return false;
+    return m_textTrackEnabled;
+}
+
+bool CYIVideojsVideoPlayerPriv::QueryIsTextTrackEnabled() const
+{
+    static const char *FUNCTION_NAME = "isTextTrackEnabled";
+
+    bool textTrackEnabled = false;
+
+    InvokePlayerFunction(FUNCTION_NAME, textTrackEnabled);
+
+    return textTrackEnabled;
 }
 
 void CYIVideojsVideoPlayerPriv::EnableTextTrack()
 {
     static const char *FUNCTION_NAME = "enableTextTrack";
 
-    bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallPlayerInstanceFunction(yi::rapidjson::Document(), FUNCTION_NAME, yi::rapidjson::Value(yi::rapidjson::kArrayType), &messageSent);
+    CYIVideojsDocumentPool::Lease resultLease = m_documentPool.Acquire();
+    yi::rapidjson::Document result(resultLease.GetAllocator());
 
-    if (!messageSent)
-    {
-        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
-    }
-    else
+    // the web view answers with the resulting active text track, the same payload as the activeTextTrackChanged event
+    if (InvokePlayerFunction(FUNCTION_NAME, result))
     {
-        bool valueAssigned = false;
-        CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
-
-        if (!valueAssigned)
-        {
-            YI_LOGE(LOG_TAG, "EnableTextTrack did not receive a response from the web messaging bridge!");
-        }
-        else if (response.HasError())
-        {
-            YI_LOGE(LOG_TAG, "%s", response.GetError()->GetMessage().GetData());
-        }
+        UpdateActiveTextTrack(FUNCTION_NAME, result);
     }
 }
 
@@ -1725,26 +3124,13 @@ void CYIVideojsVideoPlayerPriv::DisableTextTrack()
 {
     static const char *FUNCTION_NAME = "disableTextTrack";
 
-    bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallPlayerInstanceFunction(yi::rapidjson::Document(), FUNCTION_NAME, yi::rapidjson::Value(yi::rapidjson::kArrayType), &messageSent);
+    CYIVideojsDocumentPool::Lease resultLease = m_documentPool.Acquire();
+    yi::rapidjson::Document result(resultLease.GetAllocator());
 
-    if (!messageSent)
-    {
-        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
-    }
-    else
+    // the web view answers with the resulting active text track, the same payload as the activeTextTrackChanged event
+    if (InvokePlayerFunction(FUNCTION_NAME, result))
     {
-        bool valueAssigned = false;
-        CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
-
-        if (!valueAssigned)
-        {
-            YI_LOGE(LOG_TAG, "DisableTextTrack did not receive a response from the web messaging bridge!");
-        }
-        else if (response.HasError())
-        {
-            YI_LOGE(LOG_TAG, "%s", response.GetError()->GetMessage().GetData());
-        }
+        UpdateActiveTextTrack(FUNCTION_NAME, result);
     }
 }
 
@@ -1752,49 +3138,53 @@ bool CYIVideojsVideoPlayerPriv::SelectTextTrack(uint32_t id, bool enableTextTrac
 {
     static const char *FUNCTION_NAME = "selectTextTrack";
 
-    yi::rapidjson::Document command(yi::rapidjson::kObjectType);
-    yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = command.GetAllocator();
+    if (m_asynchronousCommandsEnabled)
+    {
+        // the selection is assumed to succeed, the completion runs after this function has returned so it only captures by value
+        DispatchPlayerCommandWithCompletion(FUNCTION_NAME, [this, id](const yi::rapidjson::Value &result) {
+            if (!OnTextTrackSelected(id, result) && result.IsBool())
+            {
+                YI_LOGW(LOG_TAG, "SelectTextTrack was rejected by the web view.");
+            }
+        }, id, enableTextTrack);
 
-    yi::rapidjson::Value arguments(yi::rapidjson::kArrayType);
-    arguments.PushBack(yi::rapidjson::Value(id), allocator);
-    arguments.PushBack(yi::rapidjson::Value().SetBool(enableTextTrack), allocator);
+        return true;
+    }
 
-    bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallPlayerInstanceFunction(std::move(command), FUNCTION_NAME, std::move(arguments), &messageSent);
+    // synchronous commands complete before DispatchPlayerCommandWithCompletion returns
+    bool selected = false;
 
-    if (!messageSent)
+    DispatchPlayerCommandWithCompletion(FUNCTION_NAME, [this, id, &selected](const yi::rapidjson::Value &result) {
+        selected = OnTextTrackSelected(id, result);
+    }, id, enableTextTrack);
+
+    return selected;
+}
+
+bool CYIVideojsVideoPlayerPriv::OnTextTrackSelected(uint32_t id, const yi::rapidjson::Value &result)
+{
+    if (!result.IsBool())
     {
-        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
+        YI_LOGE(LOG_TAG, "SelectTextTrack expected a boolean type for result, received %s. JSON string for result: %s", CYIRapidJSONUtility::TypeToString(result.GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(result).GetData());
+        return false;
     }
-    else
+
+    if (!result.GetBool())
     {
-        bool valueAssigned = false;
-        CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
+        return false;
+    }
 
-        if (!valueAssigned)
-        {
-            YI_LOGE(LOG_TAG, "SelectTextTrack did not receive a response from the web messaging bridge!");
-        }
-        else if (response.HasError())
-        {
-            YI_LOGE(LOG_TAG, "%s", response.GetError()->GetMessage().GetData());
-        }
-        else
+    for (const CYIAbstractVideoPlayer::ClosedCaptionsTrackInfo &textTrack : m_textTracks)
+    {
+        if (textTrack.id == id)
         {
-            const yi::rapidjson::Value *pData = response.GetResult();
-
-            if (!pData->IsBool())
-            {
-                YI_LOGE(LOG_TAG, "SelectTextTrack expected a boolean type for result, received %s. JSON string for result: %s", CYIRapidJSONUtility::TypeToString(pData->GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(*pData).GetData());
-            }
-            else
-            {
-                return pData->GetBool();
-            }
+            m_activeTextTrack = textTrack;
+            m_textTrackEnabled = true;
+            break;
         }
     }
 
-    return false;
+    return true;
 }
 
 std::vector<CYIAbstractVideoPlayer::ClosedCaptionsTrackInfo> CYIVideojsVideoPlayerPriv::GetTextTracks() const
@@ -1803,46 +3193,38 @@ std::vector<CYIAbstractVideoPlayer::ClosedCaptionsTrackInfo> CYIVideojsVideoPlay
 }
 
 CYIAbstractVideoPlayer::ClosedCaptionsTrackInfo CYIVideojsVideoPlayerPriv::GetActiveTextTrack() const
+{
+    if (m_stateMirrorValidationEnabled)
+    {
+        CYIAbstractVideoPlayer::ClosedCaptionsTrackInfo textTrackInfo = QueryActiveTextTrack();
+
+        if (textTrackInfo.id != m_activeTextTrack.id)
+        {
+            YI_LOGW(LOG_TAG, "GetActiveTextTrack mirrored track id %u has drifted from the web view track id %u.", m_activeTextTrack.id, textTrackInfo.id);
+        }
+    }
+
+    return m_activeTextTrack;
+}
+
+CYIAbstractVideoPlayer::ClosedCaptionsTrackInfo CYIVideojsVideoPlayerPriv::QueryActiveTextTrack() const
 {
     static const char *FUNCTION_NAME = "getActiveTextTrack";
 
     CYIAbstractVideoPlayer::ClosedCaptionsTrackInfo textTrackInfo(0);
 
-    bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallPlayerInstanceFunction(yi::rapidjson::Document(), FUNCTION_NAME, yi::rapidjson::Value(yi::rapidjson::kArrayType), &messageSent);
+    CYIVideojsDocumentPool::Lease resultLease = m_documentPool.Acquire();
+    yi::rapidjson::Document result(resultLease.GetAllocator());
 
-    if (!messageSent)
-    {
-        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
-    }
-    else
+    if (InvokePlayerFunction(FUNCTION_NAME, result))
     {
-        bool valueAssigned = false;
-        CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
-
-        if (!valueAssigned)
-        {
-            YI_LOGE(LOG_TAG, "GetActiveTextTrack did not receive a response from the web messaging bridge!");
-        }
-        else if (response.HasError())
+        if (!result.IsObject())
         {
-            YI_LOGE(LOG_TAG, "%s", response.GetError()->GetMessage().GetData());
+            YI_LOGE(LOG_TAG, "GetActiveTextTrack expected an object type for result, received %s. JSON string for result: %s", CYIRapidJSONUtility::TypeToString(result.GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(result).GetData());
         }
-        else
+        else if (!ConvertValueToTrackInfo(result, textTrackInfo))
         {
-            const yi::rapidjson::Value *pData = response.GetResult();
-
-            if (!pData->IsObject())
-            {
-                YI_LOGE(LOG_TAG, "GetActiveTextTrack expected an object type for result, received %s. JSON string for result: %s", CYIRapidJSONUtility::TypeToString(pData->GetType()).GetData(), CYIRapidJSONUtility::CreateStringFromValue(*pData).GetData());
-            }
-            else
-            {
-                if (!ConvertValueToTrackInfo(*pData, textTrackInfo))
-                {
-                    YI_LOGW(LOG_TAG, "GetActiveTextTrack data is invalid. JSON string for track data: %s", CYIRapidJSONUtility::CreateStringFromValue(*pData).GetData());
-                }
-            }
+            YI_LOGW(LOG_TAG, "GetActiveTextTrack data is invalid. JSON string for track data: %s", CYIRapidJSONUtility::CreateStringFromValue(result).GetData());
         }
     }
 
@@ -1853,11 +3235,9 @@ void CYIVideojsVideoPlayerPriv::AddExternalTextTrack(const CYIString &url, const
 {
     static const char *FUNCTION_NAME = "addExternalTextTrack";
 
-    yi::rapidjson::Document command(yi::rapidjson::kObjectType);
-    yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = command.GetAllocator();
-
-    yi::rapidjson::Value arguments(yi::rapidjson::kArrayType);
-    yi::rapidjson::Value textTrackDataValue(yi::rapidjson::kObjectType);
+    CYIVideojsDocumentPool::Lease textTrackDataLease = m_documentPool.Acquire();
+    yi::rapidjson::Document textTrackDataValue(yi::rapidjson::kObjectType, textTrackDataLease.GetAllocator());
+    yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = textTrackDataValue.GetAllocator();
 
     yi::rapidjson::Value urlValue(url.GetData(), allocator);
     yi::rapidjson::Value languageValue(language.GetData(), allocator);
@@ -1872,34 +3252,38 @@ void CYIVideojsVideoPlayerPriv::AddExternalTextTrack(const CYIString &url, const
     textTrackDataValue.AddMember(yi::rapidjson::StringRef("format"), formatValue, allocator);
     textTrackDataValue.AddMember(yi::rapidjson::StringRef("enable"), yi::rapidjson::Value(enable), allocator);
 
-    arguments.PushBack(textTrackDataValue, allocator);
+    IgnoredResult result;
+    InvokePlayerFunction(FUNCTION_NAME, result, textTrackDataValue);
+}
 
-    bool messageSent = false;
-    CYIWebMessagingBridge::FutureResponse futureResponse = CallPlayerInstanceFunction(std::move(command), FUNCTION_NAME, std::move(arguments), &messageSent);
+CYIAbstractVideoPlayer::TimedMetadataInterface *CYIVideojsVideoPlayerPriv::GetTimedMetadataInterface() const
+{
+    return const_cast<CYIVideojsVideoPlayerPriv *>(this);
+}
 
-    if (!messageSent)
+CYIAbstractVideoPlayer::BufferingInterface *CYIVideojsVideoPlayerPriv::GetBufferingInterface() const
+{
+    return const_cast<CYIVideojsVideoPlayerPriv *>(this);
+}
+
+void CYIVideojsVideoPlayerPriv::SetBufferLength(const CYIAbstractVideoPlayer::BufferLength &bufferLength)
+{
+    static const char *FUNCTION_NAME = "setBufferLength";
+
+    m_requestedBufferLength = bufferLength;
+
+    if (!m_initialized)
     {
-        YI_LOGE(LOG_TAG, "Failed to invoke %s function.", FUNCTION_NAME);
+        return;
     }
-    else
-    {
-        bool valueAssigned = false;
-        CYIWebMessagingBridge::Response response = futureResponse.Take(CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS, &valueAssigned);
 
-        if (!valueAssigned)
-        {
-            YI_LOGE(LOG_TAG, "AddExternalTextTrack did not receive a response from the web messaging bridge!");
-        }
-        else if (response.HasError())
-        {
-            YI_LOGE(LOG_TAG, "%s", response.GetError()->GetMessage().GetData());
-        }
-    }
+    // negative lengths restore the web player's default goals, the goals are read by the segment loaders on every buffer check so they apply during playback
+    DispatchPlayerCommand(FUNCTION_NAME, static_cast<int64_t>(bufferLength.min.count()), static_cast<int64_t>(bufferLength.max.count()));
 }
 
-CYIAbstractVideoPlayer::TimedMetadataInterface *CYIVideojsVideoPlayerPriv::GetTimedMetadataInterface() const
+CYIAbstractVideoPlayer::BufferLength CYIVideojsVideoPlayerPriv::GetBufferLength()
 {
-    return const_cast<CYIVideojsVideoPlayerPriv *>(this);
+    return m_bufferLength;
 }
 
 CYIVideojsVideoPlayer *CYIVideojsVideoPlayer::Create(const std::map<CYIString, CYIString> &playerConfiguration)
@@ -1925,7 +3309,7 @@ CYIVideojsVideoPlayer *CYIVideojsVideoPlayer::Create(yi::rapidjson::Document &&p
 {
     CYIVideojsVideoPlayer *pThis = new CYIVideojsVideoPlayer();
     pThis->m_pPriv = new CYIVideojsVideoPlayerPriv(pThis, std::move(playerConfiguration)); 
-    if(!CYIWebBridgeLocator::GetWebMessagingBridge())
+    if(!CYIVideojsBridgeTransport::GetTransport()->IsAvailable())
     {
         YI_LOGE(LOG_TAG, "CYIVideojsVideoPlayer is not available on this platform or platform configuration.");
 
@@ -2026,8 +3410,7 @@ uint64_t CYIVideojsVideoPlayer::GetCurrentTimeMs_() const
 
 std::vector<CYIAbstractVideoPlayer::SeekableRange> CYIVideojsVideoPlayer::GetLiveSeekableRanges_() const
 {
-    // note: not implemented
-    return std::vector<CYIAbstractVideoPlayer::SeekableRange>();
+    return m_pPriv->GetLiveSeekableRanges();
 }
 
 void CYIVideojsVideoPlayer::Seek_(uint64_t seekPositionMS)
@@ -2085,13 +3468,206 @@ void CYIVideojsVideoPlayer::AddExternalTextTrack(const CYIString &url, const CYI
     m_pPriv->AddExternalTextTrack(url, language, label, type, format, enable);
 }
 
+void CYIVideojsVideoPlayer::SetAsynchronousCommandsEnabled(bool enabled)
+{
+    m_pPriv->SetAsynchronousCommandsEnabled(enabled);
+}
+
+bool CYIVideojsVideoPlayer::AreAsynchronousCommandsEnabled() const
+{
+    return m_pPriv->AreAsynchronousCommandsEnabled();
+}
+
+void CYIVideojsVideoPlayer::SetCommandBatchingEnabled(bool enabled)
+{
+    m_pPriv->SetCommandBatchingEnabled(enabled);
+}
+
+bool CYIVideojsVideoPlayer::IsCommandBatchingEnabled() const
+{
+    return m_pPriv->IsCommandBatchingEnabled();
+}
+
+CYIVideojsVideoPlayer::CommandBatchStatistics CYIVideojsVideoPlayer::GetCommandBatchStatistics() const
+{
+    return m_pPriv->GetCommandBatchStatistics();
+}
+
+void CYIVideojsVideoPlayer::SetStateMirrorValidationEnabled(bool enabled)
+{
+    m_pPriv->SetStateMirrorValidationEnabled(enabled);
+}
+
+bool CYIVideojsVideoPlayer::IsStateMirrorValidationEnabled() const
+{
+    return m_pPriv->IsStateMirrorValidationEnabled();
+}
+
+CYIVideojsVideoPlayer::PrepareStatistics CYIVideojsVideoPlayer::GetPrepareStatistics() const
+{
+    return m_pPriv->GetPrepareStatistics();
+}
+
+CYIVideojsVideoPlayer::SeekStatistics CYIVideojsVideoPlayer::GetSeekStatistics() const
+{
+    return m_pPriv->GetSeekStatistics();
+}
+
+uint64_t CYIVideojsVideoPlayer::GetNearestSeekablePositionMs(uint64_t positionMs) const
+{
+    return m_pPriv->GetNearestSeekablePositionMs(positionMs);
+}
+
+uint64_t CYIVideojsVideoPlayer::GetLiveEdgeMs() const
+{
+    return m_pPriv->GetLiveEdgeMs();
+}
+
+void CYIVideojsVideoPlayer::SetMaxResolution(const glm::ivec2 &maxResolution)
+{
+    m_pPriv->SetMaxResolution(maxResolution);
+}
+
+glm::ivec2 CYIVideojsVideoPlayer::GetMaxResolution() const
+{
+    return m_pPriv->GetMaxResolution();
+}
+
+void CYIVideojsVideoPlayer::SetAutomaticResolutionCapEnabled(bool enabled)
+{
+    m_pPriv->SetAutomaticResolutionCapEnabled(enabled);
+}
+
+bool CYIVideojsVideoPlayer::IsAutomaticResolutionCapEnabled() const
+{
+    return m_pPriv->IsAutomaticResolutionCapEnabled();
+}
+
+std::vector<CYIVideojsVideoPlayer::VideoRendition> CYIVideojsVideoPlayer::GetVideoRenditions() const
+{
+    return m_pPriv->GetVideoRenditions();
+}
+
+bool CYIVideojsVideoPlayer::SelectRendition(uint32_t id)
+{
+    return m_pPriv->SelectRendition(id);
+}
+
+void CYIVideojsVideoPlayer::SelectAutomaticRendition()
+{
+    m_pPriv->SelectAutomaticRendition();
+}
+
+bool CYIVideojsVideoPlayer::IsAutomaticRenditionSelectionEnabled() const
+{
+    return m_pPriv->IsAutomaticRenditionSelectionEnabled();
+}
+
+void CYIVideojsVideoPlayer::SetABRController(std::unique_ptr<CYIVideojsABRController> pABRController)
+{
+    m_pPriv->SetABRController(std::move(pABRController));
+}
+
+CYIVideojsABRController *CYIVideojsVideoPlayer::GetABRController() const
+{
+    return m_pPriv->GetABRController();
+}
+
+void CYIVideojsVideoPlayer::SetCompactEventEncodingEnabled(bool enabled)
+{
+    m_pPriv->SetCompactEventEncodingEnabled(enabled);
+}
+
+bool CYIVideojsVideoPlayer::IsCompactEventEncodingActive() const
+{
+    return m_pPriv->IsCompactEventEncodingActive();
+}
+
+CYIVideojsVideoPlayer::EventEncodingStatistics CYIVideojsVideoPlayer::GetEventEncodingStatistics() const
+{
+    return m_pPriv->GetEventEncodingStatistics();
+}
+
+void CYIVideojsVideoPlayer::SetTimeUpdateIntervalMs(uint32_t intervalMs)
+{
+    m_pPriv->SetTimeUpdateIntervalMs(intervalMs);
+}
+
+uint32_t CYIVideojsVideoPlayer::GetTimeUpdateIntervalMs() const
+{
+    return m_pPriv->GetTimeUpdateIntervalMs();
+}
+
+std::map<CYIString, CYIVideojsVideoPlayer::BridgeLatencyHistogram> CYIVideojsVideoPlayer::GetBridgeLatencyHistograms() const
+{
+    return m_pPriv->GetBridgeLatencyHistograms();
+}
+
+void CYIVideojsVideoPlayer::ResetBridgeLatencyHistograms()
+{
+    m_pPriv->ResetBridgeLatencyHistograms();
+}
+
+void CYIVideojsVideoPlayer::SetBridgeLatencyLogIntervalMs(uint32_t intervalMs)
+{
+    m_pPriv->SetBridgeLatencyLogIntervalMs(intervalMs);
+}
+
+void CYIVideojsVideoPlayer::LogBridgeLatencyHistograms() const
+{
+    m_pPriv->LogBridgeLatencyHistograms();
+}
+
+CYIVideojsVideoPlayer::DocumentPoolStatistics CYIVideojsVideoPlayer::GetDocumentPoolStatistics() const
+{
+    return m_pPriv->GetDocumentPoolStatistics();
+}
+
+void CYIVideojsVideoPlayer::ResetDocumentPoolStatistics()
+{
+    m_pPriv->ResetDocumentPoolStatistics();
+}
+
+bool CYIVideojsVideoPlayer::StartBridgeRecording(const CYIString &filePath)
+{
+    std::unique_ptr<CYIVideojsBridgeRecorder> pBridgeRecorder(new CYIVideojsBridgeRecorder());
+
+    if (!pBridgeRecorder->Open(filePath))
+    {
+        return false;
+    }
+
+    s_pBridgeRecorder = std::move(pBridgeRecorder);
+
+    return true;
+}
+
+void CYIVideojsVideoPlayer::StopBridgeRecording()
+{
+    s_pBridgeRecorder.reset();
+}
+
+bool CYIVideojsVideoPlayer::IsBridgeRecording()
+{
+    return s_pBridgeRecorder != nullptr;
+}
+
+int32_t CYIVideojsVideoPlayer::GetInstanceId() const
+{
+    return m_pPriv->GetInstanceId();
+}
+
 void CYIVideojsVideoPlayer::SetMaxBitrate_(uint64_t maxBitrate)
 {
-    YI_UNUSED(maxBitrate);
-    // NOTE: Some MSE/EME video players require the bitrate to be set prior to loading content, so the max bitrate is instead set during prepare
+    m_pPriv->SetMaxBitrate(maxBitrate);
 }
 
 CYIAbstractVideoPlayer::TimedMetadataInterface *CYIVideojsVideoPlayer::GetTimedMetadataInterface_() const
 {
     return m_pPriv->GetTimedMetadataInterface();
 }
+
+CYIAbstractVideoPlayer::BufferingInterface *CYIVideojsVideoPlayer::GetBufferingInterface_() const
+{
+    return m_pPriv->GetBufferingInterface();
+}
@@ -12,6 +12,12 @@
 
 #include <utility/YiRapidJSONUtility.h>
 
+#include <array>
+#include <map>
+#include <memory>
+#include <vector>
+
+class CYIVideojsABRController;
 class CYIVideojsVideoPlayerPriv;
 
 /*!
@@ -22,9 +28,130 @@ class CYIVideojsVideoPlayerPriv;
 */
 class CYIVideojsVideoPlayer : public CYIAbstractVideoPlayer
 {
+    friend class CYIVideojsVideoPlayerBenchmark;
     friend class CYIVideojsVideoPlayerPriv;
+    friend class CYIVideojsVideoPlayerTest;
 
 public:
+    /*!
+        \details Timing and cancellation counters for asynchronous Prepare calls. Latencies are measured from the
+        Prepare call until the player reports that the media is ready.
+    */
+    struct PrepareStatistics
+    {
+        uint64_t preparesStarted = 0;
+        uint64_t preparesCompleted = 0;
+        uint64_t preparesCancelled = 0;
+        uint64_t lastPrepareLatencyMs = 0;
+        uint64_t maximumPrepareLatencyMs = 0;
+    };
+
+    /*!
+        \details Seek coalescing counters. At most one seek is sent to the web view at a time, and targets requested
+        while it is in flight replace each other so that only the latest one is sent next. Latencies are measured from
+        sending the final seek until the web view has completed it and is no longer buffering.
+    */
+    struct SeekStatistics
+    {
+        uint64_t seeksRequested = 0;
+        uint64_t seeksSent = 0;
+        uint64_t seeksSuperseded = 0;
+        uint64_t seeksCompleted = 0;
+        uint64_t seeksTimedOut = 0;
+        uint64_t lastSeekLatencyMs = 0;
+        uint64_t maximumSeekLatencyMs = 0;
+    };
+
+    /*!
+        \details Counters describing how transport commands have been grouped into batched web messaging bridge calls.
+        The number of round trips saved is \a commandsBatched minus \a batchesSent.
+    */
+    struct CommandBatchStatistics
+    {
+        uint64_t batchesSent = 0;
+        uint64_t commandsBatched = 0;
+        uint64_t endOfFrameFlushes = 0;
+        uint64_t barrierFlushes = 0;
+        uint32_t largestBatchSize = 0;
+    };
+
+    /*!
+        \details Send-to-response latencies of a single web view function, in log-scale buckets. Bucket 0 counts
+        responses that arrived in under 1 ms, bucket i counts responses in [2^(i-1), 2^i) ms and the last bucket
+        counts everything slower. Timeouts are counted separately and are not part of the buckets.
+
+        \note Asynchronous responses are only collected when the pending command poll timer fires, every 8 ms, so
+        their recorded latencies can be up to 8 ms higher than the actual round trip.
+    */
+    struct BridgeLatencyHistogram
+    {
+        static const size_t BUCKET_COUNT = 16;
+
+        std::array<uint64_t, BUCKET_COUNT> buckets = {};
+        uint64_t responses = 0;
+        uint64_t errors = 0;
+        uint64_t timeouts = 0;
+        uint64_t maximumLatencyMs = 0;
+
+        void Record(uint64_t latencyMs);
+
+        /*!
+            \details Returns the exclusive upper bound in milliseconds of the bucket containing the given \a percentile,
+            in the range 0 to 100, of the recorded responses. The histogram does not keep individual latencies, so the
+            actual percentile lies somewhere between half of the returned value and the returned value. For the last,
+            open ended bucket the slowest recorded latency is returned instead.
+        */
+        uint64_t GetPercentileMs(float percentile) const;
+    };
+
+    /*!
+        \details Counters for the videoTimeChanged and bitrateChanged events, split by wire format. Payload sizes are
+        sampled periodically from the full serialized event, while decode times are averaged over every event.
+    */
+    struct EventEncodingStatistics
+    {
+        uint64_t compactEventsDecoded = 0;
+        uint64_t verboseEventsDecoded = 0;
+        double averageCompactEventBytes = 0;
+        double averageVerboseEventBytes = 0;
+        double averageCompactDecodeTimeUs = 0;
+        double averageVerboseDecodeTimeUs = 0;
+    };
+
+    /*!
+        \details Occupancy of the per-player pool of pre-sized RapidJSON buffers that outgoing commands are built in and
+        that the results of synchronous queries are copied into. A lease is held until the web messaging bridge has
+        serialized the command and the buffer is reset, not freed, when it is returned. Responses and events are parsed
+        by the web messaging bridge into its own documents and are not pooled. Exhausted leases fell back to a heap allocated document because every slot was in use, and
+        chunk overflows count documents that outgrew their slot buffer and had to allocate an extra chunk.
+    */
+    struct DocumentPoolStatistics
+    {
+        uint32_t slotCount = 0;
+        uint32_t slotsInUse = 0;
+        uint32_t highWaterSlotsInUse = 0;
+        size_t slotSizeBytes = 0;
+        size_t highWaterBytesUsed = 0;
+        uint64_t leases = 0;
+        uint64_t exhaustedLeases = 0;
+        uint64_t chunkOverflows = 0;
+    };
+
+    /*!
+        \details Describes one video rendition of the current adaptive source. The \a id is the rendition's position in
+        the ladder sorted by ascending bitrate and is only valid until another source is prepared. Attributes that the
+        manifest does not declare are left at 0 or empty.
+    */
+    struct VideoRendition
+    {
+        uint32_t id = 0;
+        uint64_t bitrateKbps = 0;
+        int32_t width = 0;
+        int32_t height = 0;
+        float frameRate = 0.0f;
+        CYIString codecs;
+    };
+
     /*!
         \details Constructs an instance of the CYIVideojsVideoPlayer.
 
@@ -41,6 +168,12 @@ public:
 
     virtual ~CYIVideojsVideoPlayer();
 
+    /*!
+        \details Returns the identifier of the JavaScript player instance backing this player. Each CYIVideojsVideoPlayer
+        owns its own Video.js instance in the web view, so several players can be created and prepared side by side.
+    */
+    int32_t GetInstanceId() const;
+
     /*!
         \details Returns the nickname assigned to the current player instance, if any.
     */
@@ -63,6 +196,250 @@ public:
     */
     virtual void AddExternalTextTrack(const CYIString &url, const CYIString &language, const CYIString &label, const CYIString &type, const CYIString &format, bool enable = false);
 
+    /*!
+        \details Enables or disables asynchronous dispatch of transport commands (Play, Pause, Stop, Seek, Mute,
+        SelectAudioTrack, SelectClosedCaptionsTrack and SetNickname). When enabled, these commands return as soon as
+        the message has been posted to the web view and their responses are resolved later on the main thread. Each
+        response is collected as soon as it arrives, so a slow command does not delay the completion of later ones.
+        Failures reported by the web view and commands that time out are logged, and are not raised through the
+        ErrorOccurred signal since the playback itself is unaffected.
+
+        \note While asynchronous commands are enabled, SelectAudioTrack and SelectClosedCaptionsTrack optimistically
+        return true since the web view has not answered yet. If the web view rejects the track or fails to answer, the
+        failure is only logged and the active track is left unchanged.
+
+        \note Asynchronous commands are disabled by default.
+    */
+    void SetAsynchronousCommandsEnabled(bool enabled);
+
+    /*!
+        \details Returns true if transport commands are currently dispatched asynchronously.
+    */
+    bool AreAsynchronousCommandsEnabled() const;
+
+    /*!
+        \details Enables or disables per-frame batching of asynchronous transport commands. While enabled, commands
+        issued during a single update tick are queued and sent to the web view as one message at the end of the frame.
+        Any synchronous call made to the player flushes the queued commands first so that ordering is preserved.
+
+        Queued commands are written into a JSON string buffer that is reused from one batch to the next, so issuing them
+        does not allocate once the first batch has sized the buffer. Sending a batch still allocates for its pending
+        response and completion, and the web view answers with a response that the bridge parses into a new document.
+
+        \note Batching only applies while asynchronous commands are enabled and is disabled by default.
+    */
+    void SetCommandBatchingEnabled(bool enabled);
+
+    /*!
+        \details Returns true if asynchronous transport commands are currently batched per frame.
+    */
+    bool IsCommandBatchingEnabled() const;
+
+    /*!
+        \details Returns the batch size and flush counters accumulated since the player was created.
+    */
+    CommandBatchStatistics GetCommandBatchStatistics() const;
+
+    /*!
+        \details The mute status, text track status, active audio and text tracks and the nickname are mirrored locally
+        and kept up to date by events and command acknowledgements from the web view, so their getters never block.
+        When \a enabled, each of these getters additionally queries the web view and logs a warning if the mirrored
+        value has drifted from the actual value.
+
+        \note This is intended for debugging only, since it re-introduces a blocking round trip into every getter.
+    */
+    void SetStateMirrorValidationEnabled(bool enabled);
+
+    /*!
+        \details Returns true if the locally mirrored player state is being validated against the web view.
+    */
+    bool IsStateMirrorValidationEnabled() const;
+
+    /*!
+        \details Returns the Prepare-to-Ready latency and cancellation counters accumulated since the player was created.
+
+        \note Prepare does not block, it completes through the player state events. A newer Prepare or Stop cancels
+        any outstanding Prepare so that a stale load is never reported as ready.
+    */
+    PrepareStatistics GetPrepareStatistics() const;
+
+    /*!
+        \details Returns the seek coalescing counters and the seek-to-playing latencies accumulated since the player was
+        created.
+    */
+    SeekStatistics GetSeekStatistics() const;
+
+    /*!
+        \details Returns the position closest to \a positionMs that can be seeked to without leaving the media. For live
+        streams this is the nearest position inside the DVR window pushed by the web view, for on-demand media the position
+        is clamped to the duration. Seeks on live streams are moved to this position automatically.
+    */
+    uint64_t GetNearestSeekablePositionMs(uint64_t positionMs) const;
+
+    /*!
+        \details Returns the end of the latest seekable range of a live stream, or 0 for on-demand media or before the
+        web view has reported its DVR window.
+    */
+    uint64_t GetLiveEdgeMs() const;
+
+    /*!
+        \details Limits adaptive streaming to renditions whose width and height fit within \a maxResolution. A component
+        of 0 leaves that dimension unlimited. The lowest rendition is always kept so that playback continues when none fit.
+        Changes apply to a running stream from the next segment onwards, without flushing the buffer.
+    */
+    void SetMaxResolution(const glm::ivec2 &maxResolution);
+
+    /*!
+        \details Returns the resolution cap set with SetMaxResolution.
+    */
+    glm::ivec2 GetMaxResolution() const;
+
+    /*!
+        \details When \a enabled, the size of the video rectangle the player draws into further limits streaming to
+        renditions that fit on screen, so a player shown in a mini view or picture-in-picture window only downloads and
+        decodes a rendition of roughly that size. The rectangle is converted to device pixels and rounded up to the
+        smallest rendition that covers it, so the cap only changes when the rectangle crosses a rendition. The tighter of
+        this and the SetMaxResolution cap is applied.
+
+        \note The automatic resolution cap is disabled by default.
+    */
+    void SetAutomaticResolutionCapEnabled(bool enabled);
+
+    /*!
+        \details Returns true if the video rectangle size limits the streamed renditions.
+    */
+    bool IsAutomaticResolutionCapEnabled() const;
+
+    /*!
+        \details Returns the video renditions of the current source. The ladder is pushed by the web view when the
+        manifest loads and cached, so this never blocks. It is empty before the manifest has loaded and for sources that
+        are not adaptive.
+    */
+    std::vector<VideoRendition> GetVideoRenditions() const;
+
+    /*!
+        \details Pins playback to the rendition with the given \a id, disabling adaptive selection as well as the bitrate
+        and resolution caps. The switch happens at the next segment without flushing the buffer. Returns false if \a id is
+        not part of the current ladder.
+
+        \note Preparing a new source returns the player to automatic rendition selection.
+    */
+    bool SelectRendition(uint32_t id);
+
+    /*!
+        \details Returns to adaptive rendition selection within the bitrate and resolution caps.
+    */
+    void SelectAutomaticRendition();
+
+    /*!
+        \details Returns true if renditions are selected adaptively, or false if SelectRendition has pinned one.
+    */
+    bool IsAutomaticRenditionSelectionEnabled() const;
+
+    /*!
+        \details Hands adaptive rendition selection over to \a pABRController. The web view then reports every downloaded
+        segment to the controller and fetches the following segments from the rendition it answers with. Passing null
+        returns selection to the Video.js streaming engine.
+
+        \note The controller is called on the main thread and can be set before or after Init.
+    */
+    void SetABRController(std::unique_ptr<CYIVideojsABRController> pABRController);
+
+    /*!
+        \details Returns the installed ABR controller, or null if the Video.js streaming engine selects renditions.
+    */
+    CYIVideojsABRController *GetABRController() const;
+
+    /*!
+        \details Requests that the web view send the high frequency videoTimeChanged and bitrateChanged events as
+        versioned positional arrays rather than named attribute objects. The encoding is negotiated when the player is
+        initialized, so this must be called before Init. If the web view does not support the requested version, the
+        verbose encoding is used instead.
+
+        \note Compact event encoding is disabled by default.
+    */
+    void SetCompactEventEncodingEnabled(bool enabled);
+
+    /*!
+        \details Returns true if the web view agreed to send compact events during initialization.
+    */
+    bool IsCompactEventEncodingActive() const;
+
+    /*!
+        \details Returns the event counts, sampled payload sizes and decode times accumulated for each event encoding
+        since the player was created.
+    */
+    EventEncodingStatistics GetEventEncodingStatistics() const;
+
+    /*!
+        \details Sets the minimum interval in milliseconds between the playback time updates sent by the web view. Between
+        updates, GetCurrentTimeMs advances the last reported time using a monotonic clock while the player is playing,
+        so the reported time stays smooth even at low update rates. A value of 0 sends every update the Video.js player
+        raises, which is roughly every 250 milliseconds.
+
+        \note Seeking, pausing and buffering still send an update immediately regardless of the interval.
+    */
+    void SetTimeUpdateIntervalMs(uint32_t intervalMs);
+
+    /*!
+        \details Returns the minimum interval in milliseconds between playback time updates sent by the web view.
+    */
+    uint32_t GetTimeUpdateIntervalMs() const;
+
+    /*!
+        \details Returns a snapshot of the send-to-response latency histogram of every web view function called by this
+        player, keyed by the JavaScript function name (for example \"prepare\", \"seek\" or \"setVideoRectangle\").
+        Both synchronous and asynchronous calls are recorded. Batched commands are recorded once each, under their
+        function name followed by \"(batched)\", from the time they were queued. The executeBatch call that carried them
+        is only recorded when the batch as a whole failed or timed out.
+    */
+    std::map<CYIString, BridgeLatencyHistogram> GetBridgeLatencyHistograms() const;
+
+    /*!
+        \details Clears every bridge latency histogram.
+    */
+    void ResetBridgeLatencyHistograms();
+
+    /*!
+        \details Periodically writes the p50 and p99 latency, maximum latency, error and timeout counts of every web view
+        function to the log every \a intervalMs milliseconds. A value of 0 disables the periodic log output.
+
+        \note Periodic latency logging is disabled by default.
+    */
+    void SetBridgeLatencyLogIntervalMs(uint32_t intervalMs);
+
+    /*!
+        \details Writes the current bridge latency histograms to the log.
+    */
+    void LogBridgeLatencyHistograms() const;
+
+    /*!
+        \details Returns the occupancy and high-water marks of the RapidJSON buffer pool used to build web view commands.
+    */
+    DocumentPoolStatistics GetDocumentPoolStatistics() const;
+
+    /*!
+        \details Clears the document pool counters and high-water marks. Slots that are currently leased remain counted.
+    */
+    void ResetDocumentPoolStatistics();
+
+    /*!
+        \details Starts appending every web view function call, call response and player event of all CYIVideojsVideoPlayer
+        instances to \a filePath as timestamped JSON lines. The recording can later be fed back through the player event
+        handlers with CYIVideojsBridgeReplayer. Returns false if the file could not be opened.
+    */
+    static bool StartBridgeRecording(const CYIString &filePath);
+
+    /*!
+        \details Stops the active bridge recording, if any, and closes the recording file.
+    */
+    static void StopBridgeRecording();
+
+    /*!
+        \details Returns true if bridge traffic is currently being recorded.
+    */
+    static bool IsBridgeRecording();
+
 private:
     CYIVideojsVideoPlayer() = default;
     virtual void Init_() override;
@@ -92,6 +469,7 @@ private:
     virtual ClosedCaptionsTrackInfo GetActiveClosedCaptionsTrack_() const override;
     virtual void SetMaxBitrate_(uint64_t maxBitrate) override;
     virtual CYIAbstractVideoPlayer::TimedMetadataInterface *GetTimedMetadataInterface_() const override;
+    virtual CYIAbstractVideoPlayer::BufferingInterface *GetBufferingInterface_() const override;
 
     CYIVideojsVideoPlayerPriv *m_pPriv;
 
@@ -0,0 +1,184 @@
+#include "YiVideojsVideoPlayerPool.h"
+
+#include <player/YiVideoSurfaceView.h>
+
+#define LOG_TAG "CYIVideojsVideoPlayerPool"
+
+CYIVideojsVideoPlayerPool::CYIVideojsVideoPlayerPool(CYIVideoSurfaceView *pSurfaceView, size_t standbyPlayerCount)
+    : m_pSurfaceView(pSurfaceView)
+    , m_players(standbyPlayerCount + 1)
+    , m_activePlayerIndex(0)
+    , m_zapInProgress(false)
+    , m_warmZap(false)
+    , m_lastZapTimeMs(0)
+{
+}
+
+CYIVideojsVideoPlayerPool::~CYIVideojsVideoPlayerPool()
+{
+    if (m_pSurfaceView)
+    {
+        m_pSurfaceView->SetVideoSurface(nullptr);
+    }
+
+    m_players.clear();
+}
+
+bool CYIVideojsVideoPlayerPool::Init()
+{
+    for (size_t i = 0; i < m_players.size(); ++i)
+    {
+        PooledPlayer &pooledPlayer = m_players[i];
+
+        pooledPlayer.pPlayer.reset(CYIVideojsVideoPlayer::Create());
+
+        if (!pooledPlayer.pPlayer)
+        {
+            YI_LOGE(LOG_TAG, "Init failed to create player %zu of %zu.", i + 1, m_players.size());
+
+            for (PooledPlayer &createdPlayer : m_players)
+            {
+                createdPlayer.pPlayer.reset();
+            }
+
+            return false;
+        }
+
+        pooledPlayer.pPlayer->SetAsynchronousCommandsEnabled(true);
+        pooledPlayer.pPlayer->Init();
+        pooledPlayer.pPlayer->SetNickname(i == m_activePlayerIndex ? "Active" : "Standby " + CYIString::FromValue(i));
+        pooledPlayer.pPlayer->Playing.Connect(*this, &CYIVideojsVideoPlayerPool::OnPlayerPlaying);
+
+        if (i != m_activePlayerIndex)
+        {
+            pooledPlayer.pPlayer->Mute(true);
+        }
+    }
+
+    if (m_pSurfaceView)
+    {
+        m_pSurfaceView->SetVideoSurface(GetActivePlayer()->GetSurface());
+    }
+
+    return true;
+}
+
+CYIVideojsVideoPlayer *CYIVideojsVideoPlayerPool::GetActivePlayer() const
+{
+    return m_players[m_activePlayerIndex].pPlayer.get();
+}
+
+bool CYIVideojsVideoPlayerPool::PrepareStandby(const CYIUrl &videoURI, CYIAbstractVideoPlayer::StreamingFormat format)
+{
+    CYIString url(videoURI.ToString());
+    PooledPlayer *pStandbyPlayer = nullptr;
+
+    for (size_t i = 0; i < m_players.size(); ++i)
+    {
+        if (i == m_activePlayerIndex)
+        {
+            continue;
+        }
+
+        PooledPlayer &pooledPlayer = m_players[i];
+
+        if (pooledPlayer.preparedUrl == url)
+        {
+            return true;
+        }
+
+        // prefer an idle player, otherwise recycle the one that was prepared the longest time ago
+        if (!pStandbyPlayer || (!pStandbyPlayer->preparedUrl.IsEmpty() && (pooledPlayer.preparedUrl.IsEmpty() || pooledPlayer.preparedTime < pStandbyPlayer->preparedTime)))
+        {
+            pStandbyPlayer = &pooledPlayer;
+        }
+    }
+
+    if (!pStandbyPlayer || !pStandbyPlayer->pPlayer)
+    {
+        YI_LOGW(LOG_TAG, "PrepareStandby has no standby player available for %s.", url.GetData());
+        return false;
+    }
+
+    if (!pStandbyPlayer->preparedUrl.IsEmpty())
+    {
+        pStandbyPlayer->pPlayer->Stop();
+    }
+
+    pStandbyPlayer->preparedUrl = url;
+    pStandbyPlayer->preparedTime = std::chrono::steady_clock::now();
+    pStandbyPlayer->pPlayer->Mute(true);
+    pStandbyPlayer->pPlayer->Prepare(videoURI, format, CYIAbstractVideoPlayer::PlaybackState::Paused);
+
+    return true;
+}
+
+CYIVideojsVideoPlayer *CYIVideojsVideoPlayerPool::Zap(const CYIUrl &videoURI, CYIAbstractVideoPlayer::StreamingFormat format)
+{
+    CYIString url(videoURI.ToString());
+
+    m_zapStartTime = std::chrono::steady_clock::now();
+    m_zapInProgress = true;
+    m_warmZap = false;
+
+    for (size_t i = 0; i < m_players.size(); ++i)
+    {
+        if (i == m_activePlayerIndex || m_players[i].preparedUrl != url)
+        {
+            continue;
+        }
+
+        PooledPlayer &previousPlayer = m_players[m_activePlayerIndex];
+        PooledPlayer &nextPlayer = m_players[i];
+
+        m_activePlayerIndex = i;
+        m_warmZap = true;
+
+        // attaching the standby surface detaches the previous one, which hides its video element in the web view
+        if (m_pSurfaceView)
+        {
+            m_pSurfaceView->SetVideoSurface(nextPlayer.pPlayer->GetSurface());
+        }
+
+        nextPlayer.pPlayer->Mute(false);
+        nextPlayer.pPlayer->Play();
+
+        previousPlayer.pPlayer->Mute(true);
+        previousPlayer.pPlayer->Stop();
+        previousPlayer.preparedUrl.Clear();
+
+        ActivePlayerChanged.Emit(nextPlayer.pPlayer.get());
+
+        return nextPlayer.pPlayer.get();
+    }
+
+    PooledPlayer &activePlayer = m_players[m_activePlayerIndex];
+
+    activePlayer.pPlayer->Stop();
+    activePlayer.preparedUrl = url;
+    activePlayer.preparedTime = m_zapStartTime;
+    activePlayer.pPlayer->Prepare(videoURI, format, CYIAbstractVideoPlayer::PlaybackState::Playing);
+
+    return activePlayer.pPlayer.get();
+}
+
+uint64_t CYIVideojsVideoPlayerPool::GetLastZapTimeMs() const
+{
+    return m_lastZapTimeMs;
+}
+
+void CYIVideojsVideoPlayerPool::OnPlayerPlaying()
+{
+    // standby players are never played, so the only player that can report playing during a zap is the active one
+    if (!m_zapInProgress)
+    {
+        return;
+    }
+
+    m_zapInProgress = false;
+    m_lastZapTimeMs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_zapStartTime).count());
+
+    YI_LOGI(LOG_TAG, "%s zap completed in %llu ms.", m_warmZap ? "Warm" : "Cold", static_cast<unsigned long long>(m_lastZapTimeMs));
+
+    ZapCompleted.Emit(m_lastZapTimeMs, m_warmZap);
+}
@@ -0,0 +1,108 @@
+// © You i Labs Inc. 2000-2019. All rights reserved.
+
+#ifndef _YI_VIDEOJS_VIDEO_PLAYER_POOL_H_
+#define _YI_VIDEOJS_VIDEO_PLAYER_POOL_H_
+
+/*!
+ \addtogroup video-player
+ @{
+ */
+
+#include "YiVideojsVideoPlayer.h"
+
+#include <signal/YiSignalHandler.h>
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+class CYIVideoSurfaceView;
+
+/*!
+    \brief Maintains a set of CYIVideojsVideoPlayer instances so that channels can be changed without tearing down and
+    rebuilding the media pipeline.
+
+    One player is active and attached to the supplied CYIVideoSurfaceView. The remaining standby players can be
+    pre-prepared, muted and hidden, with the channels the user is most likely to switch to next. Zapping to a channel
+    that is already prepared on a standby player only swaps which player is attached to the surface view and starts
+    playback, while zapping to any other channel falls back to preparing it on the active player.
+
+    \note Only Tizen NaCl is currently supported.
+*/
+class CYIVideojsVideoPlayerPool : public CYISignalHandler
+{
+public:
+    /*!
+        \details Constructs a pool with one active player and \a standbyPlayerCount standby players that will be
+        presented through \a pSurfaceView.
+    */
+    CYIVideojsVideoPlayerPool(CYIVideoSurfaceView *pSurfaceView, size_t standbyPlayerCount);
+
+    virtual ~CYIVideojsVideoPlayerPool();
+
+    /*!
+        \details Creates and initializes every player in the pool and attaches the active player to the surface view.
+        Returns false if a player could not be created, in which case the pool is left without players and must not be
+        used.
+    */
+    bool Init();
+
+    /*!
+        \details Returns the player that is currently attached to the surface view.
+    */
+    CYIVideojsVideoPlayer *GetActivePlayer() const;
+
+    /*!
+        \details Prepares \a videoURI on a standby player, muted and hidden, so that a later call to Zap with the same
+        URI can start playback immediately. If every standby player is already in use, the one that was prepared the
+        longest time ago is reused. Returns false if the pool has no standby players.
+    */
+    bool PrepareStandby(const CYIUrl &videoURI, CYIAbstractVideoPlayer::StreamingFormat format);
+
+    /*!
+        \details Switches playback to \a videoURI and returns the player that is now active. The previously active
+        player is stopped and returned to the standby set.
+    */
+    CYIVideojsVideoPlayer *Zap(const CYIUrl &videoURI, CYIAbstractVideoPlayer::StreamingFormat format);
+
+    /*!
+        \details Returns the time in milliseconds between the most recent call to Zap and the active player reporting
+        that it is playing, or 0 if no zap has completed yet.
+    */
+    uint64_t GetLastZapTimeMs() const;
+
+    /*!
+        \details Emitted when a zap changes which player is attached to the surface view.
+    */
+    CYISignal<CYIVideojsVideoPlayer *> ActivePlayerChanged;
+
+    /*!
+        \details Emitted when the active player starts playing after a zap, with the zap time in milliseconds and
+        whether the zap was served by a prepared standby player.
+    */
+    CYISignal<uint64_t, bool> ZapCompleted;
+
+private:
+    struct PooledPlayer
+    {
+        std::unique_ptr<CYIVideojsVideoPlayer> pPlayer;
+        CYIString preparedUrl;
+        std::chrono::steady_clock::time_point preparedTime;
+    };
+
+    void OnPlayerPlaying();
+
+    CYIVideoSurfaceView *m_pSurfaceView;
+    std::vector<PooledPlayer> m_players;
+    size_t m_activePlayerIndex;
+    bool m_zapInProgress;
+    bool m_warmZap;
+    std::chrono::steady_clock::time_point m_zapStartTime;
+    uint64_t m_lastZapTimeMs;
+};
+
+/*!
+ @}
+ */
+
+#endif // _YI_VIDEOJS_VIDEO_PLAYER_POOL_H_
@@ -1,23 +1,47 @@
 #ifndef _YI_VIDEOJS_VIDEO_PLAYER_PRIV_H_
 #define _YI_VIDEOJS_VIDEO_PLAYER_PRIV_H_
 
-#include "player/YiVideojsVideoPlayer.h"
-#include "player/YiVideojsVideoSurface.h"
+#include "YiVideojsABRController.h"
+#include "YiVideojsBridgeTransport.h"
+#include "YiVideojsDocumentPool.h"
+#include "YiVideojsSeekableRangeIndex.h"
+#include "YiVideojsVideoPlayer.h"
+#include "YiVideojsVideoSurface.h"
 
 #include <platform/YiWebMessagingBridge.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
 #include <utility/YiRapidJSONUtility.h>
+#include <utility/YiTimer.h>
+
+#include <bitset>
+#include <chrono>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 class CYIVideojsVideoPlayer;
 
 class CYIVideojsVideoPlayerPriv : public CYISignalHandler,
-                                  public CYIAbstractVideoPlayer::TimedMetadataInterface
+                                  public CYIAbstractVideoPlayer::TimedMetadataInterface,
+                                  public CYIAbstractVideoPlayer::BufferingInterface
 {
+    friend class CYIVideojsBridgeReplayer;
+    friend class CYIVideojsVideoPlayerBenchmark;
+    friend class CYIVideojsVideoPlayerTest;
+
 public:
     CYIVideojsVideoPlayerPriv(CYIVideojsVideoPlayer *pPub);
     CYIVideojsVideoPlayerPriv(CYIVideojsVideoPlayer *pPub, yi::rapidjson::Document &&playerConfiguration);
     virtual ~CYIVideojsVideoPlayerPriv();
 
     void SetVideoRectangle(const YI_RECT_REL &videoRectangle);
+    void SetSurfaceAttached(bool attached);
+    int32_t GetInstanceId() const;
     void Init();
     CYIString GetName() const;
     CYIString GetNickname() const;
@@ -46,13 +70,56 @@ public:
     CYIAbstractVideoPlayer::ClosedCaptionsTrackInfo GetActiveTextTrack() const;
     void AddExternalTextTrack(const CYIString &url, const CYIString &language, const CYIString &label, const CYIString &type, const CYIString &format, bool enable);
     CYIAbstractVideoPlayer::TimedMetadataInterface *GetTimedMetadataInterface() const;
+    CYIAbstractVideoPlayer::BufferingInterface *GetBufferingInterface() const;
+    virtual void SetBufferLength(const CYIAbstractVideoPlayer::BufferLength &bufferLength) override;
+    virtual CYIAbstractVideoPlayer::BufferLength GetBufferLength() override;
+    void SetAsynchronousCommandsEnabled(bool enabled);
+    bool AreAsynchronousCommandsEnabled() const;
+    void SetCommandBatchingEnabled(bool enabled);
+    bool IsCommandBatchingEnabled() const;
+    CYIVideojsVideoPlayer::CommandBatchStatistics GetCommandBatchStatistics() const;
+    void SetStateMirrorValidationEnabled(bool enabled);
+    bool IsStateMirrorValidationEnabled() const;
+    CYIVideojsVideoPlayer::PrepareStatistics GetPrepareStatistics() const;
+    CYIVideojsVideoPlayer::SeekStatistics GetSeekStatistics() const;
+    std::vector<CYIAbstractVideoPlayer::SeekableRange> GetLiveSeekableRanges() const;
+    uint64_t GetNearestSeekablePositionMs(uint64_t positionMs) const;
+    uint64_t GetLiveEdgeMs() const;
+    void SetCompactEventEncodingEnabled(bool enabled);
+    bool IsCompactEventEncodingActive() const;
+    CYIVideojsVideoPlayer::EventEncodingStatistics GetEventEncodingStatistics() const;
+    void SetTimeUpdateIntervalMs(uint32_t intervalMs);
+    void SetMaxBitrate(uint64_t maxBitrate);
+    void SetMaxResolution(const glm::ivec2 &maxResolution);
+    glm::ivec2 GetMaxResolution() const;
+    void SetAutomaticResolutionCapEnabled(bool enabled);
+    bool IsAutomaticResolutionCapEnabled() const;
+    std::vector<CYIVideojsVideoPlayer::VideoRendition> GetVideoRenditions() const;
+    bool SelectRendition(uint32_t id);
+    void SelectAutomaticRendition();
+    bool IsAutomaticRenditionSelectionEnabled() const;
+    void SetABRController(std::unique_ptr<CYIVideojsABRController> pABRController);
+    CYIVideojsABRController *GetABRController() const;
+    uint32_t GetTimeUpdateIntervalMs() const;
+    std::map<CYIString, CYIVideojsVideoPlayer::BridgeLatencyHistogram> GetBridgeLatencyHistograms() const;
+    void ResetBridgeLatencyHistograms();
+    CYIVideojsVideoPlayer::DocumentPoolStatistics GetDocumentPoolStatistics() const;
+    void ResetDocumentPoolStatistics();
+    void SetBridgeLatencyLogIntervalMs(uint32_t intervalMs);
+    void LogBridgeLatencyHistograms() const;
 
 protected:
-    CYIWebMessagingBridge::FutureResponse CallStaticPlayerFunction(yi::rapidjson::Document &&commandDocument, const CYIString &functionName, yi::rapidjson::Value &&playerFunctionArgumentsValue = yi::rapidjson::Value(yi::rapidjson::kArrayType), bool *pMessageSent = nullptr) const;
-    CYIWebMessagingBridge::FutureResponse CallPlayerInstanceFunction(yi::rapidjson::Document &&commandDocument, const CYIString &functionName, yi::rapidjson::Value &&playerFunctionArgumentsValue = yi::rapidjson::Value(yi::rapidjson::kArrayType), bool *pMessageSent = nullptr) const;
+    typedef std::function<void(const yi::rapidjson::Value &result)> CommandCompletionCallback;
+
+    CYIVideojsBridgeTransport::FutureResponse CallStaticPlayerFunction(yi::rapidjson::Document &&commandDocument, const CYIString &functionName, yi::rapidjson::Value &&playerFunctionArgumentsValue = yi::rapidjson::Value(yi::rapidjson::kArrayType), bool *pMessageSent = nullptr) const;
+    CYIVideojsBridgeTransport::FutureResponse CallPlayerInstanceFunction(yi::rapidjson::Document &&commandDocument, const CYIString &functionName, yi::rapidjson::Value &&playerFunctionArgumentsValue = yi::rapidjson::Value(yi::rapidjson::kArrayType), bool *pMessageSent = nullptr) const;
     void CreatePlayerInstance();
     void InitializePlayerInstance();
     void DestroyPlayerInstance();
+    void ProbeSupportedFormats();
+    bool QuerySupportsFormat(CYIAbstractVideoPlayer::StreamingFormat format, CYIAbstractVideoPlayer::DRMScheme drmScheme) const;
+    void DispatchCommand(const char *functionName, yi::rapidjson::Document &&commandDocument, yi::rapidjson::Value &&playerFunctionArgumentsValue, CommandCompletionCallback &&completionCallback = CommandCompletionCallback()) const;
+    void ProcessCommandResponse(const char *functionName, CYIVideojsBridgeTransport::FutureResponse &&futureResponse, CommandCompletionCallback &&completionCallback = CommandCompletionCallback(), uint32_t timeoutMs = CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS) const;
 
     static void AddDRMConfigurationToValue(CYIAbstractVideoPlayer::DRMConfiguration *pDRMConfiguration, yi::rapidjson::Value &value, yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator);
     static bool ConvertValueToTrackInfo(const yi::rapidjson::Value &trackValue, CYIAbstractVideoPlayer::TrackInfo &trackData);
@@ -69,8 +136,113 @@ private:
         Complete
     };
 
-    uint64_t RegisterEventHandler(const CYIString &eventName, CYIWebMessagingBridge::EventCallback &&eventCallback);
-    void UnregisterEventHandler(uint64_t &eventHandlerId);
+    static const size_t STREAMING_FORMAT_COUNT = 4;
+    static const size_t DRM_SCHEME_COUNT = 5;
+
+    enum class CommandBatchFlushReason
+    {
+        EndOfFrame,
+        Barrier
+    };
+
+    struct QueuedCommand
+    {
+        const char *functionName;
+        CommandCompletionCallback completionCallback;
+        std::chrono::steady_clock::time_point queuedTime;
+    };
+
+    struct PendingCommand
+    {
+        CYIString functionName;
+        CYIVideojsBridgeTransport::FutureResponse futureResponse;
+        CommandCompletionCallback completionCallback;
+        std::chrono::steady_clock::time_point sentTime;
+        uint32_t timeoutMs;
+        std::function<void()> finishedCallback;
+        std::function<bool()> cancelledCallback;
+        CYIVideojsBridgeTransport::Response response;
+        bool responseReceived = false;
+    };
+
+    struct EventEncodingCounters
+    {
+        uint64_t eventsDecoded = 0;
+        uint64_t eventsSampled = 0;
+        uint64_t sampledBytes = 0;
+        uint64_t decodeTimeNs = 0;
+    };
+
+    enum class BridgeCallOutcome
+    {
+        Response,
+        Error,
+        Timeout
+    };
+
+    struct IgnoredResult
+    {
+    };
+
+    static void AppendArgument(yi::rapidjson::Value &arguments, yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator, bool value);
+    static void AppendArgument(yi::rapidjson::Value &arguments, yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator, int32_t value);
+    static void AppendArgument(yi::rapidjson::Value &arguments, yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator, uint32_t value);
+    static void AppendArgument(yi::rapidjson::Value &arguments, yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator, int64_t value);
+    static void AppendArgument(yi::rapidjson::Value &arguments, yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator, uint64_t value);
+    static void AppendArgument(yi::rapidjson::Value &arguments, yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator, double value);
+    static void AppendArgument(yi::rapidjson::Value &arguments, yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator, const char *value);
+    static void AppendArgument(yi::rapidjson::Value &arguments, yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator, const CYIString &value);
+    static void AppendArgument(yi::rapidjson::Value &arguments, yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator, const yi::rapidjson::Value &value);
+    static void AppendArgument(yi::rapidjson::Value &arguments, yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator, yi::rapidjson::Value &&value);
+
+    template<typename... ARGUMENTS>
+    static yi::rapidjson::Value MakeArguments(yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator, ARGUMENTS &&... arguments);
+    template<typename... ARGUMENTS>
+    void DispatchPlayerCommand(const char *functionName, ARGUMENTS &&... arguments) const;
+    template<typename... ARGUMENTS>
+    void DispatchPlayerCommandWithCompletion(const char *functionName, CommandCompletionCallback &&completionCallback, ARGUMENTS &&... arguments) const;
+    template<typename... ARGUMENTS>
+    CYIVideojsBridgeTransport::FutureResponse SendPlayerFunction(const char *functionName, bool *pMessageSent, ARGUMENTS &&... arguments) const;
+    template<typename RESULT, typename... ARGUMENTS>
+    bool InvokePlayerFunction(const char *functionName, RESULT &result, ARGUMENTS &&... arguments) const;
+    template<typename RESULT, typename... ARGUMENTS>
+    bool InvokeStaticPlayerFunction(const char *functionName, RESULT &result, ARGUMENTS &&... arguments) const;
+
+    bool TakeResult(const char *functionName, CYIVideojsBridgeTransport::FutureResponse &futureResponse, bool messageSent, CYIVideojsBridgeTransport::Response &response) const;
+    static bool DecodeResult(const char *functionName, const yi::rapidjson::Value &resultValue, bool &result);
+    static bool DecodeResult(const char *functionName, const yi::rapidjson::Value &resultValue, int32_t &result);
+    static bool DecodeResult(const char *functionName, const yi::rapidjson::Value &resultValue, double &result);
+    static bool DecodeResult(const char *functionName, const yi::rapidjson::Value &resultValue, CYIString &result);
+    static bool DecodeResult(const char *functionName, const yi::rapidjson::Value &resultValue, yi::rapidjson::Document &result);
+    static bool DecodeResult(const char *functionName, const yi::rapidjson::Value &resultValue, IgnoredResult &result);
+
+    CYIVideojsBridgeTransport::Response TakeResponse(const CYIString &functionName, CYIVideojsBridgeTransport::FutureResponse &futureResponse, bool *pValueAssigned, uint32_t timeoutMs = CYIWebMessagingBridge::DEFAULT_RESPONSE_TIMEOUT_MS) const;
+    void RecordBridgeLatency(const CYIString &functionName, std::chrono::steady_clock::time_point sentTime, BridgeCallOutcome outcome) const;
+    void OnBridgeLatencyLogTimerTimedOut();
+    void CompleteCommand(const CYIString &functionName, CYIVideojsBridgeTransport::Response *pResponse, const CommandCompletionCallback &completionCallback, std::chrono::steady_clock::time_point sentTime, bool asynchronous) const;
+    void CompleteCommandWithResult(const CYIString &functionName, const CYIString &errorMessage, const yi::rapidjson::Value &result, const CommandCompletionCallback &completionCallback, std::chrono::steady_clock::time_point sentTime, bool asynchronous, bool timedOut = false) const;
+    void EnqueuePendingCommand(PendingCommand &&pendingCommand) const;
+    void OnPendingCommandTimerTimedOut();
+    void SendVideoRectangle(const YI_RECT_REL &videoRectangle);
+    void OnVideoRectangleRequestFinished();
+    void UpdateResolutionCap();
+    glm::ivec2 QuantizeResolutionCap(const glm::ivec2 &surfaceSize) const;
+    void SendExternalABREnabled();
+    void NotifyABRControllerRenditions();
+    void CancelPrepare();
+    void OnPrepareResponseTimerTimedOut();
+    void SendSeek(uint64_t seekPositionMS);
+    void CompleteSeek();
+    void CancelSeek();
+    void OnSeekTimeoutTimerTimedOut();
+    void FlushCommandBatch(CommandBatchFlushReason reason) const;
+    void OnCommandBatchResponse(const std::vector<QueuedCommand> &batchedCommands, const yi::rapidjson::Value &result) const;
+    void OnCommandBatchTimerTimedOut();
+
+    typedef void (CYIVideojsVideoPlayerPriv::*EventHandler)(const yi::rapidjson::Value &eventValue);
+
+    static const std::unordered_map<std::string, EventHandler> &GetEventHandlers();
+    static void OnPlayerEvent(const yi::rapidjson::Value &eventValue);
     void RegisterEventHandlers();
     void UnregisterEventHandlers();
     void OnBitrateChanged(const yi::rapidjson::Value &eventValue);
@@ -83,16 +255,58 @@ private:
     void OnStateChanged(const yi::rapidjson::Value &eventValue);
     void OnTextTracksChanged(const yi::rapidjson::Value &eventValue);
     void OnMetadataAvailable(const yi::rapidjson::Value &eventValue);
+    void OnMuteStatusChanged(const yi::rapidjson::Value &eventValue);
+    void OnTextTrackStatusChanged(const yi::rapidjson::Value &eventValue);
+    void OnActiveAudioTrackChanged(const yi::rapidjson::Value &eventValue);
+    void OnActiveTextTrackChanged(const yi::rapidjson::Value &eventValue);
+    void UpdateActiveTextTrack(const char *functionName, const yi::rapidjson::Value &textTrackValue);
+    void OnSeekCompleted(const yi::rapidjson::Value &eventValue);
+    void OnSeekableRangesChanged(const yi::rapidjson::Value &eventValue);
+    void OnBufferLengthChanged(const yi::rapidjson::Value &eventValue);
+    void OnRenditionsChanged(const yi::rapidjson::Value &eventValue);
+    void OnSegmentDownloaded(const yi::rapidjson::Value &eventValue);
+    bool OnAudioTrackSelected(uint32_t id, const yi::rapidjson::Value &result);
+    bool OnTextTrackSelected(uint32_t id, const yi::rapidjson::Value &result);
+
+    CYIString QueryNickname() const;
+    double QueryDevicePixelRatio() const;
+    bool QueryIsMuted() const;
+    bool QueryIsTextTrackEnabled() const;
+    CYIAbstractVideoPlayer::AudioTrackInfo QueryActiveAudioTrack() const;
+    CYIAbstractVideoPlayer::ClosedCaptionsTrackInfo QueryActiveTextTrack() const;
+
+    void AnchorPlaybackClock(uint64_t currentTimeMs);
+    void RecordEventDecoded(const yi::rapidjson::Value &eventValue, bool compact, std::chrono::steady_clock::time_point decodeStartTime);
 
     static CYIString PlayerStateToString(PlayerState state);
 
+    int32_t m_instanceId;
+    bool m_surfaceAttached;
+    bool m_initialized;
     bool m_messageHandlersRegistered;
     YI_RECT_REL m_previousVideoRectangle;
+    YI_RECT_REL m_pendingVideoRectangle;
+    bool m_videoRectangleRequestInFlight;
+    bool m_videoRectanglePending;
+    glm::ivec2 m_videoRectangleSize;
+    double m_devicePixelRatio;
+    glm::ivec2 m_maxResolution;
+    bool m_automaticResolutionCapEnabled;
+    glm::ivec2 m_sentResolutionCap;
+    std::vector<CYIVideojsVideoPlayer::VideoRendition> m_videoRenditions;
+    bool m_hasSelectedRendition;
+    std::unique_ptr<CYIVideojsABRController> m_pABRController;
+    bool m_hasSentABRRendition;
+    uint32_t m_sentABRRenditionId;
     CYIAbstractVideoPlayer::PlaybackState m_stateBeforeBuffering;
     uint64_t m_currentTimeMs;
+    std::chrono::steady_clock::time_point m_currentTimeAnchor;
+    mutable uint64_t m_lastInterpolatedTimeMs;
+    uint32_t m_timeUpdateIntervalMs;
     uint64_t m_durationMs;
     bool m_buffering;
     bool m_isLive;
+    CYIVideojsSeekableRangeIndex m_seekableRanges;
     float m_initialAudioBitrateKbps;
     float m_currentAudioBitrateKbps;
     float m_initialVideoBitrateKbps;
@@ -100,23 +314,65 @@ private:
     float m_initialTotalBitrateKbps;
     float m_currentTotalBitrateKbps;
     float m_bufferLengthMs;
+    CYIAbstractVideoPlayer::BufferLength m_requestedBufferLength;
+    CYIAbstractVideoPlayer::BufferLength m_bufferLength;
     yi::rapidjson::Document m_playerConfiguration;
 
-    uint64_t m_bitrateChangedEventHandlerId;
-    uint64_t m_bufferingStateChangedEventHandlerId;
-    uint64_t m_liveStatusEventHandlerId;
-    uint64_t m_playerErrorEventHandlerId;
-    uint64_t m_audioTracksChangedEventHandlerId;
-    uint64_t m_videoDurationChangedEventHandlerId;
-    uint64_t m_videoTimeChangedEventHandlerId;
-    uint64_t m_stateChangedEventHandlerId;
-    uint64_t m_textTracksChangedEventHandlerId;
-    uint64_t m_metadataAvailableEventHandlerId;
+    int32_t m_prepareId;
+    bool m_preparing;
+    std::chrono::steady_clock::time_point m_prepareStartTime;
+    CYIVideojsVideoPlayer::PrepareStatistics m_prepareStatistics;
+    CYIVideojsBridgeTransport::FutureResponse m_prepareFutureResponse;
+    bool m_prepareResponsePending;
+    CYITimer m_prepareResponseTimer;
+
+    bool m_seekInFlight;
+    bool m_seekPending;
+    bool m_awaitingSeekPlayback;
+    uint64_t m_pendingSeekPositionMs;
+    std::chrono::steady_clock::time_point m_seekSentTime;
+    CYITimer m_seekTimeoutTimer;
+    CYIVideojsVideoPlayer::SeekStatistics m_seekStatistics;
+
+    bool m_supportedFormatsProbed;
+    std::bitset<STREAMING_FORMAT_COUNT * DRM_SCHEME_COUNT> m_supportedFormats;
 
     std::vector<CYIAbstractVideoPlayer::AudioTrackInfo> m_audioTracks;
     std::vector<CYIAbstractVideoPlayer::ClosedCaptionsTrackInfo> m_textTracks;
 
+    bool m_muted;
+    bool m_textTrackEnabled;
+    CYIAbstractVideoPlayer::AudioTrackInfo m_activeAudioTrack;
+    CYIAbstractVideoPlayer::ClosedCaptionsTrackInfo m_activeTextTrack;
+    mutable CYIString m_nickname;
+    bool m_stateMirrorValidationEnabled;
+
+    bool m_asynchronousCommandsEnabled;
+    mutable std::list<PendingCommand> m_pendingCommands;
+    mutable CYITimer m_pendingCommandTimer;
+
+    bool m_commandBatchingEnabled;
+    mutable yi::rapidjson::StringBuffer m_commandBatchBuffer;
+    mutable yi::rapidjson::Writer<yi::rapidjson::StringBuffer> m_commandBatchWriter;
+    mutable std::vector<QueuedCommand> m_queuedCommands;
+    mutable std::vector<QueuedCommand> m_spareCommandBatch;
+    mutable CYITimer m_commandBatchTimer;
+    mutable CYIVideojsVideoPlayer::CommandBatchStatistics m_commandBatchStatistics;
+
+    bool m_compactEventEncodingRequested;
+    bool m_compactEventEncodingActive;
+    EventEncodingCounters m_compactEventCounters;
+    EventEncodingCounters m_verboseEventCounters;
+
+    mutable std::map<CYIString, CYIVideojsVideoPlayer::BridgeLatencyHistogram> m_bridgeLatencyHistograms;
+    uint32_t m_bridgeLatencyLogIntervalMs;
+    CYITimer m_bridgeLatencyLogTimer;
+
+    mutable CYIVideojsDocumentPool m_documentPool;
+
     CYIVideojsVideoPlayer *m_pPub;
 };
 
+#include "YiVideojsVideoPlayerPriv.inl"
+
 #endif // _YI_VIDEOJS_VIDEO_PLAYER_PRIV_H_
@@ -0,0 +1,77 @@
+template<typename... ARGUMENTS>
+yi::rapidjson::Value CYIVideojsVideoPlayerPriv::MakeArguments(yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator, ARGUMENTS &&... arguments)
+{
+    yi::rapidjson::Value argumentsValue(yi::rapidjson::kArrayType);
+    argumentsValue.Reserve(static_cast<yi::rapidjson::SizeType>(sizeof...(ARGUMENTS)), allocator);
+
+    int expander[] = { 0, (AppendArgument(argumentsValue, allocator, std::forward<ARGUMENTS>(arguments)), 0)... };
+    static_cast<void>(expander);
+
+    return argumentsValue;
+}
+
+template<typename... ARGUMENTS>
+void CYIVideojsVideoPlayerPriv::DispatchPlayerCommand(const char *functionName, ARGUMENTS &&... arguments) const
+{
+    DispatchPlayerCommandWithCompletion(functionName, CommandCompletionCallback(), std::forward<ARGUMENTS>(arguments)...);
+}
+
+template<typename... ARGUMENTS>
+void CYIVideojsVideoPlayerPriv::DispatchPlayerCommandWithCompletion(const char *functionName, CommandCompletionCallback &&completionCallback, ARGUMENTS &&... arguments) const
+{
+    CYIVideojsDocumentPool::Lease commandLease = m_documentPool.Acquire();
+    yi::rapidjson::Document command(yi::rapidjson::kObjectType, commandLease.GetAllocator());
+    yi::rapidjson::Value argumentsValue = MakeArguments(command.GetAllocator(), std::forward<ARGUMENTS>(arguments)...);
+
+    DispatchCommand(functionName, std::move(command), std::move(argumentsValue), std::move(completionCallback));
+}
+
+template<typename... ARGUMENTS>
+CYIVideojsBridgeTransport::FutureResponse CYIVideojsVideoPlayerPriv::SendPlayerFunction(const char *functionName, bool *pMessageSent, ARGUMENTS &&... arguments) const
+{
+    CYIVideojsDocumentPool::Lease commandLease = m_documentPool.Acquire();
+    yi::rapidjson::Document command(yi::rapidjson::kObjectType, commandLease.GetAllocator());
+    yi::rapidjson::Value argumentsValue = MakeArguments(command.GetAllocator(), std::forward<ARGUMENTS>(arguments)...);
+
+    return CallPlayerInstanceFunction(std::move(command), functionName, std::move(argumentsValue), pMessageSent);
+}
+
+template<typename RESULT, typename... ARGUMENTS>
+bool CYIVideojsVideoPlayerPriv::InvokePlayerFunction(const char *functionName, RESULT &result, ARGUMENTS &&... arguments) const
+{
+    CYIVideojsDocumentPool::Lease commandLease = m_documentPool.Acquire();
+    yi::rapidjson::Document command(yi::rapidjson::kObjectType, commandLease.GetAllocator());
+    yi::rapidjson::Value argumentsValue = MakeArguments(command.GetAllocator(), std::forward<ARGUMENTS>(arguments)...);
+
+    bool messageSent = false;
+    CYIVideojsBridgeTransport::FutureResponse futureResponse = CallPlayerInstanceFunction(std::move(command), functionName, std::move(argumentsValue), &messageSent);
+
+    CYIVideojsBridgeTransport::Response response;
+
+    if (!TakeResult(functionName, futureResponse, messageSent, response))
+    {
+        return false;
+    }
+
+    return DecodeResult(functionName, *response.GetResult(), result);
+}
+
+template<typename RESULT, typename... ARGUMENTS>
+bool CYIVideojsVideoPlayerPriv::InvokeStaticPlayerFunction(const char *functionName, RESULT &result, ARGUMENTS &&... arguments) const
+{
+    CYIVideojsDocumentPool::Lease commandLease = m_documentPool.Acquire();
+    yi::rapidjson::Document command(yi::rapidjson::kObjectType, commandLease.GetAllocator());
+    yi::rapidjson::Value argumentsValue = MakeArguments(command.GetAllocator(), std::forward<ARGUMENTS>(arguments)...);
+
+    bool messageSent = false;
+    CYIVideojsBridgeTransport::FutureResponse futureResponse = CallStaticPlayerFunction(std::move(command), functionName, std::move(argumentsValue), &messageSent);
+
+    CYIVideojsBridgeTransport::Response response;
+
+    if (!TakeResult(functionName, futureResponse, messageSent, response))
+    {
+        return false;
+    }
+
+    return DecodeResult(functionName, *response.GetResult(), result);
+}
@@ -1,6 +1,6 @@
-#include "player/YiVideojsVideoSurface.h"
+#include "YiVideojsVideoSurface.h"
 
-#include "player/YiVideojsVideoPlayerPriv.h"
+#include "YiVideojsVideoPlayerPriv.h"
 
 #define LOG_TAG "CYIVideojsVideoSurface"
 
@@ -24,9 +24,11 @@ void CYIVideojsVideoSurface::SetVideoRectangle(const YI_RECT_REL &videoRectangle
 void CYIVideojsVideoSurface::OnAttached(CYIVideoSurfaceView *pVideoSurfaceView)
 {
     CYIVideoSurfacePlatform::OnAttached(pVideoSurfaceView);
+    m_pPlayerPriv->SetSurfaceAttached(true);
 }
 
 void CYIVideojsVideoSurface::OnDetached(CYIVideoSurfaceView *pVideoSurfaceView)
 {
     CYIVideoSurfacePlatform::OnDetached(pVideoSurfaceView);
+    m_pPlayerPriv->SetSurfaceAttached(false);
 }
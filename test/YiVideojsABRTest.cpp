@@ -0,0 +1,233 @@
+#include "YiVideojsABRController.h"
+#include "YiVideojsVideoPlayer.h"
+#include "YiVideojsVideoPlayerPriv.h"
+#include "YiVideojsVideoPlayerTest.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+namespace
+{
+    struct SegmentTraceEntry
+    {
+        uint32_t renditionId;
+        uint64_t bytes;
+        uint64_t downloadTimeMs;
+        uint64_t bufferLengthMs;
+    };
+
+    struct ThroughputControllerRecording
+    {
+        std::vector<uint64_t> bitratesKbps;
+        std::vector<CYIVideojsABRController::SegmentSample> samples;
+        uint32_t ladderCount = 0;
+    };
+
+    // picks the highest rendition that fits within a safety fraction of the throughput measured on the last segment
+    class ThroughputABRController : public CYIVideojsABRController
+    {
+    public:
+        explicit ThroughputABRController(ThroughputControllerRecording &recording)
+            : m_recording(recording)
+        {
+        }
+
+        virtual void OnRenditionsChanged(const std::vector<uint64_t> &bitratesKbps) override
+        {
+            m_recording.bitratesKbps = bitratesKbps;
+            ++m_recording.ladderCount;
+        }
+
+        virtual uint32_t OnSegmentDownloaded(const SegmentSample &sample) override
+        {
+            static const uint64_t SAFETY_PERCENT = 80;
+
+            m_recording.samples.push_back(sample);
+
+            uint64_t throughputKbps = sample.downloadTimeMs > 0 ? sample.bytes * 8 / sample.downloadTimeMs : 0;
+            uint64_t budgetKbps = throughputKbps * SAFETY_PERCENT / 100;
+            uint32_t renditionId = 0;
+
+            for (size_t i = 0; i < m_recording.bitratesKbps.size(); ++i)
+            {
+                if (m_recording.bitratesKbps[i] <= budgetKbps)
+                {
+                    renditionId = static_cast<uint32_t>(i);
+                }
+            }
+
+            return renditionId;
+        }
+
+    private:
+        ThroughputControllerRecording &m_recording;
+    };
+
+    void EmitRenditionLadder(CYIVideojsSimulatedBridgeTransport &transport, int32_t instanceId, const std::vector<int32_t> &bitratesKbps)
+    {
+        yi::rapidjson::Document ladder(yi::rapidjson::kArrayType);
+        yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = ladder.GetAllocator();
+
+        for (size_t i = 0; i < bitratesKbps.size(); ++i)
+        {
+            yi::rapidjson::Value renditionValue(yi::rapidjson::kObjectType);
+            renditionValue.AddMember(yi::rapidjson::StringRef("id"), yi::rapidjson::Value(static_cast<int32_t>(i)), allocator);
+            renditionValue.AddMember(yi::rapidjson::StringRef("bitrateKbps"), yi::rapidjson::Value(bitratesKbps[i]), allocator);
+            ladder.PushBack(renditionValue, allocator);
+        }
+
+        transport.EmitEvent(instanceId, "renditionsChanged", std::move(ladder));
+    }
+
+    void EmitSegmentDownloaded(CYIVideojsSimulatedBridgeTransport &transport, int32_t instanceId, const SegmentTraceEntry &entry)
+    {
+        static const uint64_t SEGMENT_DURATION_MS = 4000;
+
+        yi::rapidjson::Document sample(yi::rapidjson::kObjectType);
+        yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = sample.GetAllocator();
+
+        sample.AddMember(yi::rapidjson::StringRef("renditionId"), yi::rapidjson::Value(entry.renditionId), allocator);
+        sample.AddMember(yi::rapidjson::StringRef("bytes"), yi::rapidjson::Value(entry.bytes), allocator);
+        sample.AddMember(yi::rapidjson::StringRef("downloadTimeMs"), yi::rapidjson::Value(entry.downloadTimeMs), allocator);
+        sample.AddMember(yi::rapidjson::StringRef("mediaDurationMs"), yi::rapidjson::Value(SEGMENT_DURATION_MS), allocator);
+        sample.AddMember(yi::rapidjson::StringRef("bufferLengthMs"), yi::rapidjson::Value(entry.bufferLengthMs), allocator);
+
+        transport.EmitEvent(instanceId, "segmentDownloaded", std::move(sample));
+    }
+
+    void CaptureFunctionCalls(CYIVideojsSimulatedBridgeTransport &transport, const CYIString &functionName, std::vector<uint32_t> &values)
+    {
+        transport.SetFunctionHandler(functionName, [&values](int32_t, const yi::rapidjson::Value &functionArgumentsValue, yi::rapidjson::Document &, CYIString &) {
+            const yi::rapidjson::Value &argumentValue = functionArgumentsValue[0];
+            values.push_back(argumentValue.IsBool() ? static_cast<uint32_t>(argumentValue.GetBool()) : argumentValue.GetUint());
+            return true;
+        });
+    }
+}
+
+TEST(VideojsABRTest, ABRControllerFollowsASimulatedBandwidthTrace)
+{
+    // 1 MB over one second is 8000 kbps, of which 80% leaves room for the 5000 kbps rendition
+    static const SegmentTraceEntry TRACE[] = {
+        { 0, 500000, 1000, 4000 },
+        { 1, 500000, 1000, 8000 },
+        { 1, 1000000, 1000, 12000 },
+        { 2, 1000000, 1000, 16000 },
+        { 2, 62500, 1000, 14000 },
+        { 0, 62500, 1000, 12000 },
+        { 0, 500000, 1000, 13000 }
+    };
+
+    CYIVideojsVideoPlayerTest::SimulatedTransportScope transportScope(CYIVideojsVideoPlayerTest::GetImmediateConfiguration());
+    CYIVideojsSimulatedBridgeTransport &transport = transportScope.GetTransport();
+
+    std::vector<uint32_t> sentExternalABREnabled;
+    std::vector<uint32_t> sentRenditionIds;
+
+    CaptureFunctionCalls(transport, "setExternalABREnabled", sentExternalABREnabled);
+    CaptureFunctionCalls(transport, "setABRRendition", sentRenditionIds);
+
+    std::unique_ptr<CYIVideojsVideoPlayer> pPlayer = CYIVideojsVideoPlayerTest::CreateInitializedPlayer();
+    ASSERT_NE(pPlayer, nullptr);
+
+    CYIVideojsVideoPlayerPriv *pPriv = CYIVideojsVideoPlayerTest::GetPriv(pPlayer.get());
+
+    ThroughputControllerRecording recording;
+    pPriv->SetABRController(std::unique_ptr<CYIVideojsABRController>(new ThroughputABRController(recording)));
+
+    EXPECT_EQ(sentExternalABREnabled, std::vector<uint32_t>({ 1 }));
+
+    EmitRenditionLadder(transport, pPriv->GetInstanceId(), { 800, 2500, 5000 });
+    transport.ProcessEvents();
+
+    EXPECT_EQ(recording.bitratesKbps, std::vector<uint64_t>({ 800, 2500, 5000 }));
+
+    for (const SegmentTraceEntry &entry : TRACE)
+    {
+        EmitSegmentDownloaded(transport, pPriv->GetInstanceId(), entry);
+    }
+
+    transport.ProcessEvents();
+
+    EXPECT_EQ(recording.samples.size(), sizeof(TRACE) / sizeof(TRACE[0]));
+
+    for (size_t i = 0; i < recording.samples.size() && i < sizeof(TRACE) / sizeof(TRACE[0]); ++i)
+    {
+        EXPECT_EQ(recording.samples[i].renditionId, TRACE[i].renditionId);
+        EXPECT_EQ(recording.samples[i].bytes, TRACE[i].bytes);
+        EXPECT_EQ(recording.samples[i].downloadTimeMs, TRACE[i].downloadTimeMs);
+        EXPECT_EQ(recording.samples[i].mediaDurationMs, 4000u);
+        EXPECT_EQ(recording.samples[i].bufferLengthMs, TRACE[i].bufferLengthMs);
+    }
+
+    // the controller answers 1, 1, 2, 2, 0, 0, 1 and only the changes cross the bridge
+    EXPECT_EQ(sentRenditionIds, std::vector<uint32_t>({ 1, 2, 0, 1 }));
+
+    pPriv->SetABRController(nullptr);
+
+    EXPECT_EQ(sentExternalABREnabled, std::vector<uint32_t>({ 1, 0 }));
+}
+
+TEST(VideojsABRTest, ABRControllerDecisionsAreValidatedAndDeduplicated)
+{
+    static const SegmentTraceEntry FAST_SEGMENT = { 0, 1000000, 1000, 8000 };
+
+    CYIVideojsVideoPlayerTest::SimulatedTransportScope transportScope(CYIVideojsVideoPlayerTest::GetImmediateConfiguration());
+    CYIVideojsSimulatedBridgeTransport &transport = transportScope.GetTransport();
+
+    std::vector<uint32_t> sentRenditionIds;
+    CaptureFunctionCalls(transport, "setABRRendition", sentRenditionIds);
+
+    std::unique_ptr<CYIVideojsVideoPlayer> pPlayer = CYIVideojsVideoPlayerTest::CreateInitializedPlayer();
+    ASSERT_NE(pPlayer, nullptr);
+
+    CYIVideojsVideoPlayerPriv *pPriv = CYIVideojsVideoPlayerTest::GetPriv(pPlayer.get());
+    int32_t instanceId = pPriv->GetInstanceId();
+
+    ThroughputControllerRecording recording;
+    pPriv->SetABRController(std::unique_ptr<CYIVideojsABRController>(new ThroughputABRController(recording)));
+
+    // a sample without the required byte count is dropped before it reaches the controller
+    yi::rapidjson::Document incompleteSample(yi::rapidjson::kObjectType);
+    incompleteSample.AddMember(yi::rapidjson::StringRef("renditionId"), yi::rapidjson::Value(0), incompleteSample.GetAllocator());
+    incompleteSample.AddMember(yi::rapidjson::StringRef("downloadTimeMs"), yi::rapidjson::Value(1000), incompleteSample.GetAllocator());
+    transport.EmitEvent(instanceId, "segmentDownloaded", std::move(incompleteSample));
+    transport.ProcessEvents();
+
+    EXPECT_TRUE(recording.samples.empty());
+
+    // the controller answers with rendition 0 before a ladder is known, which is not sent
+    EmitSegmentDownloaded(transport, instanceId, FAST_SEGMENT);
+    transport.ProcessEvents();
+
+    EXPECT_EQ(recording.samples.size(), 1u);
+    EXPECT_TRUE(sentRenditionIds.empty());
+
+    EmitRenditionLadder(transport, instanceId, { 800, 2500, 5000 });
+    EmitSegmentDownloaded(transport, instanceId, FAST_SEGMENT);
+    EmitSegmentDownloaded(transport, instanceId, FAST_SEGMENT);
+    transport.ProcessEvents();
+
+    EXPECT_EQ(sentRenditionIds, std::vector<uint32_t>({ 2 }));
+
+    // the web view forgets the decision along with the previous ladder, so the same answer is sent again
+    EmitRenditionLadder(transport, instanceId, { 800, 2500, 5000 });
+    EmitSegmentDownloaded(transport, instanceId, FAST_SEGMENT);
+    transport.ProcessEvents();
+
+    EXPECT_EQ(recording.ladderCount, 2u);
+    EXPECT_EQ(sentRenditionIds, std::vector<uint32_t>({ 2, 2 }));
+
+    // a controller installed mid-stream is handed the current ladder and its first decision is always sent
+    ThroughputControllerRecording replacementRecording;
+    pPriv->SetABRController(std::unique_ptr<CYIVideojsABRController>(new ThroughputABRController(replacementRecording)));
+
+    EXPECT_EQ(replacementRecording.bitratesKbps, std::vector<uint64_t>({ 800, 2500, 5000 }));
+
+    EmitSegmentDownloaded(transport, instanceId, FAST_SEGMENT);
+    transport.ProcessEvents();
+
+    EXPECT_EQ(sentRenditionIds, std::vector<uint32_t>({ 2, 2, 2 }));
+}
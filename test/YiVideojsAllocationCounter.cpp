@@ -0,0 +1,130 @@
+#include "YiVideojsAllocationCounter.h"
+
+#if defined(YI_VIDEOJS_COUNT_ALLOCATIONS)
+#    include <atomic>
+#    include <cerrno>
+#    include <cstdlib>
+
+#    include <malloc.h>
+
+// the C allocator is wrapped rather than operator new, so that RapidJSON's CrtAllocator is counted along with every
+// operator new, which allocates through malloc as well
+static std::atomic<uint64_t> s_allocationCount(0);
+static std::atomic<int64_t> s_liveBytes(0);
+
+static void *CountAllocation(void *pMemory)
+{
+    if (pMemory)
+    {
+        s_allocationCount.fetch_add(1, std::memory_order_relaxed);
+        s_liveBytes.fetch_add(static_cast<int64_t>(malloc_usable_size(pMemory)), std::memory_order_relaxed);
+    }
+
+    return pMemory;
+}
+
+static void CountRelease(void *pMemory)
+{
+    if (pMemory)
+    {
+        s_liveBytes.fetch_sub(static_cast<int64_t>(malloc_usable_size(pMemory)), std::memory_order_relaxed);
+    }
+}
+
+extern "C"
+{
+    void *__libc_malloc(size_t size);
+    void *__libc_calloc(size_t count, size_t size);
+    void *__libc_realloc(void *pMemory, size_t size);
+    void *__libc_memalign(size_t alignment, size_t size);
+    void __libc_free(void *pMemory);
+
+    void *malloc(size_t size) noexcept
+    {
+        return CountAllocation(__libc_malloc(size));
+    }
+
+    void *calloc(size_t count, size_t size) noexcept
+    {
+        return CountAllocation(__libc_calloc(count, size));
+    }
+
+    void *realloc(void *pMemory, size_t size) noexcept
+    {
+        size_t previousSize = pMemory ? malloc_usable_size(pMemory) : 0;
+        void *pReallocatedMemory = __libc_realloc(pMemory, size);
+
+        // a failed realloc leaves the original block in place, and a zero size realloc frees it
+        if (pReallocatedMemory || size == 0)
+        {
+            s_liveBytes.fetch_sub(static_cast<int64_t>(previousSize), std::memory_order_relaxed);
+        }
+
+        return pReallocatedMemory ? CountAllocation(pReallocatedMemory) : nullptr;
+    }
+
+    // the aligned entry points are wrapped too, otherwise freeing their blocks would be subtracted from the live bytes
+    // without ever having been added
+    void *memalign(size_t alignment, size_t size) noexcept
+    {
+        return CountAllocation(__libc_memalign(alignment, size));
+    }
+
+    void *aligned_alloc(size_t alignment, size_t size) noexcept
+    {
+        return CountAllocation(__libc_memalign(alignment, size));
+    }
+
+    int posix_memalign(void **ppMemory, size_t alignment, size_t size) noexcept
+    {
+        if (alignment % sizeof(void *) != 0 || (alignment & (alignment - 1)) != 0)
+        {
+            return EINVAL;
+        }
+
+        void *pMemory = CountAllocation(__libc_memalign(alignment, size));
+
+        if (!pMemory)
+        {
+            return ENOMEM;
+        }
+
+        *ppMemory = pMemory;
+
+        return 0;
+    }
+
+    void free(void *pMemory) noexcept
+    {
+        CountRelease(pMemory);
+        __libc_free(pMemory);
+    }
+}
+#endif
+
+bool CYIVideojsAllocationCounter::IsEnabled()
+{
+#if defined(YI_VIDEOJS_COUNT_ALLOCATIONS)
+    return true;
+#else
+    return false;
+#endif
+}
+
+uint64_t CYIVideojsAllocationCounter::GetAllocationCount()
+{
+#if defined(YI_VIDEOJS_COUNT_ALLOCATIONS)
+    return s_allocationCount.load(std::memory_order_relaxed);
+#else
+    return 0;
+#endif
+}
+
+int64_t CYIVideojsAllocationCounter::GetLiveBytes()
+{
+#if defined(YI_VIDEOJS_COUNT_ALLOCATIONS)
+    return s_liveBytes.load(std::memory_order_relaxed);
+#else
+    return 0;
+#endif
+}
@@ -0,0 +1,21 @@
+#ifndef _YI_VIDEOJS_ALLOCATION_COUNTER_H_
+#define _YI_VIDEOJS_ALLOCATION_COUNTER_H_
+
+#include <cstdint>
+
+// Counts heap allocations made by the whole process and the bytes they currently hold. Counting wraps the glibc
+// allocator, so it is only enabled where the target defines YI_VIDEOJS_COUNT_ALLOCATIONS, elsewhere both stay at zero.
+class CYIVideojsAllocationCounter
+{
+public:
+    static bool IsEnabled();
+    static uint64_t GetAllocationCount();
+
+    // usable size of every live block, which includes the allocator's rounding but not its bookkeeping
+    static int64_t GetLiveBytes();
+
+private:
+    CYIVideojsAllocationCounter() = delete;
+};
+
+#endif // _YI_VIDEOJS_ALLOCATION_COUNTER_H_
@@ -0,0 +1,99 @@
+#include "YiVideojsBridgeReplayer.h"
+#include "YiVideojsVideoPlayer.h"
+#include "YiVideojsVideoPlayerPriv.h"
+#include "YiVideojsVideoPlayerTest.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <memory>
+#include <string>
+
+static const char *PREPARE_URL = "https://storage.googleapis.com/shaka-demo-assets/angel-one/dash.mpd";
+
+namespace
+{
+    void EmitVideoTimeChanged(CYIVideojsSimulatedBridgeTransport &transport, int32_t instanceId, double currentTimeSeconds)
+    {
+        yi::rapidjson::Document timeData(yi::rapidjson::kObjectType);
+        timeData.AddMember(yi::rapidjson::StringRef("currentTimeSeconds"), yi::rapidjson::Value(currentTimeSeconds), timeData.GetAllocator());
+        timeData.AddMember(yi::rapidjson::StringRef("bufferLengthMs"), yi::rapidjson::Value(12000), timeData.GetAllocator());
+
+        transport.EmitEvent(instanceId, "videoTimeChanged", std::move(timeData));
+    }
+}
+
+TEST(VideojsBridgeReplayerTest, RecordedEventsReplayIntoAnotherPlayer)
+{
+    static const uint64_t SEEK_POSITION_MS = 42000;
+    static const double RECORDED_TIME_SECONDS = 43.5;
+
+    const std::string recordingPath = ::testing::TempDir() + "VideojsBridgeReplayerTest.jsonl";
+    std::remove(recordingPath.c_str());
+
+    CYIVideojsVideoPlayerTest::SimulatedTransportScope transportScope;
+    CYIVideojsSimulatedBridgeTransport &transport = transportScope.GetTransport();
+
+    std::unique_ptr<CYIVideojsVideoPlayer> pRecordedPlayer = CYIVideojsVideoPlayerTest::CreateInitializedPlayer();
+    ASSERT_NE(pRecordedPlayer, nullptr);
+
+    CYIVideojsVideoPlayerPriv *pRecordedPriv = CYIVideojsVideoPlayerTest::GetPriv(pRecordedPlayer.get());
+
+    ASSERT_TRUE(CYIVideojsVideoPlayer::StartBridgeRecording(recordingPath.c_str()));
+
+    uint64_t startCallCount = transport.GetCallCount();
+    uint64_t startEventCount = transport.GetEventCount();
+
+    pRecordedPriv->Prepare(CYIUrl(PREPARE_URL), CYIAbstractVideoPlayer::StreamingFormat::DASH);
+    transport.ProcessEvents();
+    CYIVideojsVideoPlayerTest::PollPendingCommands(pRecordedPlayer.get());
+
+    pRecordedPriv->Seek(SEEK_POSITION_MS);
+    transport.ProcessEvents();
+
+    EmitVideoTimeChanged(transport, pRecordedPriv->GetInstanceId(), RECORDED_TIME_SECONDS);
+    transport.ProcessEvents();
+
+    CYIVideojsVideoPlayer::StopBridgeRecording();
+
+    uint64_t recordedCallCount = transport.GetCallCount() - startCallCount;
+    uint64_t recordedEventCount = transport.GetEventCount() - startEventCount;
+
+    EXPECT_GT(recordedEventCount, 0u);
+    EXPECT_EQ(pRecordedPriv->GetPrepareStatistics().preparesCompleted, 1u);
+    EXPECT_EQ(pRecordedPriv->GetCurrentTimeMs(), 43500u);
+
+    CYIVideojsBridgeReplayer replayer;
+    ASSERT_TRUE(replayer.Load(recordingPath.c_str()));
+
+    EXPECT_EQ(replayer.GetStatistics().recordedCalls, recordedCallCount);
+    EXPECT_EQ(replayer.GetStatistics().recordedEvents, recordedEventCount);
+    EXPECT_GT(replayer.GetStatistics().recordedResponses, 0u);
+
+    // the second player prepares the same way so that the recorded states carry its prepare id, but its own simulated
+    // events are never processed, everything it learns comes from the recording
+    std::unique_ptr<CYIVideojsVideoPlayer> pReplayedPlayer = CYIVideojsVideoPlayerTest::CreateInitializedPlayer();
+    ASSERT_NE(pReplayedPlayer, nullptr);
+
+    CYIVideojsVideoPlayerPriv *pReplayedPriv = CYIVideojsVideoPlayerTest::GetPriv(pReplayedPlayer.get());
+    pReplayedPriv->Prepare(CYIUrl(PREPARE_URL), CYIAbstractVideoPlayer::StreamingFormat::DASH);
+
+    EXPECT_EQ(pReplayedPriv->GetPrepareStatistics().preparesCompleted, 0u);
+
+    replayer.SetInstanceIdOverride(pReplayedPriv->GetInstanceId());
+    CYIVideojsBridgeReplayer::Statistics statistics = replayer.RunAtMaximumSpeed();
+
+    EXPECT_EQ(statistics.eventsReplayed, recordedEventCount);
+    EXPECT_EQ(pReplayedPriv->GetPrepareStatistics().preparesCompleted, 1u);
+    EXPECT_EQ(pReplayedPriv->GetCurrentTimeMs(), pRecordedPriv->GetCurrentTimeMs());
+    EXPECT_TRUE(pReplayedPlayer->GetPlayerState().mediaState == pRecordedPlayer->GetPlayerState().mediaState);
+    EXPECT_TRUE(pReplayedPlayer->GetPlayerState().playbackState == pRecordedPlayer->GetPlayerState().playbackState);
+
+    // a replay at the recorded pace delivers the same events and reports how late they were
+    statistics = replayer.RunAtOriginalSpeed();
+
+    EXPECT_EQ(statistics.eventsReplayed, recordedEventCount);
+    EXPECT_GE(statistics.totalEventLatenessUs, statistics.maximumEventLatenessUs);
+
+    std::remove(recordingPath.c_str());
+}
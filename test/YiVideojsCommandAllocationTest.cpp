@@ -0,0 +1,143 @@
+#include "YiVideojsAllocationCounter.h"
+#include "YiVideojsVideoPlayer.h"
+#include "YiVideojsVideoPlayerPriv.h"
+#include "YiVideojsVideoPlayerTest.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+static const uint32_t CYCLES = 16;
+static const char *PREPARE_URL = "https://storage.googleapis.com/shaka-demo-assets/angel-one/dash.mpd";
+
+namespace
+{
+    struct FrameAllocations
+    {
+        uint64_t issued = 0;
+        uint64_t total = 0;
+    };
+
+    // one frame of a user toggling playback while scrubbing: the commands are issued, the batch is flushed at the end of
+    // the frame, serialized and sent through the transport, and the responses and the seeked event are processed
+    FrameAllocations RunFrame(CYIVideojsVideoPlayer *pPlayer, CYIVideojsSimulatedBridgeTransport &transport, uint32_t frame)
+    {
+        CYIVideojsVideoPlayerPriv *pPriv = CYIVideojsVideoPlayerTest::GetPriv(pPlayer);
+
+        FrameAllocations allocations;
+        uint64_t startAllocationCount = CYIVideojsAllocationCounter::GetAllocationCount();
+
+        pPriv->Play();
+        pPriv->Pause();
+        pPriv->Seek(static_cast<uint64_t>(frame) * 1000);
+
+        allocations.issued = CYIVideojsAllocationCounter::GetAllocationCount() - startAllocationCount;
+
+        CYIVideojsVideoPlayerTest::FlushCommandBatch(pPlayer);
+        transport.ProcessEvents();
+        CYIVideojsVideoPlayerTest::PollPendingCommands(pPlayer);
+
+        allocations.total = CYIVideojsAllocationCounter::GetAllocationCount() - startAllocationCount;
+
+        return allocations;
+    }
+}
+
+TEST(VideojsCommandAllocationTest, BatchedCommandsAreSentAsOneMessagePerFrame)
+{
+    CYIVideojsVideoPlayerTest::SimulatedTransportScope transportScope;
+    CYIVideojsSimulatedBridgeTransport &transport = transportScope.GetTransport();
+
+    std::unique_ptr<CYIVideojsVideoPlayer> pPlayer = CYIVideojsVideoPlayerTest::CreateInitializedPlayer();
+    ASSERT_NE(pPlayer, nullptr);
+
+    CYIVideojsVideoPlayerPriv *pPriv = CYIVideojsVideoPlayerTest::GetPriv(pPlayer.get());
+    pPriv->SetAsynchronousCommandsEnabled(true);
+    pPriv->SetCommandBatchingEnabled(true);
+
+    std::vector<CYIString> batches;
+    transport.SetFunctionHandler("executeBatch", [&batches](int32_t, const yi::rapidjson::Value &functionArgumentsValue, yi::rapidjson::Document &result, CYIString &) {
+        const yi::rapidjson::Value &commandsValue = functionArgumentsValue[0];
+        batches.push_back(CYIString(commandsValue.GetString()));
+
+        result.SetArray();
+        result.PushBack(yi::rapidjson::Value(yi::rapidjson::kObjectType), result.GetAllocator());
+        result.PushBack(yi::rapidjson::Value(yi::rapidjson::kObjectType), result.GetAllocator());
+        return true;
+    });
+
+    uint64_t startCallCount = transport.GetCallCount();
+
+    pPriv->Play();
+    pPriv->Pause();
+
+    EXPECT_EQ(transport.GetCallCount(), startCallCount);
+
+    CYIVideojsVideoPlayerTest::FlushCommandBatch(pPlayer.get());
+    CYIVideojsVideoPlayerTest::PollPendingCommands(pPlayer.get());
+
+    ASSERT_EQ(batches.size(), 1u);
+    EXPECT_EQ(batches[0], CYIString("[{\"name\":\"play\",\"args\":[]},{\"name\":\"pause\",\"args\":[]}]"));
+    EXPECT_EQ(transport.GetCallCount(), startCallCount + 1);
+    EXPECT_EQ(CYIVideojsVideoPlayerTest::GetPendingCommandCount(pPlayer.get()), 0u);
+
+    // the next batch is written from the start of the same buffer
+    pPriv->Pause();
+    CYIVideojsVideoPlayerTest::FlushCommandBatch(pPlayer.get());
+
+    ASSERT_EQ(batches.size(), 2u);
+    EXPECT_EQ(batches[1], CYIString("[{\"name\":\"pause\",\"args\":[]}]"));
+}
+
+TEST(VideojsCommandAllocationTest, BatchedFramesHaveABoundedAllocationCount)
+{
+    // issuing commands into a batch does not allocate once the first frame has sized the reused buffers. Flushing still
+    // allocates the completion callback and the pending command entry of the batch, and the simulated web view allocates
+    // for every call and event, much like the real bridge does when it parses the response, so a whole frame is bounded
+    // rather than allocation free.
+    static const uint64_t MAXIMUM_ALLOCATIONS_PER_FRAME = 80;
+
+    // allocations can only be counted where the glibc allocator is wrapped
+    if (!CYIVideojsAllocationCounter::IsEnabled())
+    {
+        return;
+    }
+
+    CYIVideojsVideoPlayerTest::SimulatedTransportScope transportScope;
+    CYIVideojsSimulatedBridgeTransport &transport = transportScope.GetTransport();
+
+    std::unique_ptr<CYIVideojsVideoPlayer> pPlayer = CYIVideojsVideoPlayerTest::CreateInitializedPlayer();
+    ASSERT_NE(pPlayer, nullptr);
+
+    CYIVideojsVideoPlayerPriv *pPriv = CYIVideojsVideoPlayerTest::GetPriv(pPlayer.get());
+    pPriv->Prepare(CYIUrl(PREPARE_URL), CYIAbstractVideoPlayer::StreamingFormat::DASH);
+    transport.ProcessEvents();
+    CYIVideojsVideoPlayerTest::PollPendingCommands(pPlayer.get());
+
+    pPriv->SetAsynchronousCommandsEnabled(true);
+    pPriv->SetCommandBatchingEnabled(true);
+
+    std::vector<FrameAllocations> frameAllocations;
+    frameAllocations.reserve(CYCLES);
+
+    frameAllocations.push_back(RunFrame(pPlayer.get(), transport, 1));
+
+    int64_t startLiveBytes = CYIVideojsAllocationCounter::GetLiveBytes();
+
+    for (uint32_t frame = 2; frame <= CYCLES; ++frame)
+    {
+        frameAllocations.push_back(RunFrame(pPlayer.get(), transport, frame));
+    }
+
+    EXPECT_EQ(CYIVideojsVideoPlayerTest::GetPendingCommandCount(pPlayer.get()), 0u);
+    EXPECT_EQ(CYIVideojsAllocationCounter::GetLiveBytes(), startLiveBytes);
+    EXPECT_LE(frameAllocations[0].total, MAXIMUM_ALLOCATIONS_PER_FRAME * 2);
+
+    for (size_t i = 1; i < frameAllocations.size(); ++i)
+    {
+        EXPECT_EQ(frameAllocations[i].issued, 0u) << "frame " << i + 1;
+        EXPECT_EQ(frameAllocations[i].total, frameAllocations[1].total) << "frame " << i + 1;
+        EXPECT_LE(frameAllocations[i].total, MAXIMUM_ALLOCATIONS_PER_FRAME) << "frame " << i + 1;
+    }
+}
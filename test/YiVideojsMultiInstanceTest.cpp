@@ -0,0 +1,141 @@
+#include "YiVideojsVideoPlayer.h"
+#include "YiVideojsVideoPlayerPriv.h"
+#include "YiVideojsVideoPlayerTest.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <set>
+#include <vector>
+
+static const size_t PLAYER_COUNT = 8;
+
+namespace
+{
+    std::vector<std::unique_ptr<CYIVideojsVideoPlayer>> CreatePlayers(size_t count)
+    {
+        std::vector<std::unique_ptr<CYIVideojsVideoPlayer>> players;
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            std::unique_ptr<CYIVideojsVideoPlayer> pPlayer = CYIVideojsVideoPlayerTest::CreateInitializedPlayer();
+
+            if (pPlayer)
+            {
+                players.push_back(std::move(pPlayer));
+            }
+        }
+
+        return players;
+    }
+
+    uint64_t GetDurationMsForPlayer(size_t index)
+    {
+        return (index + 1) * 10000;
+    }
+
+    void EmitDurations(CYIVideojsSimulatedBridgeTransport &transport, const std::vector<std::unique_ptr<CYIVideojsVideoPlayer>> &players)
+    {
+        for (size_t i = 0; i < players.size(); ++i)
+        {
+            if (players[i])
+            {
+                transport.EmitEvent(players[i]->GetInstanceId(), "videoDurationChanged", yi::rapidjson::Value(GetDurationMsForPlayer(i) / 1000.0));
+            }
+        }
+
+        transport.ProcessEvents();
+    }
+}
+
+TEST(VideojsMultiInstanceTest, EightInstancesShareOneBridgeHandler)
+{
+    CYIVideojsVideoPlayerTest::SimulatedTransportScope transportScope;
+    CYIVideojsSimulatedBridgeTransport &transport = transportScope.GetTransport();
+
+    std::vector<std::unique_ptr<CYIVideojsVideoPlayer>> players = CreatePlayers(PLAYER_COUNT);
+    EXPECT_EQ(players.size(), PLAYER_COUNT);
+
+    std::set<int32_t> instanceIds;
+
+    for (const std::unique_ptr<CYIVideojsVideoPlayer> &pPlayer : players)
+    {
+        instanceIds.insert(pPlayer->GetInstanceId());
+    }
+
+    EXPECT_EQ(instanceIds.size(), players.size());
+    EXPECT_EQ(transport.GetEventHandlerCount(), 1u);
+
+    players.clear();
+
+    EXPECT_EQ(transport.GetEventHandlerCount(), 0u);
+}
+
+TEST(VideojsMultiInstanceTest, EventsAreRoutedToTheirOwnInstanceOnly)
+{
+    static const size_t MUTED_PLAYER_INDEX = 3;
+
+    CYIVideojsVideoPlayerTest::SimulatedTransportScope transportScope;
+    CYIVideojsSimulatedBridgeTransport &transport = transportScope.GetTransport();
+
+    std::vector<std::unique_ptr<CYIVideojsVideoPlayer>> players = CreatePlayers(PLAYER_COUNT);
+    EXPECT_EQ(players.size(), PLAYER_COUNT);
+
+    EmitDurations(transport, players);
+
+    for (size_t i = 0; i < players.size(); ++i)
+    {
+        EXPECT_EQ(CYIVideojsVideoPlayerTest::GetPriv(players[i].get())->GetDurationMs(), GetDurationMsForPlayer(i));
+    }
+
+    if (players.size() <= MUTED_PLAYER_INDEX)
+    {
+        return;
+    }
+
+    transport.EmitEvent(players[MUTED_PLAYER_INDEX]->GetInstanceId(), "muteStatusChanged", yi::rapidjson::Value(true));
+    transport.ProcessEvents();
+
+    for (size_t i = 0; i < players.size(); ++i)
+    {
+        EXPECT_EQ(CYIVideojsVideoPlayerTest::GetPriv(players[i].get())->IsMuted(), (i == MUTED_PLAYER_INDEX));
+    }
+}
+
+TEST(VideojsMultiInstanceTest, EventsForDestroyedInstancesAreDropped)
+{
+    CYIVideojsVideoPlayerTest::SimulatedTransportScope transportScope;
+    CYIVideojsSimulatedBridgeTransport &transport = transportScope.GetTransport();
+
+    std::vector<std::unique_ptr<CYIVideojsVideoPlayer>> players = CreatePlayers(PLAYER_COUNT);
+    EXPECT_EQ(players.size(), PLAYER_COUNT);
+
+    std::vector<int32_t> destroyedInstanceIds;
+
+    // every other player is destroyed, the survivors keep their slots so that their expected durations are unchanged
+    for (size_t i = 0; i < players.size(); i += 2)
+    {
+        destroyedInstanceIds.push_back(players[i]->GetInstanceId());
+        players[i].reset();
+    }
+
+    EmitDurations(transport, players);
+
+    // raised after the survivors' durations, so a misrouted event would overwrite one of them
+    for (int32_t instanceId : destroyedInstanceIds)
+    {
+        transport.EmitEvent(instanceId, "videoDurationChanged", yi::rapidjson::Value(1.0));
+    }
+
+    transport.ProcessEvents();
+
+    EXPECT_EQ(transport.GetEventHandlerCount(), 1u);
+
+    for (size_t i = 0; i < players.size(); ++i)
+    {
+        if (players[i])
+        {
+            EXPECT_EQ(CYIVideojsVideoPlayerTest::GetPriv(players[i].get())->GetDurationMs(), GetDurationMsForPlayer(i));
+        }
+    }
+}
@@ -0,0 +1,96 @@
+#include "YiVideojsVideoPlayer.h"
+#include "YiVideojsVideoPlayerPriv.h"
+#include "YiVideojsVideoPlayerTest.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+namespace
+{
+    void EmitRenditionLadder(CYIVideojsSimulatedBridgeTransport &transport, int32_t instanceId)
+    {
+        static const int32_t RENDITIONS[][3] = {
+            { 640, 360, 800 },
+            { 1280, 720, 2500 },
+            { 1920, 1080, 5000 }
+        };
+
+        yi::rapidjson::Document ladder(yi::rapidjson::kArrayType);
+        yi::rapidjson::MemoryPoolAllocator<yi::rapidjson::CrtAllocator> &allocator = ladder.GetAllocator();
+
+        for (size_t i = 0; i < sizeof(RENDITIONS) / sizeof(RENDITIONS[0]); ++i)
+        {
+            yi::rapidjson::Value renditionValue(yi::rapidjson::kObjectType);
+            renditionValue.AddMember(yi::rapidjson::StringRef("id"), yi::rapidjson::Value(static_cast<int32_t>(i)), allocator);
+            renditionValue.AddMember(yi::rapidjson::StringRef("bitrateKbps"), yi::rapidjson::Value(RENDITIONS[i][2]), allocator);
+            renditionValue.AddMember(yi::rapidjson::StringRef("width"), yi::rapidjson::Value(RENDITIONS[i][0]), allocator);
+            renditionValue.AddMember(yi::rapidjson::StringRef("height"), yi::rapidjson::Value(RENDITIONS[i][1]), allocator);
+            ladder.PushBack(renditionValue, allocator);
+        }
+
+        transport.EmitEvent(instanceId, "renditionsChanged", std::move(ladder));
+    }
+
+    YI_RECT_REL MakeVideoRectangle(int32_t width, int32_t height)
+    {
+        YI_RECT_REL videoRectangle;
+        videoRectangle.x = 0;
+        videoRectangle.y = 0;
+        videoRectangle.width = width;
+        videoRectangle.height = height;
+
+        return videoRectangle;
+    }
+}
+
+TEST(VideojsResolutionCapTest, AutomaticResolutionCapRoundsUpToTheNextRendition)
+{
+    CYIVideojsSimulatedBridgeTransport::Configuration configuration = CYIVideojsVideoPlayerTest::GetImmediateConfiguration();
+    configuration.devicePixelRatio = 2.0;
+
+    CYIVideojsVideoPlayerTest::SimulatedTransportScope transportScope(configuration);
+
+    std::vector<glm::ivec2> sentResolutionCaps;
+
+    transportScope.GetTransport().SetFunctionHandler("setMaxResolution", [&sentResolutionCaps](int32_t, const yi::rapidjson::Value &functionArgumentsValue, yi::rapidjson::Document &, CYIString &) {
+        sentResolutionCaps.push_back(glm::ivec2(functionArgumentsValue[0].GetInt(), functionArgumentsValue[1].GetInt()));
+        return true;
+    });
+
+    std::unique_ptr<CYIVideojsVideoPlayer> pPlayer = CYIVideojsVideoPlayerTest::CreateInitializedPlayer();
+    ASSERT_NE(pPlayer, nullptr);
+
+    CYIVideojsVideoPlayerPriv *pPriv = CYIVideojsVideoPlayerTest::GetPriv(pPlayer.get());
+
+    EmitRenditionLadder(transportScope.GetTransport(), pPriv->GetInstanceId());
+    transportScope.GetTransport().ProcessEvents();
+
+    pPriv->SetAutomaticResolutionCapEnabled(true);
+
+    // 400x225 layout units are 800x450 device pixels, which only the 720p and 1080p renditions cover
+    pPriv->SetVideoRectangle(MakeVideoRectangle(400, 225));
+
+    ASSERT_EQ(sentResolutionCaps.size(), 1u);
+    EXPECT_TRUE(sentResolutionCaps.back() == glm::ivec2(1280, 720));
+
+    // an animation that stays within the 720p rendition does not resend the cap on every frame
+    for (int32_t width = 401; width <= 640; ++width)
+    {
+        pPriv->SetVideoRectangle(MakeVideoRectangle(width, width * 9 / 16));
+    }
+
+    EXPECT_EQ(sentResolutionCaps.size(), 1u);
+
+    pPriv->SetVideoRectangle(MakeVideoRectangle(641, 361));
+
+    ASSERT_EQ(sentResolutionCaps.size(), 2u);
+    EXPECT_TRUE(sentResolutionCaps.back() == glm::ivec2(1920, 1080));
+
+    // a surface larger than the top rendition leaves the ladder unlimited
+    pPriv->SetVideoRectangle(MakeVideoRectangle(1920, 1080));
+
+    ASSERT_FALSE(sentResolutionCaps.empty());
+    EXPECT_TRUE(sentResolutionCaps.back() == glm::ivec2(0, 0));
+}
@@ -0,0 +1,109 @@
+#include "YiVideojsSeekableRangeIndex.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace
+{
+    void ExpectRanges(const CYIVideojsSeekableRangeIndex &index, const std::vector<std::pair<uint64_t, uint64_t>> &expectedRanges)
+    {
+        std::vector<CYIAbstractVideoPlayer::SeekableRange> ranges = index.GetRanges();
+
+        ASSERT_EQ(ranges.size(), expectedRanges.size());
+
+        for (size_t i = 0; i < ranges.size(); ++i)
+        {
+            EXPECT_EQ(ranges[i].startTimeMs, expectedRanges[i].first);
+            EXPECT_EQ(ranges[i].endTimeMs, expectedRanges[i].second);
+        }
+    }
+}
+
+TEST(VideojsSeekableRangeIndexTest, OverlappingRangesAreMerged)
+{
+    CYIVideojsSeekableRangeIndex index;
+    index.Add(10000, 20000);
+    index.Add(15000, 30000);
+    index.Add(5000, 12000);
+
+    ExpectRanges(index, { { 5000, 30000 } });
+
+    // a range that spans several disjoint ranges absorbs all of them
+    index.Add(40000, 50000);
+    index.Add(60000, 70000);
+    index.Add(25000, 65000);
+
+    ExpectRanges(index, { { 5000, 70000 } });
+}
+
+TEST(VideojsSeekableRangeIndexTest, TouchingRangesAreMerged)
+{
+    CYIVideojsSeekableRangeIndex index;
+    index.Add(10000, 20000);
+    index.Add(20000, 30000);
+    index.Add(0, 10000);
+
+    ExpectRanges(index, { { 0, 30000 } });
+    EXPECT_TRUE(index.Contains(20000));
+}
+
+TEST(VideojsSeekableRangeIndexTest, ReversedRangesAreNormalized)
+{
+    CYIVideojsSeekableRangeIndex index;
+    index.Add(20000, 10000);
+
+    ExpectRanges(index, { { 10000, 20000 } });
+}
+
+TEST(VideojsSeekableRangeIndexTest, GapsSnapToTheNearestRangeBoundary)
+{
+    CYIVideojsSeekableRangeIndex index;
+    index.Add(0, 10000);
+    index.Add(20000, 30000);
+
+    ExpectRanges(index, { { 0, 10000 }, { 20000, 30000 } });
+    EXPECT_FALSE(index.Contains(15000));
+
+    EXPECT_EQ(index.GetNearestSeekablePositionMs(12000), 10000u);
+    EXPECT_EQ(index.GetNearestSeekablePositionMs(18000), 20000u);
+
+    // a position halfway between two ranges goes to the end of the earlier range
+    EXPECT_EQ(index.GetNearestSeekablePositionMs(15000), 10000u);
+
+    // positions within a range are left unchanged, including its boundaries
+    EXPECT_EQ(index.GetNearestSeekablePositionMs(0), 0u);
+    EXPECT_EQ(index.GetNearestSeekablePositionMs(10000), 10000u);
+    EXPECT_EQ(index.GetNearestSeekablePositionMs(25000), 25000u);
+}
+
+TEST(VideojsSeekableRangeIndexTest, PositionsOutsideTheRangesClampToTheOuterBoundaries)
+{
+    CYIVideojsSeekableRangeIndex index;
+    index.Add(10000, 20000);
+    index.Add(30000, 40000);
+
+    EXPECT_EQ(index.GetNearestSeekablePositionMs(0), 10000u);
+    EXPECT_EQ(index.GetNearestSeekablePositionMs(9999), 10000u);
+    EXPECT_EQ(index.GetNearestSeekablePositionMs(40001), 40000u);
+    EXPECT_EQ(index.GetNearestSeekablePositionMs(100000), 40000u);
+
+    EXPECT_EQ(index.GetEarliestPositionMs(), 10000u);
+    EXPECT_EQ(index.GetLiveEdgeMs(), 40000u);
+}
+
+TEST(VideojsSeekableRangeIndexTest, EmptyIndexLeavesPositionsUnchanged)
+{
+    CYIVideojsSeekableRangeIndex index;
+
+    EXPECT_TRUE(index.IsEmpty());
+    EXPECT_FALSE(index.Contains(0));
+    EXPECT_EQ(index.GetNearestSeekablePositionMs(0), 0u);
+    EXPECT_EQ(index.GetNearestSeekablePositionMs(42000), 42000u);
+
+    index.Add(10000, 20000);
+    index.Clear();
+
+    EXPECT_TRUE(index.IsEmpty());
+    EXPECT_EQ(index.GetNearestSeekablePositionMs(42000), 42000u);
+}
@@ -0,0 +1,304 @@
+#include "YiVideojsVideoPlayerTest.h"
+
+#include "YiVideojsVideoPlayer.h"
+#include "YiVideojsVideoPlayerPriv.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <map>
+
+static const char *PREPARE_URL = "https://storage.googleapis.com/shaka-demo-assets/angel-one/dash.mpd";
+
+CYIVideojsVideoPlayerTest::SimulatedTransportScope::SimulatedTransportScope()
+    : SimulatedTransportScope(GetImmediateConfiguration())
+{
+}
+
+CYIVideojsVideoPlayerTest::SimulatedTransportScope::SimulatedTransportScope(const CYIVideojsSimulatedBridgeTransport::Configuration &configuration)
+    : m_pTransport(new CYIVideojsSimulatedBridgeTransport(configuration))
+    , m_pPreviousTransport(CYIVideojsBridgeTransport::SetTransport(std::unique_ptr<CYIVideojsBridgeTransport>(m_pTransport)))
+{
+}
+
+CYIVideojsVideoPlayerTest::SimulatedTransportScope::~SimulatedTransportScope()
+{
+    CYIVideojsBridgeTransport::SetTransport(std::move(m_pPreviousTransport));
+}
+
+CYIVideojsSimulatedBridgeTransport &CYIVideojsVideoPlayerTest::SimulatedTransportScope::GetTransport() const
+{
+    return *m_pTransport;
+}
+
+CYIVideojsSimulatedBridgeTransport::Configuration CYIVideojsVideoPlayerTest::GetImmediateConfiguration()
+{
+    CYIVideojsSimulatedBridgeTransport::Configuration configuration;
+    configuration.responseDelayMs = 0;
+    configuration.prepareDelayMs = 0;
+    configuration.seekDelayMs = 0;
+
+    return configuration;
+}
+
+std::unique_ptr<CYIVideojsVideoPlayer> CYIVideojsVideoPlayerTest::CreateInitializedPlayer()
+{
+    std::unique_ptr<CYIVideojsVideoPlayer> pPlayer(CYIVideojsVideoPlayer::Create());
+
+    if (pPlayer)
+    {
+        pPlayer->Init();
+    }
+
+    return pPlayer;
+}
+
+CYIVideojsVideoPlayerPriv *CYIVideojsVideoPlayerTest::GetPriv(CYIVideojsVideoPlayer *pPlayer)
+{
+    return pPlayer->m_pPriv;
+}
+
+void CYIVideojsVideoPlayerTest::FlushCommandBatch(CYIVideojsVideoPlayer *pPlayer)
+{
+    GetPriv(pPlayer)->FlushCommandBatch(CYIVideojsVideoPlayerPriv::CommandBatchFlushReason::EndOfFrame);
+}
+
+void CYIVideojsVideoPlayerTest::PollPendingCommands(CYIVideojsVideoPlayer *pPlayer)
+{
+    GetPriv(pPlayer)->OnPendingCommandTimerTimedOut();
+    GetPriv(pPlayer)->OnPrepareResponseTimerTimedOut();
+}
+
+size_t CYIVideojsVideoPlayerTest::GetPendingCommandCount(CYIVideojsVideoPlayer *pPlayer)
+{
+    return GetPriv(pPlayer)->m_pendingCommands.size();
+}
+
+TEST(VideojsVideoPlayerTest, CreateFailsWithoutAvailableTransport)
+{
+    CYIVideojsVideoPlayerTest::SimulatedTransportScope transportScope;
+    transportScope.GetTransport().SetAvailable(false);
+
+    std::unique_ptr<CYIVideojsVideoPlayer> pPlayer(CYIVideojsVideoPlayer::Create());
+
+    EXPECT_EQ(pPlayer, nullptr);
+}
+
+TEST(VideojsVideoPlayerTest, PrepareCompletesThroughSimulatedStateEvents)
+{
+    CYIVideojsVideoPlayerTest::SimulatedTransportScope transportScope;
+
+    std::unique_ptr<CYIVideojsVideoPlayer> pPlayer = CYIVideojsVideoPlayerTest::CreateInitializedPlayer();
+    ASSERT_NE(pPlayer, nullptr);
+
+    CYIVideojsVideoPlayerPriv *pPriv = CYIVideojsVideoPlayerTest::GetPriv(pPlayer.get());
+    EXPECT_GT(pPriv->GetInstanceId(), 0);
+
+    pPriv->Prepare(CYIUrl(PREPARE_URL), CYIAbstractVideoPlayer::StreamingFormat::DASH);
+
+    // the prepare only completes once the loaded state event has been delivered
+    EXPECT_EQ(pPriv->GetPrepareStatistics().preparesCompleted, 0u);
+
+    transportScope.GetTransport().ProcessEvents();
+
+    EXPECT_EQ(pPriv->GetPrepareStatistics().preparesStarted, 1u);
+    EXPECT_EQ(pPriv->GetPrepareStatistics().preparesCompleted, 1u);
+    EXPECT_EQ(pPriv->GetDurationMs(), transportScope.GetTransport().GetConfiguration().mediaDurationMs);
+}
+
+TEST(VideojsVideoPlayerTest, SeekUpdatesMirroredTime)
+{
+    static const uint64_t SEEK_POSITION_MS = 42000;
+
+    CYIVideojsVideoPlayerTest::SimulatedTransportScope transportScope;
+
+    std::unique_ptr<CYIVideojsVideoPlayer> pPlayer = CYIVideojsVideoPlayerTest::CreateInitializedPlayer();
+    ASSERT_NE(pPlayer, nullptr);
+
+    CYIVideojsVideoPlayerPriv *pPriv = CYIVideojsVideoPlayerTest::GetPriv(pPlayer.get());
+
+    pPriv->Prepare(CYIUrl(PREPARE_URL), CYIAbstractVideoPlayer::StreamingFormat::DASH);
+    transportScope.GetTransport().ProcessEvents();
+
+    pPriv->Seek(SEEK_POSITION_MS);
+    transportScope.GetTransport().ProcessEvents();
+
+    EXPECT_EQ(pPriv->GetCurrentTimeMs(), SEEK_POSITION_MS);
+    EXPECT_EQ(pPriv->GetSeekStatistics().seeksSent, 1u);
+}
+
+TEST(VideojsVideoPlayerTest, MirroredGettersDoNotCallTheWebView)
+{
+    CYIVideojsVideoPlayerTest::SimulatedTransportScope transportScope;
+
+    std::unique_ptr<CYIVideojsVideoPlayer> pPlayer = CYIVideojsVideoPlayerTest::CreateInitializedPlayer();
+    ASSERT_NE(pPlayer, nullptr);
+
+    CYIVideojsVideoPlayerPriv *pPriv = CYIVideojsVideoPlayerTest::GetPriv(pPlayer.get());
+
+    pPriv->Mute(true);
+    transportScope.GetTransport().ProcessEvents();
+
+    uint64_t callCount = transportScope.GetTransport().GetCallCount();
+
+    EXPECT_TRUE(pPriv->IsMuted());
+    EXPECT_EQ(transportScope.GetTransport().GetCallCount(), callCount);
+}
+
+TEST(VideojsVideoPlayerTest, TakeReturnsImmediatelyWhenTheResponseIsNotReady)
+{
+    static const uint32_t RESPONSE_DELAY_MS = 1000;
+
+    CYIVideojsSimulatedBridgeTransport::Configuration configuration = CYIVideojsVideoPlayerTest::GetImmediateConfiguration();
+    configuration.responseDelayMs = RESPONSE_DELAY_MS;
+
+    CYIVideojsSimulatedBridgeTransport transport(configuration);
+
+    bool messageSent = false;
+    CYIVideojsBridgeTransport::FutureResponse futureResponse = transport.CallStaticFunction(yi::rapidjson::Document(), "CYIVideojsVideoPlayer", "getType", yi::rapidjson::Value(yi::rapidjson::kArrayType), &messageSent);
+
+    EXPECT_TRUE(messageSent);
+
+    // a poll of a response that is not ready must not wait out the timeout, or async polling would stall the main thread
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+    bool valueAssigned = true;
+    futureResponse.Take(RESPONSE_DELAY_MS / 2, &valueAssigned);
+
+    EXPECT_FALSE(valueAssigned);
+    EXPECT_TRUE(std::chrono::steady_clock::now() - startTime < std::chrono::milliseconds(RESPONSE_DELAY_MS / 4));
+
+    CYIVideojsBridgeTransport::Response response = futureResponse.Take(RESPONSE_DELAY_MS * 2, &valueAssigned);
+
+    EXPECT_TRUE(valueAssigned);
+    EXPECT_FALSE(response.HasError());
+    EXPECT_TRUE(response.GetResult()->IsString());
+}
+
+TEST(VideojsVideoPlayerTest, SlowAsynchronousCommandsDoNotHoldBackLaterResponses)
+{
+    static const uint32_t SLOW_RESPONSE_DELAY_MS = 10000;
+
+    CYIVideojsVideoPlayerTest::SimulatedTransportScope transportScope;
+    CYIVideojsSimulatedBridgeTransport &transport = transportScope.GetTransport();
+
+    std::unique_ptr<CYIVideojsVideoPlayer> pPlayer = CYIVideojsVideoPlayerTest::CreateInitializedPlayer();
+    ASSERT_NE(pPlayer, nullptr);
+
+    CYIVideojsVideoPlayerPriv *pPriv = CYIVideojsVideoPlayerTest::GetPriv(pPlayer.get());
+    pPriv->SetAsynchronousCommandsEnabled(true);
+
+    CYIVideojsSimulatedBridgeTransport::Configuration configuration = transport.GetConfiguration();
+    configuration.responseDelayMs = SLOW_RESPONSE_DELAY_MS;
+    transport.SetConfiguration(configuration);
+
+    pPriv->Mute(true);
+
+    configuration.responseDelayMs = 0;
+    transport.SetConfiguration(configuration);
+
+    pPriv->Mute(false);
+
+    CYIVideojsVideoPlayerTest::PollPendingCommands(pPlayer.get());
+
+    std::map<CYIString, CYIVideojsVideoPlayer::BridgeLatencyHistogram> histograms = pPriv->GetBridgeLatencyHistograms();
+
+    EXPECT_EQ(histograms["mute"].responses, 0u);
+    EXPECT_EQ(histograms["unmute"].responses, 1u);
+    EXPECT_FALSE(pPriv->IsMuted());
+}
+
+TEST(VideojsVideoPlayerTest, AsynchronousCommandFailuresAreNotPlaybackErrors)
+{
+    CYIVideojsVideoPlayerTest::SimulatedTransportScope transportScope;
+
+    transportScope.GetTransport().SetFunctionHandler("selectAudioTrack", [](int32_t, const yi::rapidjson::Value &, yi::rapidjson::Document &, CYIString &errorMessage) {
+        errorMessage = "No audio track with that id.";
+        return false;
+    });
+
+    std::unique_ptr<CYIVideojsVideoPlayer> pPlayer = CYIVideojsVideoPlayerTest::CreateInitializedPlayer();
+    ASSERT_NE(pPlayer, nullptr);
+
+    uint32_t errorCount = 0;
+    pPlayer->ErrorOccurred.Connect([&errorCount](CYIAbstractVideoPlayer::Error) {
+        ++errorCount;
+    });
+
+    CYIVideojsVideoPlayerPriv *pPriv = CYIVideojsVideoPlayerTest::GetPriv(pPlayer.get());
+    pPriv->SetAsynchronousCommandsEnabled(true);
+
+    // the selection has not been answered yet, so it is reported as successful
+    EXPECT_TRUE(pPriv->SelectAudioTrack(1));
+
+    CYIVideojsVideoPlayerTest::PollPendingCommands(pPlayer.get());
+
+    EXPECT_EQ(pPriv->GetBridgeLatencyHistograms()["selectAudioTrack"].errors, 1u);
+    EXPECT_EQ(errorCount, 0u);
+}
+
+TEST(VideojsVideoPlayerTest, StatesFromReplacedPreparesAreIgnored)
+{
+    static const int32_t COMPLETE_STATE_ID = 6;
+
+    CYIVideojsVideoPlayerTest::SimulatedTransportScope transportScope;
+    CYIVideojsSimulatedBridgeTransport &transport = transportScope.GetTransport();
+
+    std::unique_ptr<CYIVideojsVideoPlayer> pPlayer = CYIVideojsVideoPlayerTest::CreateInitializedPlayer();
+    ASSERT_NE(pPlayer, nullptr);
+
+    uint32_t playbackCompleteCount = 0;
+    pPlayer->PlaybackComplete.Connect([&playbackCompleteCount]() {
+        ++playbackCompleteCount;
+    });
+
+    CYIVideojsVideoPlayerPriv *pPriv = CYIVideojsVideoPlayerTest::GetPriv(pPlayer.get());
+
+    // the second prepare replaces the first before any of its states have been delivered
+    pPriv->Prepare(CYIUrl(PREPARE_URL), CYIAbstractVideoPlayer::StreamingFormat::DASH);
+    pPriv->Prepare(CYIUrl(PREPARE_URL), CYIAbstractVideoPlayer::StreamingFormat::DASH);
+    transport.ProcessEvents();
+
+    EXPECT_EQ(pPriv->GetPrepareStatistics().preparesCancelled, 1u);
+    EXPECT_EQ(pPriv->GetPrepareStatistics().preparesCompleted, 1u);
+
+    // the first prepare was given id 1 and the second id 2, so only the second may end the playback
+    for (int32_t prepareId : { 1, 2 })
+    {
+        yi::rapidjson::Document stateData(yi::rapidjson::kObjectType);
+        stateData.AddMember(yi::rapidjson::StringRef("id"), yi::rapidjson::Value(COMPLETE_STATE_ID), stateData.GetAllocator());
+        stateData.AddMember(yi::rapidjson::StringRef("prepareId"), yi::rapidjson::Value(prepareId), stateData.GetAllocator());
+        transport.EmitEvent(pPriv->GetInstanceId(), "stateChanged", std::move(stateData));
+        transport.ProcessEvents();
+
+        EXPECT_EQ(playbackCompleteCount, prepareId == 2 ? 1u : 0u);
+    }
+}
+
+TEST(VideojsVideoPlayerTest, PrepareResponsesAreTrackedOutsideTheCommandQueue)
+{
+    CYIVideojsVideoPlayerTest::SimulatedTransportScope transportScope;
+
+    transportScope.GetTransport().SetFunctionHandler("prepare", [](int32_t, const yi::rapidjson::Value &, yi::rapidjson::Document &, CYIString &errorMessage) {
+        errorMessage = "Unsupported source.";
+        return false;
+    });
+
+    std::unique_ptr<CYIVideojsVideoPlayer> pPlayer = CYIVideojsVideoPlayerTest::CreateInitializedPlayer();
+    ASSERT_NE(pPlayer, nullptr);
+
+    uint32_t errorCount = 0;
+    pPlayer->ErrorOccurred.Connect([&errorCount](CYIAbstractVideoPlayer::Error) {
+        ++errorCount;
+    });
+
+    CYIVideojsVideoPlayerPriv *pPriv = CYIVideojsVideoPlayerTest::GetPriv(pPlayer.get());
+    pPriv->Prepare(CYIUrl(PREPARE_URL), CYIAbstractVideoPlayer::StreamingFormat::DASH);
+
+    EXPECT_EQ(CYIVideojsVideoPlayerTest::GetPendingCommandCount(pPlayer.get()), 0u);
+
+    CYIVideojsVideoPlayerTest::PollPendingCommands(pPlayer.get());
+
+    EXPECT_EQ(pPriv->GetBridgeLatencyHistograms()["prepare"].errors, 1u);
+    EXPECT_EQ(errorCount, 0u);
+}
@@ -0,0 +1,58 @@
+#ifndef _YI_VIDEOJS_VIDEO_PLAYER_TEST_H_
+#define _YI_VIDEOJS_VIDEO_PLAYER_TEST_H_
+
+#include "YiVideojsSimulatedBridgeTransport.h"
+
+#include <memory>
+
+class CYIVideojsVideoPlayer;
+class CYIVideojsVideoPlayerPriv;
+
+/*!
+    \details Gives the host tests access to the private implementation of a CYIVideojsVideoPlayer, and creates players
+    that talk to the simulated bridge transport.
+*/
+class CYIVideojsVideoPlayerTest
+{
+public:
+    /*!
+        \details Installs a simulated bridge transport for the lifetime of the scope and restores the previous transport
+        afterwards. The default configuration answers every call and raises every event without delay.
+    */
+    class SimulatedTransportScope
+    {
+    public:
+        SimulatedTransportScope();
+        explicit SimulatedTransportScope(const CYIVideojsSimulatedBridgeTransport::Configuration &configuration);
+        ~SimulatedTransportScope();
+
+        CYIVideojsSimulatedBridgeTransport &GetTransport() const;
+
+    private:
+        CYIVideojsSimulatedBridgeTransport *m_pTransport;
+        std::unique_ptr<CYIVideojsBridgeTransport> m_pPreviousTransport;
+    };
+
+    static CYIVideojsSimulatedBridgeTransport::Configuration GetImmediateConfiguration();
+
+    /*!
+        \details Creates and initializes a player against the installed transport. Returns null if the player could not
+        be created.
+    */
+    static std::unique_ptr<CYIVideojsVideoPlayer> CreateInitializedPlayer();
+
+    static CYIVideojsVideoPlayerPriv *GetPriv(CYIVideojsVideoPlayer *pPlayer);
+    static void FlushCommandBatch(CYIVideojsVideoPlayer *pPlayer);
+
+    /*!
+        \details Polls the responses of the pending asynchronous commands and of the outstanding prepare once, as their
+        timers would.
+    */
+    static void PollPendingCommands(CYIVideojsVideoPlayer *pPlayer);
+    static size_t GetPendingCommandCount(CYIVideojsVideoPlayer *pPlayer);
+
+private:
+    CYIVideojsVideoPlayerTest() = delete;
+};
+
+#endif // _YI_VIDEOJS_VIDEO_PLAYER_TEST_H_